@@ -8,6 +8,7 @@
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "ceed-avx.h"
@@ -16,14 +17,20 @@
 // Backend Init
 //------------------------------------------------------------------------------
 static int CeedInit_Avx(const char *resource, Ceed ceed) {
-  Ceed ceed_ref;
+  char       *resource_root, resource_ref[CEED_MAX_RESOURCE_LEN];
+  const char *resource_params = strchr(resource, ':');
+  Ceed        ceed_ref;
 
-  CeedCheck(!strcmp(resource, "/cpu/self") || !strcmp(resource, "/cpu/self/avx") || !strcmp(resource, "/cpu/self/avx/blocked"), ceed,
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  CeedCheck(!strcmp(resource_root, "/cpu/self") || !strcmp(resource_root, "/cpu/self/avx") || !strcmp(resource_root, "/cpu/self/avx/blocked"), ceed,
             CEED_ERROR_BACKEND, "AVX backend cannot use resource: %s", resource);
+  CeedCallBackend(CeedFree(&resource_root));
   CeedCallBackend(CeedSetDeterministic(ceed, true));
 
   // Create reference Ceed that implementation will be dispatched through unless overridden
-  CeedCallBackend(CeedInit("/cpu/self/opt/blocked", &ceed_ref));
+  // Resource parameters, such as ':block_size=<n|auto>', are passed on to the opt backend
+  snprintf(resource_ref, sizeof(resource_ref), "/cpu/self/opt/blocked%s", resource_params ? resource_params : "");
+  CeedCallBackend(CeedInit(resource_ref, &ceed_ref));
   CeedCallBackend(CeedSetDelegate(ceed, ceed_ref));
   CeedCallBackend(CeedDestroy(&ceed_ref));
 
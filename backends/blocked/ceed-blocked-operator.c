@@ -102,10 +102,24 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bo
           CeedCallBackend(CeedElemRestrictionCreateBlockedStrided(ceed_rstr, num_elem, elem_size, block_size, num_comp, l_size, strides,
                                                                   &block_rstr[i + start_e]));
         } break;
+        case CEED_RESTRICTION_STRUCTURED: {
+          bool    is_periodic[3];
+          CeedInt dim, num_elem_1d[3], P_1d, node_stride;
+
+          CeedCallBackend(CeedElemRestrictionGetStructure(rstr, &dim, num_elem_1d, &P_1d, is_periodic, &node_stride));
+          CeedCallBackend(CeedElemRestrictionCreateBlockedStructured(ceed_rstr, dim, num_elem_1d, P_1d, block_size, is_periodic, num_comp,
+                                                                     node_stride, comp_stride, l_size, &block_rstr[i + start_e]));
+        } break;
         case CEED_RESTRICTION_POINTS:
           // Empty case - won't occur
           break;
       }
+      {
+        bool use_compressed;
+
+        CeedCallBackend(CeedElemRestrictionGetUseCompressedOffsets(rstr, &use_compressed));
+        CeedCallBackend(CeedElemRestrictionSetUseCompressedOffsets(block_rstr[i + start_e], use_compressed));
+      }
       CeedCallBackend(CeedDestroy(&ceed_rstr));
       CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
       CeedCallBackend(CeedElemRestrictionCreateVector(block_rstr[i + start_e], NULL, &e_vecs_full[i + start_e]));
@@ -265,6 +279,44 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Restrict Element Blocks with Active Elements
+//   Block views into the full E-vector are restricted one at a time, inactive lanes contribute zero in transpose
+//------------------------------------------------------------------------------
+static inline int CeedOperatorRestrictActiveBlocks_Blocked(CeedElemRestriction block_rstr, CeedTransposeMode t_mode, CeedVector vec,
+                                                           CeedVector e_vec_full, CeedVector e_vec_block, CeedOperator_Blocked *impl,
+                                                           CeedRequest *request) {
+  const CeedInt block_size = 8;
+  CeedSize      block_length;
+  CeedScalar   *e_data;
+
+  CeedCallBackend(CeedVectorGetLength(e_vec_block, &block_length));
+  if (t_mode == CEED_NOTRANSPOSE) CeedCallBackend(CeedVectorGetArrayWrite(e_vec_full, CEED_MEM_HOST, &e_data));
+  else CeedCallBackend(CeedVectorGetArray(e_vec_full, CEED_MEM_HOST, &e_data));
+  for (CeedInt a = 0; a < impl->num_active_blocks; a++) {
+    const CeedInt b          = impl->active_blocks[a];
+    CeedScalar   *block_data = &e_data[(CeedSize)b * block_length];
+
+    CeedCallBackend(CeedVectorSetArray(e_vec_block, CEED_MEM_HOST, CEED_USE_POINTER, block_data));
+    if (t_mode == CEED_NOTRANSPOSE) {
+      CeedCallBackend(CeedElemRestrictionApplyBlock(block_rstr, b, CEED_NOTRANSPOSE, vec, e_vec_block, request));
+    } else {
+      if (impl->has_inactive_lanes[a]) {
+        const bool *is_active_lane = &impl->is_active_lane[a * block_size];
+
+        for (CeedSize j = 0; j < block_length; j += block_size) {
+          for (CeedInt l = 0; l < block_size; l++) {
+            if (!is_active_lane[l]) block_data[j + l] = 0.0;
+          }
+        }
+      }
+      CeedCallBackend(CeedElemRestrictionApplyBlock(block_rstr, b, CEED_TRANSPOSE, e_vec_block, vec, request));
+    }
+  }
+  CeedCallBackend(CeedVectorRestoreArray(e_vec_full, &e_data));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator Inputs
 //------------------------------------------------------------------------------
@@ -288,9 +340,12 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt num_input_fields, Ceed
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
     if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
     } else {
-      // Restrict
+      // Restrict, only element blocks with active elements for the active input
       CeedCallBackend(CeedVectorGetState(vec, &state));
-      if ((state != impl->input_states[i] || vec == in_vec) && !impl->skip_rstr_in[i]) {
+      if (is_active && impl->active_blocks && !impl->skip_rstr_in[i]) {
+        CeedCallBackend(CeedOperatorRestrictActiveBlocks_Blocked(impl->block_rstr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i],
+                                                                 impl->e_vecs_active[i], impl, request));
+      } else if ((state != impl->input_states[i] || vec == in_vec) && !impl->skip_rstr_in[i]) {
         CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
       }
       impl->input_states[i] = state;
@@ -443,19 +498,26 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
   CeedCallBackend(CeedOperatorSetup_Blocked(op));
 
   CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
 
   // Restriction only operator
   if (impl->is_identity_rstr_op) {
-    CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[0], CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
-    CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[1], CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    if (impl->active_blocks) {
+      CeedCallBackend(CeedOperatorRestrictActiveBlocks_Blocked(impl->block_rstr[0], CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0],
+                                                               impl->e_vecs_active[0], impl, request));
+      CeedCallBackend(CeedOperatorRestrictActiveBlocks_Blocked(impl->block_rstr[1], CEED_TRANSPOSE, out_vec, impl->e_vecs_full[0],
+                                                               impl->e_vecs_active[0], impl, request));
+    } else {
+      CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[0], CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
+      CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[1], CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    }
     return CEED_ERROR_SUCCESS;
   }
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
+  const CeedInt num_blocks = impl->active_blocks ? impl->num_active_blocks : (num_elem / block_size) + !!(num_elem % block_size);
 
   // Input Evecs and Restriction
   CeedCallBackend(CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, e_data_full, impl, request));
@@ -469,8 +531,10 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
     }
   }
 
-  // Loop through elements
-  for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
+  // Loop through element blocks, skipping blocks without active elements
+  for (CeedInt a = 0; a < num_blocks; a++) {
+    const CeedInt e = (impl->active_blocks ? impl->active_blocks[a] : a) * block_size;
+
     // Output pointers
     for (CeedInt i = 0; i < num_output_fields; i++) {
       CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
@@ -507,9 +571,15 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
     is_active = vec == CEED_VECTOR_ACTIVE;
     // Active
     if (is_active) vec = out_vec;
-    // Restrict
-    CeedCallBackend(
-        CeedElemRestrictionApply(impl->block_rstr[i + impl->num_inputs], CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
+    // Restrict, only element blocks with active elements
+    if (impl->active_blocks) {
+      CeedCallBackend(CeedOperatorRestrictActiveBlocks_Blocked(impl->block_rstr[i + impl->num_inputs], CEED_TRANSPOSE, vec,
+                                                               impl->e_vecs_full[i + impl->num_inputs], impl->e_vecs_active[i + impl->num_inputs],
+                                                               impl, request));
+    } else {
+      CeedCallBackend(
+          CeedElemRestrictionApply(impl->block_rstr[i + impl->num_inputs], CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
+    }
     if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
   }
 
@@ -770,10 +840,72 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
   CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
   CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_block_rstr));
 
+  // Active element data
+  CeedCallBackend(CeedFree(&impl->active_blocks));
+  CeedCallBackend(CeedFree(&impl->is_active_lane));
+  CeedCallBackend(CeedFree(&impl->has_inactive_lanes));
+  for (CeedInt i = 0; i < 2 * CEED_FIELD_MAX; i++) CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_active[i]));
+
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Set Active Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorSetActiveElements_Blocked(CeedOperator op) {
+  CeedInt               num_active_elem, num_input_fields, num_output_fields;
+  const CeedInt         block_size = 8;
+  const CeedInt        *active_elems;
+  CeedOperatorField    *op_input_fields, *op_output_fields;
+  CeedOperator_Blocked *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetActiveElements(op, &num_active_elem, &active_elems));
+  CeedCallBackend(CeedFree(&impl->active_blocks));
+  CeedCallBackend(CeedFree(&impl->is_active_lane));
+  CeedCallBackend(CeedFree(&impl->has_inactive_lanes));
+  impl->num_active_blocks = 0;
+  if (!active_elems) return CEED_ERROR_SUCCESS;
+
+  // Element blocks with active elements, at most one block per active element
+  const CeedInt max_blocks = num_active_elem ? num_active_elem : 1;
+
+  CeedCallBackend(CeedCalloc(max_blocks, &impl->active_blocks));
+  CeedCallBackend(CeedCalloc(max_blocks * block_size, &impl->is_active_lane));
+  CeedCallBackend(CeedCalloc(max_blocks, &impl->has_inactive_lanes));
+  for (CeedInt a = 0; a < num_active_elem; impl->num_active_blocks++) {
+    const CeedInt b              = active_elems[a] / block_size;
+    bool         *is_active_lane = &impl->is_active_lane[impl->num_active_blocks * block_size];
+
+    impl->active_blocks[impl->num_active_blocks] = b;
+    for (CeedInt l = 0; l < block_size; l++) {
+      is_active_lane[l] = a < num_active_elem && active_elems[a] == b * block_size + l;
+      if (is_active_lane[l]) a++;
+      else impl->has_inactive_lanes[impl->num_active_blocks] = true;
+    }
+  }
+
+  // Element block views into full E-vectors
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    CeedElemRestriction elem_rstr;
+
+    if (impl->e_vecs_active[i]) continue;
+    CeedCallBackend(
+        CeedOperatorFieldGetElemRestriction(i < num_input_fields ? op_input_fields[i] : op_output_fields[i - num_input_fields], &elem_rstr));
+    if (elem_rstr != CEED_ELEMRESTRICTION_NONE) {
+      CeedInt elem_size, num_comp;
+
+      CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(elem_rstr, &num_comp));
+      CeedCallBackend(CeedVectorCreate(CeedOperatorReturnCeed(op), (CeedSize)block_size * elem_size * num_comp, &impl->e_vecs_active[i]));
+    }
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Create
 //------------------------------------------------------------------------------
@@ -787,6 +919,7 @@ int CeedOperatorCreate_Blocked(CeedOperator op) {
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Blocked));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "SetActiveElements", CeedOperatorSetActiveElements_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Blocked));
   CeedCallBackend(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
@@ -30,6 +30,11 @@ typedef struct {
   CeedInt              qf_size_in, qf_size_out;
   CeedVector           qf_l_vec;
   CeedElemRestriction  qf_block_rstr;
+  CeedInt              num_active_blocks;                 /* Number of element blocks with active elements */
+  CeedInt             *active_blocks;                     /* Element blocks with active elements, NULL when all elements are active */
+  bool                *is_active_lane;                    /* Active lanes of each element block with active elements */
+  bool                *has_inactive_lanes;                /* Whether each element block with active elements has inactive lanes */
+  CeedVector           e_vecs_active[2 * CEED_FIELD_MAX]; /* Element block views into full E-vectors, inputs followed by outputs */
 } CeedOperator_Blocked;
 
 CEED_INTERN int CeedOperatorCreate_Blocked(CeedOperator op);
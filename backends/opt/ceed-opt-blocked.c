@@ -8,6 +8,8 @@
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "ceed-opt.h"
@@ -27,11 +29,33 @@ static int CeedDestroy_Opt(Ceed ceed) {
 // Backend Init
 //------------------------------------------------------------------------------
 static int CeedInit_Opt_Blocked(const char *resource, Ceed ceed) {
-  Ceed      ceed_ref;
-  Ceed_Opt *data;
+  char       *resource_root;
+  const char *block_size_spec = strstr(resource, ":block_size=");
+  CeedInt     block_size      = 8;
+  Ceed        ceed_ref;
+  Ceed_Opt   *data;
 
-  CeedCheck(!strcmp(resource, "/cpu/self") || !strcmp(resource, "/cpu/self/opt") || !strcmp(resource, "/cpu/self/opt/blocked"), ceed,
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  CeedCheck(!strcmp(resource_root, "/cpu/self") || !strcmp(resource_root, "/cpu/self/opt") || !strcmp(resource_root, "/cpu/self/opt/blocked"), ceed,
             CEED_ERROR_BACKEND, "Opt backend cannot use resource: %s", resource);
+  CeedCallBackend(CeedFree(&resource_root));
+
+  // Default block size may be set via ':block_size=<n>' or ':block_size=auto'
+  if (block_size_spec) {
+    const char *block_size_value = block_size_spec + strlen(":block_size=");
+    char       *end;
+    long        value;
+
+    if (!strncmp(block_size_value, "auto", 4) && (block_size_value[4] == '\0' || block_size_value[4] == ':')) {
+      block_size = CEED_BLOCK_SIZE_AUTO;
+    } else {
+      // Reject trailing characters other than further resource parameters
+      value = strtol(block_size_value, &end, 10);
+      CeedCheck(end != block_size_value && (*end == '\0' || *end == ':') && value > 0 && value <= INT32_MAX, ceed, CEED_ERROR_BACKEND,
+                "Opt backend cannot use block size: %s", block_size_value);
+      block_size = (CeedInt)value;
+    }
+  }
   CeedCallBackend(CeedSetDeterministic(ceed, true));
 
   // Create reference Ceed that implementation will be dispatched through unless overridden
@@ -42,10 +66,11 @@ static int CeedInit_Opt_Blocked(const char *resource, Ceed ceed) {
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreateAtPoints", CeedOperatorCreateAtPoints_Opt));
 
   // Set block size
   CeedCallBackend(CeedCalloc(1, &data));
-  data->block_size = 8;
+  data->block_size = block_size;
   CeedCallBackend(CeedSetData(ceed, data));
   return CEED_ERROR_SUCCESS;
 }
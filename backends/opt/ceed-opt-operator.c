@@ -5,20 +5,39 @@
 //
 // This file is part of CEED:  http://github.com/ceed
 
+#define _POSIX_C_SOURCE 200112L
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include <time.h>
 
 #include "ceed-opt.h"
 
+//------------------------------------------------------------------------------
+// Check if Passive Input is Stored in Single Precision
+//------------------------------------------------------------------------------
+static int CeedOperatorFieldIsStoredFP32_Opt(CeedOperatorField op_field, bool *is_fp32) {
+  CeedScalarType precision;
+  CeedVector     vec;
+
+  *is_fp32 = false;
+  if (sizeof(CeedScalar) <= sizeof(float)) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedOperatorFieldGetStoragePrecision(op_field, &precision));
+  CeedCallBackend(CeedOperatorFieldGetVector(op_field, &vec));
+  *is_fp32 = precision == CEED_SCALAR_FP32 && vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE;
+  CeedCallBackend(CeedVectorDestroy(&vec));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
-static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, bool *apply_add_basis,
-                                       const CeedInt block_size, CeedElemRestriction *block_rstr, CeedVector *e_vecs_full, CeedVector *e_vecs,
-                                       CeedVector *q_vecs, CeedInt start_e, CeedInt num_fields, CeedInt Q) {
+static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, bool *skip_basis,
+                                       CeedInt *fused_basis_indices, bool *apply_add_basis, const CeedInt block_size,
+                                       CeedElemRestriction *block_rstr, CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs,
+                                       CeedInt start_e, CeedInt num_fields, CeedInt Q) {
   Ceed                ceed;
   CeedSize            e_size, q_size;
   CeedInt             num_comp, size, P;
@@ -102,13 +121,33 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
           CeedCallBackend(CeedElemRestrictionCreateBlockedStrided(ceed_rstr, num_elem, elem_size, block_size, num_comp, l_size, strides,
                                                                   &block_rstr[i + start_e]));
         } break;
+        case CEED_RESTRICTION_STRUCTURED: {
+          bool    is_periodic[3];
+          CeedInt dim, num_elem_1d[3], P_1d, node_stride;
+
+          CeedCallBackend(CeedElemRestrictionGetStructure(rstr, &dim, num_elem_1d, &P_1d, is_periodic, &node_stride));
+          CeedCallBackend(CeedElemRestrictionCreateBlockedStructured(ceed_rstr, dim, num_elem_1d, P_1d, block_size, is_periodic, num_comp,
+                                                                     node_stride, comp_stride, l_size, &block_rstr[i + start_e]));
+        } break;
         case CEED_RESTRICTION_POINTS:
           // Empty case - won't occur
           break;
       }
+      {
+        bool use_compressed;
+
+        CeedCallBackend(CeedElemRestrictionGetUseCompressedOffsets(rstr, &use_compressed));
+        CeedCallBackend(CeedElemRestrictionSetUseCompressedOffsets(block_rstr[i + start_e], use_compressed));
+      }
       CeedCallBackend(CeedDestroy(&ceed_rstr));
       CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
-      CeedCallBackend(CeedElemRestrictionCreateVector(block_rstr[i + start_e], NULL, &e_vecs_full[i + start_e]));
+      // Single precision passive inputs are restricted directly into single precision storage
+      {
+        bool is_fp32 = false;
+
+        if (is_input) CeedCallBackend(CeedOperatorFieldIsStoredFP32_Opt(op_fields[i], &is_fp32));
+        if (!is_fp32) CeedCallBackend(CeedElemRestrictionCreateVector(block_rstr[i + start_e], NULL, &e_vecs_full[i + start_e]));
+      }
     }
 
     switch (eval_mode) {
@@ -158,10 +197,30 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
 
         CeedCallBackend(CeedOperatorFieldGetVector(op_fields[j], &vec_j));
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[j], &rstr_j));
-        if (vec_i == vec_j && rstr_i == rstr_j) {
+        if (vec_i == vec_j && rstr_i == rstr_j && e_vecs_full[i + start_e] && e_vecs_full[j + start_e]) {
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
           skip_rstr[j] = true;
+          // Fuse interpolation and gradient with the same basis, applied with the later field
+          if (!skip_basis[i] && !skip_basis[j] && fused_basis_indices[i] == -1 && fused_basis_indices[j] == -1) {
+            CeedEvalMode eval_mode_i, eval_mode_j;
+
+            CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode_i));
+            CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[j], &eval_mode_j));
+            if ((eval_mode_i == CEED_EVAL_INTERP && eval_mode_j == CEED_EVAL_GRAD) ||
+                (eval_mode_i == CEED_EVAL_GRAD && eval_mode_j == CEED_EVAL_INTERP)) {
+              CeedBasis basis_i, basis_j;
+
+              CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis_i));
+              CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[j], &basis_j));
+              if (basis_i == basis_j) {
+                skip_basis[i]          = true;
+                fused_basis_indices[j] = i;
+              }
+              CeedCallBackend(CeedBasisDestroy(&basis_i));
+              CeedCallBackend(CeedBasisDestroy(&basis_j));
+            }
+          }
         }
         CeedCallBackend(CeedVectorDestroy(&vec_j));
         CeedCallBackend(CeedElemRestrictionDestroy(&rstr_j));
@@ -200,31 +259,186 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
 }
 
 //------------------------------------------------------------------------------
-// Setup Operator
+// Setup Cached Quadrature Point Values of Passive Inputs
 //------------------------------------------------------------------------------
-static int CeedOperatorSetup_Opt(CeedOperator op) {
-  bool                is_setup_done;
-  Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
-  CeedInt             Q, num_input_fields, num_output_fields;
+static int CeedOperatorSetupQuadratureCache_Opt(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                                CeedInt num_elem, CeedInt Q, CeedOperator_Opt *impl) {
+  bool          is_cached[CEED_FIELD_MAX] = {false};
+  const CeedInt block_size                = impl->block_size;
+  const CeedInt num_blocks                = (num_elem / block_size) + !!(num_elem % block_size);
+
+  // Identity QFunctions write their output into the input Q-vector
+  if (impl->is_identity_qf) return CEED_ERROR_SUCCESS;
+
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    bool         cache;
+    CeedEvalMode eval_mode;
+    CeedVector   vec;
+
+    CeedCallBackend(CeedOperatorFieldGetCacheQuadratureValues(op_input_fields[i], &cache));
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    is_cached[i] = cache && vec != CEED_VECTOR_ACTIVE && eval_mode != CEED_EVAL_NONE && eval_mode != CEED_EVAL_WEIGHT;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+  // Fields sharing a fused basis action are cached together
+  for (CeedInt j = 0; j < num_input_fields; j++) {
+    const CeedInt i = impl->fused_basis_in_indices[j];
+
+    if (i != -1) is_cached[i] = is_cached[j] = is_cached[i] || is_cached[j];
+  }
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedInt size;
+
+    if (!is_cached[i]) continue;
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+    CeedCallBackend(CeedCalloc((CeedSize)num_blocks * block_size * Q * size, &impl->q_cache_in[i]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Per-Field Plan
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFieldPlan_Opt(CeedQFunctionField qf_field, CeedOperatorField op_field, CeedInt Q, CeedOperatorFieldPlan_Opt *plan) {
+  CeedVector vec;
+
+  CeedCallBackend(CeedOperatorFieldGetVector(op_field, &vec));
+  plan->is_active = vec == CEED_VECTOR_ACTIVE;
+  CeedCallBackend(CeedVectorDestroy(&vec));
+  CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_field, &plan->eval_mode));
+  CeedCallBackend(CeedQFunctionFieldGetSize(qf_field, &plan->size));
+  plan->e_stride = Q * plan->size;
+  if (plan->eval_mode != CEED_EVAL_WEIGHT) {
+    CeedElemRestriction elem_rstr;
+
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_field, &elem_rstr));
+    CeedCallBackend(CeedElemRestrictionIsAtPoints(elem_rstr, &plan->is_at_points));
+    // The operator field keeps its reference to the restriction
+    plan->rstr = elem_rstr;
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+  }
+  switch (plan->eval_mode) {
+    case CEED_EVAL_NONE:
+    case CEED_EVAL_WEIGHT:
+      break;
+    case CEED_EVAL_INTERP:
+    case CEED_EVAL_GRAD:
+    case CEED_EVAL_DIV:
+    case CEED_EVAL_CURL: {
+      CeedInt   elem_size, num_comp;
+      CeedBasis basis;
+
+      CeedCallBackend(CeedElemRestrictionGetElementSize(plan->rstr, &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(plan->rstr, &num_comp));
+      CeedCallBackend(CeedOperatorFieldGetBasis(op_field, &basis));
+      // The operator field keeps its reference to the basis
+      plan->basis = basis;
+      CeedCallBackend(CeedBasisDestroy(&basis));
+      plan->e_stride = elem_size * num_comp;
+    } break;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Direct QFunction Calls
+//   Q-vectors with basis actions borrow operator owned arrays, so the element block loop passes raw pointers to the user QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupQFunctionUser_Opt(CeedQFunction qf, CeedInt Q, CeedOperator_Opt *impl) {
+  bool              is_direct;
+  CeedInt           vec_length;
+  CeedQFunctionUser f;
+  const CeedInt     block_size = impl->block_size;
+
+  // QFunction backends that do more than call the user function are applied through CeedQFunctionApply
+  CeedCallBackend(CeedQFunctionIsUserFunctionDirect(qf, &is_direct));
+  CeedCallBackend(CeedQFunctionGetVectorLength(qf, &vec_length));
+  CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+  if (impl->is_identity_qf || !is_direct || !f || (Q * block_size) % vec_length != 0) return CEED_ERROR_SUCCESS;
+
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    CeedOperatorFieldPlan_Opt *plan = &impl->plan_in[i];
+
+    if (plan->eval_mode == CEED_EVAL_NONE || impl->q_cache_in[i]) continue;
+    CeedCallBackend(CeedCalloc((CeedSize)block_size * Q * plan->size, &plan->q_data));
+    if (plan->eval_mode == CEED_EVAL_WEIGHT) {
+      const CeedScalar *q_weight;
+
+      CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_in[i], CEED_MEM_HOST, &q_weight));
+      memcpy(plan->q_data, q_weight, (CeedSize)block_size * Q * sizeof(CeedScalar));
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_in[i], &q_weight));
+    }
+    CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, plan->q_data));
+    impl->qf_inputs[i] = plan->q_data;
+  }
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    CeedOperatorFieldPlan_Opt *plan = &impl->plan_out[i];
+
+    if (plan->eval_mode == CEED_EVAL_NONE) continue;
+    CeedCallBackend(CeedCalloc((CeedSize)block_size * Q * plan->size, &plan->q_data));
+    CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, plan->q_data));
+    impl->qf_outputs[i] = plan->q_data;
+  }
+  impl->qf_user = f;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Element Blocks with Active Elements for the Current Block Size
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupActiveBlocks_Opt(CeedOperator op) {
+  CeedInt           num_active_elem;
+  const CeedInt    *active_elems;
+  CeedOperator_Opt *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetActiveElements(op, &num_active_elem, &active_elems));
+  CeedCallBackend(CeedFree(&impl->active_blocks));
+  CeedCallBackend(CeedFree(&impl->is_active_lane));
+  CeedCallBackend(CeedFree(&impl->has_inactive_lanes));
+  impl->num_active_blocks = 0;
+  if (!active_elems) return CEED_ERROR_SUCCESS;
+
+  // At most one block per active element
+  const CeedInt block_size = impl->block_size;
+  const CeedInt max_blocks = num_active_elem ? num_active_elem : 1;
+
+  CeedCallBackend(CeedCalloc(max_blocks, &impl->active_blocks));
+  CeedCallBackend(CeedCalloc(max_blocks * block_size, &impl->is_active_lane));
+  CeedCallBackend(CeedCalloc(max_blocks, &impl->has_inactive_lanes));
+  for (CeedInt a = 0; a < num_active_elem; impl->num_active_blocks++) {
+    const CeedInt b              = active_elems[a] / block_size;
+    bool         *is_active_lane = &impl->is_active_lane[impl->num_active_blocks * block_size];
+
+    impl->active_blocks[impl->num_active_blocks] = b;
+    for (CeedInt l = 0; l < block_size; l++) {
+      is_active_lane[l] = a < num_active_elem && active_elems[a] == b * block_size + l;
+      if (is_active_lane[l]) a++;
+      else impl->has_inactive_lanes[impl->num_active_blocks] = true;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Operator Fields for the Current Block Size
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupCore_Opt(CeedOperator op) {
+  CeedInt             Q, num_elem, num_input_fields, num_output_fields;
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
   CeedOperatorField  *op_input_fields, *op_output_fields;
   CeedOperator_Opt   *impl;
 
-  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
-  if (is_setup_done) return CEED_ERROR_SUCCESS;
-
-  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
-  CeedCallBackend(CeedDestroy(&ceed));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedCallBackend(CeedQFunctionIsIdentity(qf, &impl->is_identity_qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt block_size = ceed_impl->block_size;
+  const CeedInt block_size = impl->block_size;
 
   // Allocate
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->block_rstr));
@@ -232,22 +446,41 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
 
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_basis_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->fused_basis_in_indices));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->apply_add_basis_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->input_states));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_data_fp32));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->block_data));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_cache_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->is_q_cache_valid));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->plan_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->plan_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->qf_inputs));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->qf_outputs));
 
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
+  for (CeedInt i = 0; i < CEED_FIELD_MAX; i++) impl->fused_basis_in_indices[i] = -1;
+
+  // Per-field plans
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedOperatorSetupFieldPlan_Opt(qf_input_fields[i], op_input_fields[i], Q, &impl->plan_in[i]));
+  }
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedOperatorSetupFieldPlan_Opt(qf_output_fields[i], op_output_fields[i], Q, &impl->plan_out[i]));
+  }
 
   // Set up infield and outfield pointer arrays
   // Infields
-  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, true, impl->skip_rstr_in, NULL, block_size, impl->block_rstr, impl->e_vecs_full,
-                                              impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, true, impl->skip_rstr_in, impl->skip_basis_in, impl->fused_basis_in_indices, NULL, block_size,
+                                              impl->block_rstr, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
   // Outfields
-  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, false, impl->skip_rstr_out, impl->apply_add_basis_out, block_size, impl->block_rstr,
+  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, false, impl->skip_rstr_out, NULL, NULL, impl->apply_add_basis_out, block_size, impl->block_rstr,
                                               impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields, num_output_fields, Q));
 
   // Identity QFunctions
@@ -266,11 +499,134 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
     }
   }
 
-  CeedCallBackend(CeedOperatorSetSetupDone(op));
+  // Cached passive inputs
+  CeedCallBackend(CeedOperatorSetupQuadratureCache_Opt(num_input_fields, qf_input_fields, op_input_fields, num_elem, Q, impl));
+
+  // Direct QFunction calls
+  CeedCallBackend(CeedOperatorSetupQFunctionUser_Opt(qf, Q, impl));
+
+  // Element blocks with active elements
+  CeedCallBackend(CeedOperatorSetupActiveBlocks_Opt(op));
   CeedCallBackend(CeedQFunctionDestroy(&qf));
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Free Operator Setup Data
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFree_Opt(CeedOperator op) {
+  CeedOperator_Opt *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  for (CeedInt i = 0; i < impl->num_inputs + impl->num_outputs; i++) {
+    CeedCallBackend(CeedElemRestrictionDestroy(&impl->block_rstr[i]));
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->block_rstr));
+  CeedCallBackend(CeedFree(&impl->e_vecs_full));
+  CeedCallBackend(CeedFree(&impl->input_states));
+  if (impl->e_data_fp32) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedFree(&impl->e_data_fp32[i]));
+      CeedCallBackend(CeedFree(&impl->block_data[i]));
+    }
+  }
+  CeedCallBackend(CeedFree(&impl->e_data_fp32));
+  CeedCallBackend(CeedFree(&impl->block_data));
+  if (impl->q_cache_in) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedFree(&impl->q_cache_in[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->q_cache_in));
+  CeedCallBackend(CeedFree(&impl->is_q_cache_valid));
+  CeedCallBackend(CeedFree(&impl->skip_rstr_in));
+  CeedCallBackend(CeedFree(&impl->skip_rstr_out));
+  CeedCallBackend(CeedFree(&impl->skip_basis_in));
+  CeedCallBackend(CeedFree(&impl->fused_basis_in_indices));
+  CeedCallBackend(CeedFree(&impl->apply_add_basis_out));
+
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
+    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->e_vecs_in));
+  CeedCallBackend(CeedFree(&impl->q_vecs_in));
+
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i]));
+    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->e_vecs_out));
+  CeedCallBackend(CeedFree(&impl->q_vecs_out));
+
+  // Q-vector data is freed once no Q-vector borrows it
+  if (impl->plan_in) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedFree(&impl->plan_in[i].q_data));
+  }
+  if (impl->plan_out) {
+    for (CeedInt i = 0; i < impl->num_outputs; i++) CeedCallBackend(CeedFree(&impl->plan_out[i].q_data));
+  }
+  CeedCallBackend(CeedFree(&impl->plan_in));
+  CeedCallBackend(CeedFree(&impl->plan_out));
+  CeedCallBackend(CeedFree(&impl->qf_inputs));
+  CeedCallBackend(CeedFree(&impl->qf_outputs));
+  impl->qf_user = NULL;
+
+  // AtPoints data
+  CeedCallBackend(CeedVectorDestroy(&impl->point_coords_block));
+  CeedCallBackend(CeedFree(&impl->block_elems));
+  CeedCallBackend(CeedFree(&impl->block_num_points));
+  CeedCallBackend(CeedFree(&impl->block_points_offsets));
+  CeedCallBackend(CeedFree(&impl->lane_num_points_in));
+  CeedCallBackend(CeedFree(&impl->lane_num_points_out));
+  CeedCallBackend(CeedFree(&impl->points_offsets));
+  CeedCallBackend(CeedOperatorDestroy(&impl->op_assemble_at_points));
+
+  // Active element data
+  CeedCallBackend(CeedFree(&impl->active_blocks));
+  CeedCallBackend(CeedFree(&impl->is_active_lane));
+  CeedCallBackend(CeedFree(&impl->has_inactive_lanes));
+  impl->num_active_blocks   = 0;
+  impl->num_inputs          = 0;
+  impl->num_outputs         = 0;
+  impl->is_identity_rstr_op = false;
+
+  // QFunction assembly data
+  CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
+  CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_block_rstr));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Operator
+//------------------------------------------------------------------------------
+static int CeedOperatorSetup_Opt(CeedOperator op) {
+  bool              is_setup_done;
+  Ceed              ceed;
+  Ceed_Opt         *ceed_impl;
+  CeedInt           block_size;
+  CeedOperator_Opt *impl;
+
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (is_setup_done) return CEED_ERROR_SUCCESS;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+
+  // Operator block size overrides Ceed default; autotuning starts from the usual block size and is finished on first apply
+  CeedCallBackend(CeedOperatorGetBlockSize(op, &block_size));
+  if (block_size == 0) block_size = ceed_impl->block_size;
+  impl->is_block_size_tuning_needed = block_size == CEED_BLOCK_SIZE_AUTO;
+  if (impl->is_block_size_tuning_needed) block_size = 8;
+  CeedCheck(block_size > 0, ceed, CEED_ERROR_BACKEND, "Opt backend cannot use block size: %" CeedInt_FMT, block_size);
+  CeedCallBackend(CeedDestroy(&ceed));
+  impl->block_size = block_size;
+
+  CeedCallBackend(CeedOperatorSetupCore_Opt(op));
+  CeedCallBackend(CeedOperatorSetSetupDone(op));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Input Fields
 //------------------------------------------------------------------------------
@@ -288,20 +644,46 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedQFun
 
       // Get input vector
       CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      if (vec != CEED_VECTOR_ACTIVE) {
+      if (vec != CEED_VECTOR_ACTIVE && !impl->e_vecs_full[i]) {
+        // Restrict single precision input one element block at a time, converting into single precision storage
+        CeedCallBackend(CeedVectorGetState(vec, &state));
+        if (state != impl->input_states[i] || !impl->e_data_fp32[i]) {
+          CeedSize e_size, block_length;
+          CeedInt  num_blocks;
+
+          CeedCallBackend(CeedElemRestrictionGetEVectorSize(impl->block_rstr[i], &e_size));
+          CeedCallBackend(CeedElemRestrictionGetNumBlocks(impl->block_rstr[i], &num_blocks));
+          block_length = e_size / num_blocks;
+          if (!impl->e_data_fp32[i]) {
+            CeedCallBackend(CeedMalloc(e_size, &impl->e_data_fp32[i]));
+            CeedCallBackend(CeedMalloc(block_length, &impl->block_data[i]));
+          }
+          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, impl->block_data[i]));
+          for (CeedInt b = 0; b < num_blocks; b++) {
+            float *block_fp32 = &impl->e_data_fp32[i][b * block_length];
+
+            CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i], b, CEED_NOTRANSPOSE, vec, impl->e_vecs_in[i], request));
+            for (CeedSize j = 0; j < block_length; j++) block_fp32[j] = (float)impl->block_data[i][j];
+          }
+        }
+        if (state != impl->input_states[i]) impl->is_q_cache_valid[i] = false;
+        impl->input_states[i] = state;
+      } else if (vec != CEED_VECTOR_ACTIVE) {
         // Restrict
         CeedCallBackend(CeedVectorGetState(vec, &state));
         if (state != impl->input_states[i] && impl->block_rstr[i] && !impl->skip_rstr_in[i]) {
           CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
         }
-        impl->input_states[i] = state;
         // Get evec
         CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
+        if (state != impl->input_states[i]) impl->is_q_cache_valid[i] = false;
+        impl->input_states[i] = state;
       } else {
         // Set Qvec for CEED_EVAL_NONE
         if (eval_mode == CEED_EVAL_NONE) {
           CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_in[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
           CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i]));
+          if (impl->qf_inputs) impl->qf_inputs[i] = e_data[i];
           CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_in[i], (const CeedScalar **)&e_data[i]));
         }
       }
@@ -313,52 +695,67 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedQFun
 
 //------------------------------------------------------------------------------
 // Input Basis Action
+//   Q-vectors only view element block data when the QFunction is applied through them
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                             CeedInt num_input_fields, CeedInt block_size, CeedVector in_vec, bool skip_active,
-                                             CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl, CeedRequest *request) {
+static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedInt num_input_fields, CeedInt block_size, CeedVector in_vec, bool skip_active,
+                                             bool skip_passive, bool set_q_vecs, CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl,
+                                             CeedRequest *request) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    bool                is_active;
-    CeedInt             elem_size, size, num_comp;
-    CeedEvalMode        eval_mode;
-    CeedVector          vec;
-    CeedElemRestriction elem_rstr;
-    CeedBasis           basis;
+    const CeedOperatorFieldPlan_Opt *plan = &impl->plan_in[i];
 
-    // Skip active input
-    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    CeedCallBackend(CeedVectorDestroy(&vec));
-    if (skip_active && is_active) continue;
+    // Skip active or passive inputs
+    if ((skip_active && plan->is_active) || (skip_passive && !plan->is_active)) continue;
 
-    // Get elem_size, eval_mode, size
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+    // Cached passive input, basis action writes into the cache until it is valid
+    if (impl->q_cache_in[i]) {
+      CeedScalar *q_cache = &impl->q_cache_in[i][(CeedSize)e * Q * plan->size];
+
+      impl->qf_inputs[i] = q_cache;
+      if (set_q_vecs || !impl->is_q_cache_valid[i]) {
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, q_cache));
+      }
+      if (impl->is_q_cache_valid[i]) continue;
+    }
     // Restrict block active input
-    if (is_active && impl->block_rstr[i]) {
+    if (plan->is_active && impl->block_rstr[i]) {
       CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i], e / block_size, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[i], request));
     }
+    // Convert block of single precision passive input
+    if (!plan->is_active && impl->e_data_fp32[i]) {
+      const CeedInt block_length = block_size * plan->e_stride;
+      const float  *block_fp32   = &impl->e_data_fp32[i][(CeedSize)e * plan->e_stride];
+
+      for (CeedInt j = 0; j < block_length; j++) impl->block_data[i][j] = (CeedScalar)block_fp32[j];
+    }
     // Basis action
-    switch (eval_mode) {
+    switch (plan->eval_mode) {
       case CEED_EVAL_NONE:
-        if (!is_active) {
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * Q * size]));
+        if (!plan->is_active) {
+          CeedScalar *q_data = impl->e_data_fp32[i] ? impl->block_data[i] : &e_data[i][(CeedSize)e * plan->e_stride];
+
+          impl->qf_inputs[i] = q_data;
+          if (set_q_vecs) CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, q_data));
         }
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
-        if (!is_active) {
-          CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * elem_size * num_comp]));
+        if (!plan->is_active) {
+          CeedScalar *elem_data = impl->e_data_fp32[i] ? impl->block_data[i] : &e_data[i][(CeedSize)e * plan->e_stride];
+
+          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, elem_data));
+        }
+        if (impl->fused_basis_in_indices[i] != -1) {
+          // Interpolation and gradient of the same field share their tensor contractions
+          const CeedInt j         = impl->fused_basis_in_indices[i];
+          const bool    is_interp = plan->eval_mode == CEED_EVAL_INTERP;
+
+          CeedCallBackend(CeedBasisApplyInterpAndGrad(plan->basis, block_size, impl->e_vecs_in[i], impl->q_vecs_in[is_interp ? i : j],
+                                                      impl->q_vecs_in[is_interp ? j : i]));
+        } else if (!impl->skip_basis_in[i]) {
+          CeedCallBackend(CeedBasisApply(plan->basis, block_size, CEED_NOTRANSPOSE, plan->eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         }
-        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
-        CeedCallBackend(CeedBasisDestroy(&basis));
         break;
       case CEED_EVAL_WEIGHT:
         break;  // No action
@@ -370,32 +767,26 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunction
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
-                                              CeedInt block_size, CeedInt num_input_fields, CeedInt num_output_fields, bool *apply_add_basis,
-                                              bool *skip_rstr, CeedOperator op, CeedVector out_vec, CeedOperator_Opt *impl, CeedRequest *request) {
+static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedOperatorField *op_output_fields, CeedInt block_size, CeedInt num_output_fields,
+                                              bool *apply_add_basis, bool *skip_rstr, CeedOperator op, CeedVector out_vec, CeedOperator_Opt *impl,
+                                              CeedRequest *request) {
   for (CeedInt i = 0; i < num_output_fields; i++) {
-    bool         is_active;
-    CeedEvalMode eval_mode;
-    CeedVector   vec;
-    CeedBasis    basis;
+    const CeedOperatorFieldPlan_Opt *plan = &impl->plan_out[i];
+    CeedVector                       vec;
 
-    // Get eval_mode
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
     // Basis action
-    switch (eval_mode) {
+    switch (plan->eval_mode) {
       case CEED_EVAL_NONE:
         break;  // No action
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
         if (apply_add_basis[i]) {
-          CeedCallBackend(CeedBasisApplyAdd(basis, block_size, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+          CeedCallBackend(CeedBasisApplyAdd(plan->basis, block_size, CEED_TRANSPOSE, plan->eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         } else {
-          CeedCallBackend(CeedBasisApply(basis, block_size, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+          CeedCallBackend(CeedBasisApply(plan->basis, block_size, CEED_TRANSPOSE, plan->eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         }
-        CeedCallBackend(CeedBasisDestroy(&basis));
         break;
       // LCOV_EXCL_START
       case CEED_EVAL_WEIGHT: {
@@ -406,13 +797,15 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctio
     // Restrict output block
     if (skip_rstr[i]) continue;
     // Get output vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    if (is_active) vec = out_vec;
+    if (plan->is_active) {
+      vec = out_vec;
+    } else {
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    }
     // Restrict
     CeedCallBackend(
         CeedElemRestrictionApplyBlock(impl->block_rstr[i + impl->num_inputs], e / block_size, CEED_TRANSPOSE, impl->e_vecs_out[i], vec, request));
-    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+    if (!plan->is_active) CeedCallBackend(CeedVectorDestroy(&vec));
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -428,7 +821,7 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields, CeedQF
 
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
     CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-    if (eval_mode != CEED_EVAL_WEIGHT && vec != CEED_VECTOR_ACTIVE) {
+    if (eval_mode != CEED_EVAL_WEIGHT && vec != CEED_VECTOR_ACTIVE && impl->e_vecs_full[i]) {
       CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data[i]));
     }
     CeedCallBackend(CeedVectorDestroy(&vec));
@@ -437,35 +830,54 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields, CeedQF
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Zero Inactive Lanes of Element Block Vector
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
-  Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
+static inline int CeedOperatorZeroInactiveLanes_Opt(CeedVector vec, CeedInt block_size, const bool *is_active_lane) {
+  CeedSize    length;
+  CeedScalar *array;
+
+  CeedCallBackend(CeedVectorGetLength(vec, &length));
+  CeedCallBackend(CeedVectorGetArray(vec, CEED_MEM_HOST, &array));
+  for (CeedSize j = 0; j < length; j += block_size) {
+    for (CeedInt l = 0; l < block_size; l++) {
+      if (!is_active_lane[l]) array[j + l] = 0.0;
+    }
+  }
+  CeedCallBackend(CeedVectorRestoreArray(vec, &array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply Core
+//   Each element block is applied to all vectors in turn, so passive inputs are restricted and interpolated once per block
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddCore_Opt(CeedOperator op, CeedInt num_vecs, CeedVector *in_vecs, CeedVector *out_vecs, CeedRequest *request) {
+  void               *ctx_data = NULL;
   CeedInt             Q, num_input_fields, num_output_fields, num_elem;
-  CeedEvalMode        eval_mode;
   CeedScalar         *e_data[2 * CEED_FIELD_MAX] = {0};
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
   CeedOperatorField  *op_input_fields, *op_output_fields;
   CeedOperator_Opt   *impl;
 
-  // Setup
-  CeedCallBackend(CeedOperatorSetup_Opt(op));
-
-  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
-  CeedCallBackend(CeedDestroy(&ceed));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
-  const CeedInt block_size = ceed_impl->block_size;
-  const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
+  const CeedInt block_size = impl->block_size;
+  const CeedInt num_blocks = impl->active_blocks ? impl->num_active_blocks : (num_elem / block_size) + !!(num_elem % block_size);
 
   // Restriction only operator
   if (impl->is_identity_rstr_op) {
-    for (CeedInt b = 0; b < num_blocks; b++) {
-      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[0], b, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[0], request));
-      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[1], b, CEED_TRANSPOSE, impl->e_vecs_in[0], out_vec, request));
+    for (CeedInt a = 0; a < num_blocks; a++) {
+      const CeedInt b                  = impl->active_blocks ? impl->active_blocks[a] : a;
+      const bool    has_inactive_lanes = impl->active_blocks && impl->has_inactive_lanes[a];
+
+      for (CeedInt k = 0; k < num_vecs; k++) {
+        CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[0], b, CEED_NOTRANSPOSE, in_vecs[k], impl->e_vecs_in[0], request));
+        if (has_inactive_lanes) {
+          CeedCallBackend(CeedOperatorZeroInactiveLanes_Opt(impl->e_vecs_in[0], block_size, &impl->is_active_lane[a * block_size]));
+        }
+        CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[1], b, CEED_TRANSPOSE, impl->e_vecs_in[0], out_vecs[k], request));
+      }
     }
     return CEED_ERROR_SUCCESS;
   }
@@ -476,34 +888,57 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, in_vec, e_data, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, in_vecs[0], e_data, impl, request));
 
   // Output Lvecs, Evecs, and Qvecs
   for (CeedInt i = 0; i < num_output_fields; i++) {
     // Set Qvec if needed
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
-    if (eval_mode == CEED_EVAL_NONE) {
+    if (impl->plan_out[i].eval_mode == CEED_EVAL_NONE) {
       // Set qvec to single block evec
       CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_out[i], CEED_MEM_HOST, &e_data[i + num_input_fields]));
       CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i + num_input_fields]));
+      impl->qf_outputs[i] = e_data[i + num_input_fields];
       CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_out[i], &e_data[i + num_input_fields]));
     }
   }
 
-  // Loop through elements
-  for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
-    // Input basis apply
-    CeedCallBackend(
-        CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, in_vec, false, e_data, impl, request));
+  // QFunction context for direct calls
+  if (impl->qf_user) CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
 
-    // Q function
-    if (!impl->is_identity_qf) {
-      CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+  // Loop through element blocks, skipping blocks without active elements
+  for (CeedInt a = 0; a < num_blocks; a++) {
+    const CeedInt e                  = (impl->active_blocks ? impl->active_blocks[a] : a) * block_size;
+    const bool    has_inactive_lanes = impl->active_blocks && impl->has_inactive_lanes[a];
+
+    for (CeedInt k = 0; k < num_vecs; k++) {
+      // Input basis apply, passive Q-vectors are kept from the first vector
+      CeedCallBackend(
+          CeedOperatorInputBasis_Opt(e, Q, num_input_fields, block_size, in_vecs[k], false, k > 0, !impl->qf_user, e_data, impl, request));
+
+      // Q function
+      if (impl->qf_user) {
+        CeedCallBackend(impl->qf_user(ctx_data, Q * block_size, impl->qf_inputs, impl->qf_outputs));
+      } else if (!impl->is_identity_qf) {
+        CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+      }
+
+      // Inactive elements in the block contribute zero
+      if (has_inactive_lanes) {
+        for (CeedInt i = 0; i < num_output_fields; i++) {
+          CeedCallBackend(CeedOperatorZeroInactiveLanes_Opt(impl->q_vecs_out[i], block_size, &impl->is_active_lane[a * block_size]));
+        }
+      }
+
+      // Output basis apply and restriction
+      CeedCallBackend(CeedOperatorOutputBasis_Opt(e, op_output_fields, block_size, num_output_fields, impl->apply_add_basis_out, impl->skip_rstr_out,
+                                                  op, out_vecs[k], impl, request));
     }
+  }
+  if (impl->qf_user) CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
 
-    // Output basis apply and restriction
-    CeedCallBackend(CeedOperatorOutputBasis_Opt(e, Q, qf_output_fields, op_output_fields, block_size, num_input_fields, num_output_fields,
-                                                impl->apply_add_basis_out, impl->skip_rstr_out, op, out_vec, impl, request));
+  // Cached quadrature point values are complete once all elements are visited
+  if (!impl->active_blocks) {
+    for (CeedInt i = 0; i < num_input_fields; i++) impl->is_q_cache_valid[i] = impl->q_cache_in[i] != NULL;
   }
 
   // Restore input arrays
@@ -513,40 +948,159 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
 }
 
 //------------------------------------------------------------------------------
-// Core code for linear QFunction assembly
+// Time Applications with a Given Block Size
 //------------------------------------------------------------------------------
-static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
-                                                              CeedRequest *request) {
-  Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
-  CeedInt             qf_size_in, qf_size_out, Q, num_input_fields, num_output_fields, num_elem;
-  CeedScalar         *l_vec_array, *e_data[2 * CEED_FIELD_MAX] = {0};
-  CeedQFunctionField *qf_input_fields, *qf_output_fields;
-  CeedQFunction       qf;
-  CeedOperatorField  *op_input_fields, *op_output_fields;
-  CeedOperator_Opt   *impl;
+static int CeedOperatorTimeBlockSize_Opt(CeedOperator op, CeedInt block_size, CeedVector in_vec, CeedVector out_vec, CeedRequest *request,
+                                         double *time) {
+  // Repeat applications until the monotonic clock has advanced enough to resolve small operators
+  const double      min_duration = 2e-3;
+  CeedInt           num_applies  = 0;
+  double            elapsed      = 0.0;
+  struct timespec   start, stop;
+  CeedOperator_Opt *impl;
 
-  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
-  qf_size_in  = impl->qf_size_in;
-  qf_size_out = impl->qf_size_out;
+  CeedCallBackend(CeedOperatorSetupFree_Opt(op));
+  impl->block_size = block_size;
+  CeedCallBackend(CeedOperatorSetupCore_Opt(op));
+
+  // Warm up caches and lazily built data before timing
+  CeedCallBackend(CeedOperatorApplyAddCore_Opt(op, 1, &in_vec, &out_vec, request));
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  do {
+    CeedCallBackend(CeedOperatorApplyAddCore_Opt(op, 1, &in_vec, &out_vec, request));
+    num_applies++;
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    elapsed = (double)(stop.tv_sec - start.tv_sec) + 1e-9 * (double)(stop.tv_nsec - start.tv_nsec);
+  } while (elapsed < min_duration);
+  *time = elapsed / num_applies;
+  return CEED_ERROR_SUCCESS;
+}
 
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
-  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
-  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
-  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
-  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt       block_size = ceed_impl->block_size;
-  const CeedInt       num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
-  CeedVector          l_vec      = impl->qf_l_vec;
-  CeedElemRestriction block_rstr = impl->qf_block_rstr;
+//------------------------------------------------------------------------------
+// Select Block Size by Timing Candidates on the Actual Operator
+//------------------------------------------------------------------------------
+static int CeedOperatorTuneBlockSize_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  const CeedInt      candidates[]       = {1, 4, 8, 16, 32};
+  const CeedInt      num_candidates     = sizeof(candidates) / sizeof(candidates[0]);
+  bool               has_passive_output = false;
+  CeedInt            num_elem, num_output_fields, default_block_size, best_block_size;
+  double             best_time;
+  CeedVector         out_tune = CEED_VECTOR_NONE;
+  CeedOperatorField *op_output_fields;
+  CeedOperator_Opt  *impl;
 
-  // Setup
-  CeedCallBackend(CeedOperatorSetup_Opt(op));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &op_output_fields));
+  impl->is_block_size_tuning_needed = false;
+  default_block_size                = impl->block_size;
+  best_block_size                   = default_block_size;
 
-  // Check for restriction only operator
-  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
+  // Trial applications would accumulate into passive output vectors, so keep the default block size
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedVector vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    has_passive_output |= vec != CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+  if (has_passive_output) return CEED_ERROR_SUCCESS;
+
+  // Trial applications accumulate into scratch output
+  if (out_vec != CEED_VECTOR_NONE) {
+    CeedSize length;
+
+    CeedCallBackend(CeedVectorGetLength(out_vec, &length));
+    CeedCallBackend(CeedVectorCreate(CeedOperatorReturnCeed(op), length, &out_tune));
+    CeedCallBackend(CeedVectorSetValue(out_tune, 0.0));
+  }
+
+  // Candidates must beat the default by more than timing noise to replace it
+  CeedCallBackend(CeedOperatorTimeBlockSize_Opt(op, default_block_size, in_vec, out_tune, request, &best_time));
+  best_time *= 0.95;
+  for (CeedInt c = 0; c < num_candidates; c++) {
+    const CeedInt block_size = candidates[c];
+    double        time;
+
+    // Blocks larger than the mesh only add padding
+    if (c > 0 && candidates[c - 1] >= num_elem) break;
+    if (block_size == default_block_size) continue;
+
+    CeedCallBackend(CeedOperatorTimeBlockSize_Opt(op, block_size, in_vec, out_tune, request, &time));
+    if (time < best_time) {
+      best_time       = time;
+      best_block_size = block_size;
+    }
+  }
+  CeedCallBackend(CeedVectorDestroy(&out_tune));
+
+  // Rebuild with the fastest block size, discarding cached quadrature point values and active element data written by trial applications
+  CeedCallBackend(CeedOperatorSetupFree_Opt(op));
+  impl->block_size = best_block_size;
+  CeedCallBackend(CeedOperatorSetupCore_Opt(op));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  CeedOperator_Opt *impl;
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  if (impl->is_block_size_tuning_needed) CeedCallBackend(CeedOperatorTuneBlockSize_Opt(op, in_vec, out_vec, request));
+  return CeedOperatorApplyAddCore_Opt(op, 1, &in_vec, &out_vec, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply Multiple
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddMultiple_Opt(CeedOperator op, CeedInt num_vecs, CeedVector *in_vecs, CeedVector *out_vecs, CeedRequest *request) {
+  CeedOperator_Opt *impl;
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  if (impl->is_block_size_tuning_needed) CeedCallBackend(CeedOperatorTuneBlockSize_Opt(op, in_vecs[0], out_vecs[0], request));
+  return CeedOperatorApplyAddCore_Opt(op, num_vecs, in_vecs, out_vecs, request);
+}
+
+//------------------------------------------------------------------------------
+// Core code for linear QFunction assembly
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
+                                                              CeedRequest *request) {
+  Ceed                ceed;
+  CeedInt             qf_size_in, qf_size_out, Q, num_input_fields, num_output_fields, num_elem;
+  CeedScalar         *l_vec_array, *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedQFunction       qf;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedOperator_Opt   *impl;
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  qf_size_in  = impl->qf_size_in;
+  qf_size_out = impl->qf_size_out;
+
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  const CeedInt       block_size = impl->block_size;
+  const CeedInt       num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
+  CeedVector          l_vec      = impl->qf_l_vec;
+  CeedElemRestriction block_rstr = impl->qf_block_rstr;
+
+  // Check for restriction only operator
+  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
 
   // Input Evecs and Restriction
   CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, NULL, e_data, impl, request));
@@ -624,8 +1178,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
     CeedCallBackend(CeedVectorGetArray(l_vec, CEED_MEM_HOST, &l_vec_array));
 
     // Input basis apply
-    CeedCallBackend(
-        CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, NULL, true, e_data, impl, request));
+    CeedCallBackend(CeedOperatorInputBasis_Opt(e, Q, num_input_fields, block_size, NULL, true, false, true, e_data, impl, request));
 
     // Assemble QFunction
     for (CeedInt i = 0; i < num_input_fields; i++) {
@@ -698,6 +1251,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
         CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
         if (vec == CEED_VECTOR_ACTIVE && num_elem > 0) {
           CeedCallBackend(CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL));
+          // Restore operator owned array used by direct QFunction calls
+          if (impl->plan_out[out].q_data) {
+            CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, impl->plan_out[out].q_data));
+          }
         }
         CeedCallBackend(CeedVectorDestroy(&vec));
       }
@@ -740,65 +1297,818 @@ static int CeedOperatorLinearAssembleQFunctionUpdate_Opt(CeedOperator op, CeedVe
 }
 
 //------------------------------------------------------------------------------
-// Operator Destroy
+// Setup AtPoints Input/Output Fields
 //------------------------------------------------------------------------------
-static int CeedOperatorDestroy_Opt(CeedOperator op) {
+static int CeedOperatorSetupFieldsAtPoints_Opt(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, bool *apply_add_basis,
+                                               CeedOperatorFieldPlan_Opt *plans, CeedVector *e_vecs, CeedVector *q_vecs, CeedInt num_fields,
+                                               CeedInt max_num_points, CeedInt block_size) {
+  Ceed                ceed;
+  CeedSize            q_size;
+  CeedInt             block_q = block_size * max_num_points;
+  CeedQFunctionField *qf_fields;
+  CeedOperatorField  *op_fields;
+
+  {
+    Ceed ceed_parent;
+
+    CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+    CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
+    CeedCallBackend(CeedReferenceCopy(ceed_parent, &ceed));
+    CeedCallBackend(CeedDestroy(&ceed_parent));
+  }
+  if (is_input) {
+    CeedCallBackend(CeedOperatorGetFields(op, NULL, &op_fields, NULL, NULL));
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_fields, NULL, NULL));
+  } else {
+    CeedCallBackend(CeedOperatorGetFields(op, NULL, NULL, NULL, &op_fields));
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, NULL, NULL, &qf_fields));
+  }
+
+  // Loop over fields
+  for (CeedInt i = 0; i < num_fields; i++) {
+    CeedOperatorFieldPlan_Opt *plan = &plans[i];
+
+    CeedCallBackend(CeedOperatorSetupFieldPlan_Opt(qf_fields[i], op_fields[i], max_num_points, plan));
+    q_size = (CeedSize)block_q * plan->size;
+    switch (plan->eval_mode) {
+      case CEED_EVAL_NONE:
+        CeedCheck(plan->is_at_points, ceed, CEED_ERROR_BACKEND, "Opt backend requires restrictions at points for AtPoints fields without basis action");
+        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
+        break;
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        CeedCallBackend(CeedVectorCreate(ceed, (CeedSize)block_size * plan->e_stride, &e_vecs[i]));
+        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
+        break;
+      case CEED_EVAL_WEIGHT: {  // Only on input fields
+        CeedBasis basis;
+
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
+        CeedCallBackend(
+            CeedBasisApplyAtPoints(basis, 1, &block_q, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, CEED_VECTOR_NONE, q_vecs[i]));
+        CeedCallBackend(CeedBasisDestroy(&basis));
+      } break;
+    }
+    // Initialize E-vec and Q-vec arrays
+    if (e_vecs[i]) CeedCallBackend(CeedVectorSetValue(e_vecs[i], 0.0));
+    if (plan->eval_mode != CEED_EVAL_WEIGHT) CeedCallBackend(CeedVectorSetValue(q_vecs[i], 0.0));
+  }
+  // Drop duplicate restrictions of fields with basis action
+  if (is_input) {
+    for (CeedInt i = 0; i < num_fields; i++) {
+      for (CeedInt j = i + 1; j < num_fields; j++) {
+        if (e_vecs[i] && e_vecs[j] && plans[i].rstr == plans[j].rstr && plans[i].is_active == plans[j].is_active) {
+          CeedVector vec_i, vec_j;
+
+          CeedCallBackend(CeedOperatorFieldGetVector(op_fields[i], &vec_i));
+          CeedCallBackend(CeedOperatorFieldGetVector(op_fields[j], &vec_j));
+          if (vec_i == vec_j) {
+            CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
+            skip_rstr[j] = true;
+          }
+          CeedCallBackend(CeedVectorDestroy(&vec_i));
+          CeedCallBackend(CeedVectorDestroy(&vec_j));
+        }
+      }
+    }
+  } else {
+    for (CeedInt i = num_fields - 1; i >= 0; i--) {
+      for (CeedInt j = i - 1; j >= 0; j--) {
+        if (e_vecs[i] && e_vecs[j] && plans[i].rstr == plans[j].rstr && plans[i].is_active == plans[j].is_active) {
+          CeedVector vec_i, vec_j;
+
+          CeedCallBackend(CeedOperatorFieldGetVector(op_fields[i], &vec_i));
+          CeedCallBackend(CeedOperatorFieldGetVector(op_fields[j], &vec_j));
+          if (vec_i == vec_j) {
+            CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
+            skip_rstr[j]       = true;
+            apply_add_basis[i] = true;
+          }
+          CeedCallBackend(CeedVectorDestroy(&vec_i));
+          CeedCallBackend(CeedVectorDestroy(&vec_j));
+        }
+      }
+    }
+  }
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Group AtPoints Elements into Blocks
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupBlocksAtPoints_Opt(CeedOperator op) {
+  CeedInt             num_elem, max_num_points, num_blocks, *elem_start;
+  CeedSize            num_elem_at_points = 0;
+  CeedElemRestriction rstr_points        = NULL;
+  CeedOperator_Opt   *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, NULL));
+  CeedCallBackend(CeedElemRestrictionGetMaxPointsInElement(rstr_points, &max_num_points));
+  CeedCallBackend(CeedFree(&impl->points_offsets));
+  CeedCallBackend(CeedFree(&impl->block_elems));
+  CeedCallBackend(CeedFree(&impl->block_num_points));
+  CeedCallBackend(CeedFree(&impl->block_points_offsets));
+
+  CeedCallBackend(CeedCalloc(num_elem + 1, &impl->points_offsets));
+  for (CeedInt e = 0; e < num_elem; e++) {
+    CeedInt num_points;
+
+    CeedCallBackend(CeedElemRestrictionGetNumPointsInElement(rstr_points, e, &num_points));
+    impl->points_offsets[e + 1] = impl->points_offsets[e] + num_points;
+  }
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_points));
+
+  // Counting sort by decreasing number of points, dropping elements without points
+  CeedCallBackend(CeedCalloc(max_num_points + 1, &elem_start));
+  for (CeedInt e = 0; e < num_elem; e++) elem_start[impl->points_offsets[e + 1] - impl->points_offsets[e]]++;
+  for (CeedInt n = max_num_points; n > 0; n--) {
+    const CeedInt count = elem_start[n];
+
+    elem_start[n] = num_elem_at_points;
+    num_elem_at_points += count;
+  }
+  impl->num_elem_at_points = num_elem_at_points;
+  CeedCallBackend(CeedCalloc(num_elem_at_points, &impl->block_elems));
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt num_points = impl->points_offsets[e + 1] - impl->points_offsets[e];
+
+    if (num_points > 0) impl->block_elems[elem_start[num_points]++] = e;
+  }
+  CeedCallBackend(CeedFree(&elem_start));
+
+  // Each block is padded to the number of points in its first element
+  num_blocks = (num_elem_at_points / impl->block_size) + !!(num_elem_at_points % impl->block_size);
+  CeedCallBackend(CeedCalloc(num_blocks, &impl->block_num_points));
+  CeedCallBackend(CeedCalloc(num_blocks + 1, &impl->block_points_offsets));
+  for (CeedInt b = 0; b < num_blocks; b++) {
+    const CeedInt e = impl->block_elems[b * impl->block_size];
+
+    impl->block_num_points[b]         = impl->points_offsets[e + 1] - impl->points_offsets[e];
+    impl->block_points_offsets[b + 1] = impl->block_points_offsets[b] + impl->block_size * impl->block_num_points[b];
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup AtPoints Element Block Restrictions
+//   Nodal restrictions are permuted so each block of elements with similar numbers of points is one block of the restriction
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupBlockRestrictionsAtPoints_Opt(CeedOperator op) {
+  Ceed              ceed;
+  CeedInt           num_blocks;
   CeedOperator_Opt *impl;
 
   CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  const CeedInt block_size = impl->block_size;
+
+  num_blocks = (impl->num_elem_at_points / block_size) + !!(impl->num_elem_at_points % block_size);
   for (CeedInt i = 0; i < impl->num_inputs + impl->num_outputs; i++) {
+    const bool                       is_input  = i < impl->num_inputs;
+    const bool                       skip_rstr = is_input ? impl->skip_rstr_in[i] : impl->skip_rstr_out[i - impl->num_inputs];
+    const CeedOperatorFieldPlan_Opt *plan      = is_input ? &impl->plan_in[i] : &impl->plan_out[i - impl->num_inputs];
+
     CeedCallBackend(CeedElemRestrictionDestroy(&impl->block_rstr[i]));
     CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
+    if (!plan->rstr || skip_rstr || num_blocks == 0) continue;
+
+    // Blocked restriction with elements in block order
+    if (!plan->is_at_points) {
+      bool                use_compressed;
+      Ceed                ceed_rstr;
+      CeedSize            l_size;
+      CeedInt             elem_size, num_comp, comp_stride, *offsets_block;
+      CeedRestrictionType rstr_type;
+
+      CeedCallBackend(CeedElemRestrictionGetCeed(plan->rstr, &ceed_rstr));
+      CeedCallBackend(CeedElemRestrictionGetType(plan->rstr, &rstr_type));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(plan->rstr, &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(plan->rstr, &num_comp));
+      CeedCallBackend(CeedElemRestrictionGetLVectorSize(plan->rstr, &l_size));
+      CeedCallBackend(CeedMalloc((CeedSize)impl->num_elem_at_points * elem_size, &offsets_block));
+      switch (rstr_type) {
+        case CEED_RESTRICTION_STANDARD:
+        case CEED_RESTRICTION_STRUCTURED: {
+          const CeedInt *offsets;
+
+          CeedCallBackend(CeedElemRestrictionGetCompStride(plan->rstr, &comp_stride));
+          CeedCallBackend(CeedElemRestrictionGetOffsets(plan->rstr, CEED_MEM_HOST, &offsets));
+          for (CeedInt k = 0; k < impl->num_elem_at_points; k++) {
+            const CeedInt e = impl->block_elems[k];
+
+            for (CeedInt n = 0; n < elem_size; n++) offsets_block[k * elem_size + n] = offsets[e * elem_size + n];
+          }
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets(plan->rstr, &offsets));
+        } break;
+        case CEED_RESTRICTION_STRIDED: {
+          bool    has_backend_strides;
+          CeedInt strides[3] = {1, elem_size, elem_size * num_comp};
+
+          CeedCallBackend(CeedElemRestrictionHasBackendStrides(plan->rstr, &has_backend_strides));
+          if (!has_backend_strides) CeedCallBackend(CeedElemRestrictionGetStrides(plan->rstr, strides));
+          comp_stride = strides[1];
+          for (CeedInt k = 0; k < impl->num_elem_at_points; k++) {
+            const CeedInt e = impl->block_elems[k];
+
+            for (CeedInt n = 0; n < elem_size; n++) offsets_block[k * elem_size + n] = n * strides[0] + e * strides[2];
+          }
+        } break;
+        // LCOV_EXCL_START
+        case CEED_RESTRICTION_ORIENTED:
+        case CEED_RESTRICTION_CURL_ORIENTED:
+        case CEED_RESTRICTION_POINTS:
+          CeedCallBackend(CeedFree(&offsets_block));
+          CeedCallBackend(CeedDestroy(&ceed_rstr));
+          return CeedError(ceed, CEED_ERROR_BACKEND, "Opt backend does not support oriented restrictions for AtPoints fields with basis action");
+          // LCOV_EXCL_STOP
+      }
+      CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed_rstr, impl->num_elem_at_points, elem_size, block_size, num_comp, comp_stride, l_size,
+                                                       CEED_MEM_HOST, CEED_COPY_VALUES, offsets_block, &impl->block_rstr[i]));
+      CeedCallBackend(CeedElemRestrictionGetUseCompressedOffsets(plan->rstr, &use_compressed));
+      CeedCallBackend(CeedElemRestrictionSetUseCompressedOffsets(impl->block_rstr[i], use_compressed));
+      CeedCallBackend(CeedFree(&offsets_block));
+      CeedCallBackend(CeedDestroy(&ceed_rstr));
+    }
+
+    // Passive inputs keep full blocked E-vectors, restricted when their state changes
+    if (is_input && !plan->is_active) {
+      if (plan->is_at_points) {
+        Ceed ceed_parent;
+
+        CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
+        CeedCallBackend(CeedVectorCreate(ceed_parent, (CeedSize)impl->block_points_offsets[num_blocks] * plan->size, &impl->e_vecs_full[i]));
+        CeedCallBackend(CeedDestroy(&ceed_parent));
+      } else {
+        CeedCallBackend(CeedElemRestrictionCreateVector(impl->block_rstr[i], NULL, &impl->e_vecs_full[i]));
+      }
+    }
   }
-  CeedCallBackend(CeedFree(&impl->block_rstr));
-  CeedCallBackend(CeedFree(&impl->e_vecs_full));
-  CeedCallBackend(CeedFree(&impl->input_states));
-  CeedCallBackend(CeedFree(&impl->skip_rstr_in));
-  CeedCallBackend(CeedFree(&impl->skip_rstr_out));
-  CeedCallBackend(CeedFree(&impl->apply_add_basis_out));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
 
-  for (CeedInt i = 0; i < impl->num_inputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i]));
+//------------------------------------------------------------------------------
+// Update AtPoints Setup for Moved Points
+//------------------------------------------------------------------------------
+static int CeedOperatorUpdatePointsAtPoints_Opt(CeedOperator op, uint64_t points_state, bool *is_updated) {
+  CeedInt             max_num_points;
+  CeedElemRestriction rstr_points = NULL;
+  CeedOperator_Opt   *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, NULL));
+  CeedCallBackend(CeedElemRestrictionGetMaxPointsInElement(rstr_points, &max_num_points));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_points));
+
+  // Rebuild with headroom when block vectors are too short
+  *is_updated = max_num_points <= impl->max_num_points;
+  if (!*is_updated) {
+    CeedCallBackend(CeedOperatorSetupFree_Opt(op));
+    impl->max_num_points = 2 * max_num_points;
+    return CEED_ERROR_SUCCESS;
   }
-  CeedCallBackend(CeedFree(&impl->e_vecs_in));
-  CeedCallBackend(CeedFree(&impl->q_vecs_in));
 
-  for (CeedInt i = 0; i < impl->num_outputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i]));
+  // Regroup elements into blocks and permute restrictions to match
+  CeedCallBackend(CeedOperatorSetupBlocksAtPoints_Opt(op));
+  CeedCallBackend(CeedOperatorSetupBlockRestrictionsAtPoints_Opt(op));
+
+  // Passive inputs must be restricted again
+  for (CeedInt i = 0; i < impl->num_inputs; i++) impl->input_states[i] = (uint64_t)-1;
+  impl->points_state = points_state;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup AtPoints Operator
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupAtPoints_Opt(CeedOperator op) {
+  bool                is_setup_done;
+  uint64_t            points_state;
+  Ceed                ceed;
+  Ceed_Opt           *ceed_impl;
+  CeedInt             block_size, max_num_points, dim, num_input_fields, num_output_fields;
+  CeedElemRestriction rstr_points = NULL;
+  CeedQFunction       qf;
+  CeedOperator_Opt   *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, NULL));
+  CeedCallBackend(CeedElemRestrictionGetAtPointsState(rstr_points, &points_state));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_points));
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (is_setup_done) {
+    bool is_updated;
+
+    if (points_state == impl->points_state) return CEED_ERROR_SUCCESS;
+    CeedCallBackend(CeedOperatorUpdatePointsAtPoints_Opt(op, points_state, &is_updated));
+    if (is_updated) return CEED_ERROR_SUCCESS;
   }
-  CeedCallBackend(CeedFree(&impl->e_vecs_out));
-  CeedCallBackend(CeedFree(&impl->q_vecs_out));
+  impl->points_state = points_state;
 
-  // QFunction assembly data
-  CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
-  CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_block_rstr));
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+
+  // Operator block size overrides Ceed default; blocks of elements at points are not autotuned
+  CeedCallBackend(CeedOperatorGetBlockSize(op, &block_size));
+  if (block_size == 0) block_size = ceed_impl->block_size;
+  if (block_size == CEED_BLOCK_SIZE_AUTO) block_size = 8;
+  CeedCheck(block_size > 0, ceed, CEED_ERROR_BACKEND, "Opt backend cannot use block size: %" CeedInt_FMT, block_size);
+  CeedCallBackend(CeedDestroy(&ceed));
+  impl->block_size = block_size;
+
+  // Group elements into blocks with similar numbers of points
+  CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, NULL));
+  CeedCallBackend(CeedElemRestrictionGetMaxPointsInElement(rstr_points, &max_num_points));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr_points, &dim));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_points));
+  CeedCallBackend(CeedOperatorSetupBlocksAtPoints_Opt(op));
+  // -- Keep any extra capacity requested for moving points
+  max_num_points       = CeedIntMax(max_num_points, impl->max_num_points);
+  impl->max_num_points = max_num_points;
 
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionIsIdentity(qf, &impl->is_identity_qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, NULL, &num_output_fields, NULL));
+
+  // Allocate
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->block_rstr));
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_full));
+
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->apply_add_basis_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->input_states));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->plan_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->plan_out));
+  CeedCallBackend(CeedCalloc(block_size, &impl->lane_num_points_in));
+  CeedCallBackend(CeedCalloc(block_size, &impl->lane_num_points_out));
+
+  impl->num_inputs  = num_input_fields;
+  impl->num_outputs = num_output_fields;
+
+  // Point coordinates for an element block
+  {
+    Ceed ceed_parent;
+
+    CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+    CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
+    CeedCallBackend(CeedVectorCreate(ceed_parent, (CeedSize)dim * block_size * max_num_points, &impl->point_coords_block));
+    CeedCallBackend(CeedVectorSetValue(impl->point_coords_block, 0.0));
+    CeedCallBackend(CeedDestroy(&ceed_parent));
+    CeedCallBackend(CeedDestroy(&ceed));
+  }
+
+  // Set up infield and outfield pointer arrays
+  // Infields
+  CeedCallBackend(CeedOperatorSetupFieldsAtPoints_Opt(qf, op, true, impl->skip_rstr_in, NULL, impl->plan_in, impl->e_vecs_in, impl->q_vecs_in,
+                                                      num_input_fields, max_num_points, block_size));
+  // Outfields
+  CeedCallBackend(CeedOperatorSetupFieldsAtPoints_Opt(qf, op, false, impl->skip_rstr_out, impl->apply_add_basis_out, impl->plan_out,
+                                                      impl->e_vecs_out, impl->q_vecs_out, num_output_fields, max_num_points, block_size));
+
+  // Identity QFunctions
+  if (impl->is_identity_qf) CeedCallBackend(CeedVectorReferenceCopy(impl->q_vecs_in[0], &impl->q_vecs_out[0]));
+
+  // Element block restrictions
+  CeedCallBackend(CeedOperatorSetupBlockRestrictionsAtPoints_Opt(op));
+
+  CeedCallBackend(CeedOperatorSetSetupDone(op));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Gather and Scatter Values at Points for One Element Block
+//   Block data is ordered [component][point][lane], as for CeedBasisApplyAtPoints with element blocks;
+//   gathered padding repeats the last point of the lane, and padded lanes repeat the last element of the block
+//------------------------------------------------------------------------------
+static inline void CeedOperatorGatherBlockAtPoints_Opt(CeedInt b, CeedInt num_comp, const CeedInt *offsets, const CeedScalar *l_array,
+                                                       const CeedOperator_Opt *impl, CeedScalar *block_data) {
+  const CeedInt block_size = impl->block_size, block_num_points = impl->block_num_points[b];
+  const CeedInt num_elem_block = CeedIntMin(block_size, impl->num_elem_at_points - b * block_size);
+
+  for (CeedInt k = 0; k < block_size; k++) {
+    const CeedInt  e = impl->block_elems[b * block_size + CeedIntMin(k, num_elem_block - 1)];
+    const CeedInt  num_points = impl->points_offsets[e + 1] - impl->points_offsets[e];
+    const CeedInt *points     = &offsets[offsets[e]];
+
+    for (CeedInt p = 0; p < block_num_points; p++) {
+      const CeedSize l_offset = (CeedSize)points[CeedIntMin(p, num_points - 1)] * num_comp;
+
+      for (CeedInt j = 0; j < num_comp; j++) block_data[((CeedSize)j * block_num_points + p) * block_size + k] = l_array[l_offset + j];
+    }
+  }
+}
+
+static inline void CeedOperatorScatterBlockAtPoints_Opt(CeedInt b, CeedInt num_comp, const CeedInt *offsets, const CeedScalar *block_data,
+                                                        const CeedOperator_Opt *impl, CeedScalar *l_array) {
+  const CeedInt block_size = impl->block_size, block_num_points = impl->block_num_points[b];
+  const CeedInt num_elem_block = CeedIntMin(block_size, impl->num_elem_at_points - b * block_size);
+
+  for (CeedInt k = 0; k < num_elem_block; k++) {
+    const CeedInt  e = impl->block_elems[b * block_size + k];
+    const CeedInt  num_points = impl->points_offsets[e + 1] - impl->points_offsets[e];
+    const CeedInt *points     = &offsets[offsets[e]];
+
+    for (CeedInt p = 0; p < num_points; p++) {
+      const CeedSize l_offset = (CeedSize)points[p] * num_comp;
+
+      for (CeedInt j = 0; j < num_comp; j++) l_array[l_offset + j] += block_data[((CeedSize)j * block_num_points + p) * block_size + k];
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Setup AtPoints Input Fields
+//------------------------------------------------------------------------------
+static inline int CeedOperatorSetupInputsAtPoints_Opt(CeedInt num_input_fields, CeedOperatorField *op_input_fields,
+                                                      CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl, CeedRequest *request) {
+  const CeedInt block_size = impl->block_size;
+  const CeedInt num_blocks = (impl->num_elem_at_points / block_size) + !!(impl->num_elem_at_points % block_size);
+
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    const CeedOperatorFieldPlan_Opt *plan = &impl->plan_in[i];
+    uint64_t                         state;
+    CeedVector                       vec;
+
+    if (plan->eval_mode == CEED_EVAL_WEIGHT || plan->is_active || !impl->e_vecs_full[i]) continue;
+
+    // Restrict passive inputs into element block order when their state changes
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    CeedCallBackend(CeedVectorGetState(vec, &state));
+    if (state != impl->input_states[i]) {
+      if (plan->is_at_points) {
+        const CeedInt    *offsets;
+        const CeedScalar *l_array;
+        CeedScalar       *e_array;
+
+        CeedCallBackend(CeedElemRestrictionGetOffsets(plan->rstr, CEED_MEM_HOST, &offsets));
+        CeedCallBackend(CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &l_array));
+        CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_full[i], CEED_MEM_HOST, &e_array));
+        for (CeedInt b = 0; b < num_blocks; b++) {
+          CeedOperatorGatherBlockAtPoints_Opt(b, plan->size, offsets, l_array, impl, &e_array[(CeedSize)impl->block_points_offsets[b] * plan->size]);
+        }
+        CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i], &e_array));
+        CeedCallBackend(CeedVectorRestoreArrayRead(vec, &l_array));
+        CeedCallBackend(CeedElemRestrictionRestoreOffsets(plan->rstr, &offsets));
+      } else {
+        CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+      }
+    }
+    impl->input_states[i] = state;
+    CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// AtPoints Input Restriction and Basis Action for One Element Block
+//------------------------------------------------------------------------------
+static inline int CeedOperatorInputBasisAtPoints_Opt(CeedInt b, CeedInt num_input_fields, CeedVector in_vec, CeedScalar *e_data[2 * CEED_FIELD_MAX],
+                                                     CeedOperator_Opt *impl, CeedRequest *request) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    const CeedOperatorFieldPlan_Opt *plan = &impl->plan_in[i];
+
+    switch (plan->eval_mode) {
+      case CEED_EVAL_NONE:
+        if (plan->is_active) {
+          const CeedInt    *offsets;
+          const CeedScalar *l_array;
+          CeedScalar       *q_array;
+
+          CeedCallBackend(CeedElemRestrictionGetOffsets(plan->rstr, CEED_MEM_HOST, &offsets));
+          CeedCallBackend(CeedVectorGetArrayRead(in_vec, CEED_MEM_HOST, &l_array));
+          CeedCallBackend(CeedVectorGetArrayWrite(impl->q_vecs_in[i], CEED_MEM_HOST, &q_array));
+          CeedOperatorGatherBlockAtPoints_Opt(b, plan->size, offsets, l_array, impl, q_array);
+          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &q_array));
+          CeedCallBackend(CeedVectorRestoreArrayRead(in_vec, &l_array));
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets(plan->rstr, &offsets));
+        } else {
+          CeedScalar *q_data = &e_data[i][(CeedSize)impl->block_points_offsets[b] * plan->size];
+
+          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, q_data));
+        }
+        break;
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        if (!impl->skip_rstr_in[i]) {
+          if (plan->is_active) {
+            CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i], b, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[i], request));
+          } else {
+            CeedScalar *block_data = &e_data[i][(CeedSize)b * impl->block_size * plan->e_stride];
+
+            CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, block_data));
+          }
+        }
+        CeedCallBackend(CeedBasisApplyAtPoints(plan->basis, impl->block_size, impl->lane_num_points_in, CEED_NOTRANSPOSE, plan->eval_mode,
+                                               impl->point_coords_block, impl->e_vecs_in[i], impl->q_vecs_in[i]));
+        break;
+      case CEED_EVAL_WEIGHT:
+        break;  // No action
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// AtPoints Output Basis Action and Restriction for One Element Block
+//------------------------------------------------------------------------------
+static inline int CeedOperatorOutputBasisAtPoints_Opt(CeedInt b, CeedOperatorField *op_output_fields, CeedInt num_output_fields, CeedOperator op,
+                                                      CeedVector out_vec, CeedOperator_Opt *impl, CeedRequest *request) {
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    const CeedOperatorFieldPlan_Opt *plan = &impl->plan_out[i];
+    CeedVector                       vec;
+
+    // Basis action
+    switch (plan->eval_mode) {
+      case CEED_EVAL_NONE:
+        break;  // No action
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        if (impl->apply_add_basis_out[i]) {
+          CeedCallBackend(CeedBasisApplyAddAtPoints(plan->basis, impl->block_size, impl->lane_num_points_out, CEED_TRANSPOSE, plan->eval_mode,
+                                                    impl->point_coords_block, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+        } else {
+          CeedCallBackend(CeedBasisApplyAtPoints(plan->basis, impl->block_size, impl->lane_num_points_out, CEED_TRANSPOSE, plan->eval_mode,
+                                                 impl->point_coords_block, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+        }
+        break;
+      // LCOV_EXCL_START
+      case CEED_EVAL_WEIGHT: {
+        return CeedError(CeedOperatorReturnCeed(op), CEED_ERROR_BACKEND, "CEED_EVAL_WEIGHT cannot be an output evaluation mode");
+        // LCOV_EXCL_STOP
+      }
+    }
+    // Restrict output block
+    if (impl->skip_rstr_out[i]) continue;
+    // Get output vector
+    if (plan->is_active) {
+      vec = out_vec;
+    } else {
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    }
+    // Restrict
+    if (plan->is_at_points) {
+      const CeedInt    *offsets;
+      const CeedScalar *q_array;
+      CeedScalar       *l_array;
+
+      CeedCallBackend(CeedElemRestrictionGetOffsets(plan->rstr, CEED_MEM_HOST, &offsets));
+      CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_out[i], CEED_MEM_HOST, &q_array));
+      CeedCallBackend(CeedVectorGetArray(vec, CEED_MEM_HOST, &l_array));
+      CeedOperatorScatterBlockAtPoints_Opt(b, plan->size, offsets, q_array, impl, l_array);
+      CeedCallBackend(CeedVectorRestoreArray(vec, &l_array));
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_out[i], &q_array));
+      CeedCallBackend(CeedElemRestrictionRestoreOffsets(plan->rstr, &offsets));
+    } else {
+      CeedCallBackend(
+          CeedElemRestrictionApplyBlock(impl->block_rstr[i + impl->num_inputs], b, CEED_TRANSPOSE, impl->e_vecs_out[i], vec, request));
+    }
+    if (!plan->is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// AtPoints Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddAtPoints_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  CeedInt             num_input_fields, num_output_fields, num_blocks, dim;
+  CeedScalar         *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedVector          point_coords               = NULL;
+  CeedElemRestriction rstr_points                = NULL;
+  CeedQFunctionField *qf_input_fields;
+  CeedQFunction       qf;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedOperator_Opt   *impl;
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetupAtPoints_Opt(op));
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  const CeedInt block_size = impl->block_size;
+
+  num_blocks = (impl->num_elem_at_points / block_size) + !!(impl->num_elem_at_points % block_size);
+  if (num_blocks == 0) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, NULL));
+
+  // Point coordinates
+  CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, &point_coords));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr_points, &dim));
+
+  // Input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputsAtPoints_Opt(num_input_fields, op_input_fields, e_data, impl, request));
+
+  // Loop through blocks of elements, each padded to the largest number of points in the block
+  for (CeedInt b = 0; b < num_blocks; b++) {
+    const CeedInt num_elem_block = CeedIntMin(block_size, impl->num_elem_at_points - b * block_size);
+    const CeedInt block_num_points = impl->block_num_points[b];
+
+    // Points in each lane of the block, padded lanes contribute no points to outputs
+    for (CeedInt k = 0; k < block_size; k++) {
+      const CeedInt e = impl->block_elems[b * block_size + CeedIntMin(k, num_elem_block - 1)];
+
+      impl->lane_num_points_in[k]  = block_num_points;
+      impl->lane_num_points_out[k] = k < num_elem_block ? impl->points_offsets[e + 1] - impl->points_offsets[e] : 0;
+    }
+    {
+      const CeedInt    *offsets;
+      const CeedScalar *coords_array;
+      CeedScalar       *coords_block;
+
+      CeedCallBackend(CeedElemRestrictionGetOffsets(rstr_points, CEED_MEM_HOST, &offsets));
+      CeedCallBackend(CeedVectorGetArrayRead(point_coords, CEED_MEM_HOST, &coords_array));
+      CeedCallBackend(CeedVectorGetArrayWrite(impl->point_coords_block, CEED_MEM_HOST, &coords_block));
+      CeedOperatorGatherBlockAtPoints_Opt(b, dim, offsets, coords_array, impl, coords_block);
+      CeedCallBackend(CeedVectorRestoreArray(impl->point_coords_block, &coords_block));
+      CeedCallBackend(CeedVectorRestoreArrayRead(point_coords, &coords_array));
+      CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr_points, &offsets));
+    }
+
+    // Input basis apply
+    CeedCallBackend(CeedOperatorInputBasisAtPoints_Opt(b, num_input_fields, in_vec, e_data, impl, request));
+
+    // Q function
+    if (!impl->is_identity_qf) {
+      CeedCallBackend(CeedQFunctionApply(qf, block_size * block_num_points, impl->q_vecs_in, impl->q_vecs_out));
+    }
+
+    // Output basis apply and restriction
+    CeedCallBackend(CeedOperatorOutputBasisAtPoints_Opt(b, op_output_fields, num_output_fields, op, out_vec, impl, request));
+  }
+
+  // Restore input arrays
+  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, e_data, impl));
+
+  // Cleanup point coordinates
+  CeedCallBackend(CeedVectorDestroy(&point_coords));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_points));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get Reference AtPoints Operator for Assembly
+//------------------------------------------------------------------------------
+static int CeedOperatorGetAssemblyOperatorAtPoints_Opt(CeedOperator op, CeedOperator *op_assemble) {
+  CeedOperator_Opt *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  if (!impl->op_assemble_at_points) {
+    Ceed                ceed, ceed_ref;
+    CeedInt             num_input_fields, num_output_fields;
+    CeedVector          point_coords;
+    CeedElemRestriction rstr_points;
+    CeedQFunction       qf;
+    CeedOperatorField  *op_input_fields, *op_output_fields;
+
+    CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+    CeedCallBackend(CeedGetDelegate(ceed, &ceed_ref));
+    CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+    CeedCallBackend(CeedOperatorCreateAtPoints(ceed_ref, qf, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &impl->op_assemble_at_points));
+    CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+    for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+      const char         *field_name;
+      CeedVector          vec;
+      CeedElemRestriction rstr;
+      CeedBasis           basis;
+
+      CeedCallBackend(CeedOperatorFieldGetData(i < num_input_fields ? op_input_fields[i] : op_output_fields[i - num_input_fields], &field_name, &rstr,
+                                               &basis, &vec));
+      CeedCallBackend(CeedOperatorSetField(impl->op_assemble_at_points, field_name, rstr, basis, vec));
+      CeedCallBackend(CeedVectorDestroy(&vec));
+      CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+      CeedCallBackend(CeedBasisDestroy(&basis));
+    }
+    CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, &point_coords));
+    CeedCallBackend(CeedOperatorAtPointsSetPoints(impl->op_assemble_at_points, rstr_points, point_coords));
+    CeedCallBackend(CeedVectorDestroy(&point_coords));
+    CeedCallBackend(CeedElemRestrictionDestroy(&rstr_points));
+    CeedCallBackend(CeedQFunctionDestroy(&qf));
+    CeedCallBackend(CeedDestroy(&ceed_ref));
+    CeedCallBackend(CeedDestroy(&ceed));
+  }
+  *op_assemble = impl->op_assemble_at_points;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction AtPoints
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionAtPoints_Opt(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  CeedOperator op_assemble;
+
+  CeedCallBackend(CeedOperatorGetAssemblyOperatorAtPoints_Opt(op, &op_assemble));
+  CeedCallBackend(CeedOperatorLinearAssembleQFunction(op_assemble, assembled, rstr, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Update Assembled Linear QFunction AtPoints
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionAtPointsUpdate_Opt(CeedOperator op, CeedVector assembled, CeedElemRestriction rstr,
+                                                                 CeedRequest *request) {
+  CeedVector          assembled_update = NULL;
+  CeedElemRestriction rstr_update      = NULL;
+  CeedOperator        op_assemble;
+
+  CeedCallBackend(CeedOperatorGetAssemblyOperatorAtPoints_Opt(op, &op_assemble));
+  CeedCallBackend(CeedOperatorLinearAssembleQFunction(op_assemble, &assembled_update, &rstr_update, request));
+  CeedCallBackend(CeedVectorCopy(assembled_update, assembled));
+  CeedCallBackend(CeedVectorDestroy(&assembled_update));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_update));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Diagonal AtPoints
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleAddDiagonalAtPoints_Opt(CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  CeedOperator op_assemble;
+
+  CeedCallBackend(CeedOperatorGetAssemblyOperatorAtPoints_Opt(op, &op_assemble));
+  CeedCallBackend(CeedOperatorLinearAssembleAddDiagonal(op_assemble, assembled, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Opt(CeedOperator op) {
+  CeedOperator_Opt *impl;
+
+  CeedCallBackend(CeedOperatorSetupFree_Opt(op));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Set Active Elements
+//   Element blocks are only known after setup, which also finds the active blocks
+//------------------------------------------------------------------------------
+static int CeedOperatorSetActiveElements_Opt(CeedOperator op) {
+  bool is_setup_done;
+
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (is_setup_done) CeedCallBackend(CeedOperatorSetupActiveBlocks_Opt(op));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Create
 //------------------------------------------------------------------------------
 int CeedOperatorCreate_Opt(CeedOperator op) {
   Ceed              ceed;
-  Ceed_Opt         *ceed_impl;
   CeedOperator_Opt *impl;
 
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
-  const CeedInt block_size = ceed_impl->block_size;
-
   CeedCallBackend(CeedCalloc(1, &impl));
   CeedCallBackend(CeedOperatorSetData(op, impl));
 
-  CeedCheck(block_size == 1 || block_size == 8, ceed, CEED_ERROR_BACKEND, "Opt backend cannot use blocksize: %" CeedInt_FMT, block_size);
-
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddMultiple", CeedOperatorApplyAddMultiple_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "SetActiveElements", CeedOperatorSetActiveElements_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Opt));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Create AtPoints
+//------------------------------------------------------------------------------
+int CeedOperatorCreateAtPoints_Opt(CeedOperator op) {
+  Ceed              ceed;
+  CeedOperator_Opt *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunctionAtPoints_Opt));
+  CeedCallBackend(
+      CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionAtPointsUpdate_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal", CeedOperatorLinearAssembleAddDiagonalAtPoints_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAddAtPoints_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Opt));
   CeedCallBackend(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
@@ -48,11 +48,97 @@ static int CeedTensorContractApply_Opt(CeedTensorContract contract, CeedInt A, C
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Even-Odd Core loop
+//------------------------------------------------------------------------------
+static inline int CeedTensorContractApplyEvenOdd_Core_Opt(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                                          const CeedScalar *restrict t_even_odd, CeedInt parity, CeedTransposeMode t_mode,
+                                                          const CeedScalar *restrict u, CeedScalar *restrict v) {
+  if (t_mode == CEED_NOTRANSPOSE) {
+    // Fold pairs of inputs, then unfold the even and odd products into pairs of outputs
+    const CeedInt half_B = (B + 1) / 2;
+
+    for (CeedInt a = 0; a < A; a++) {
+      for (CeedInt j = 0; j < (J + 1) / 2; j++) {
+        const CeedInt j_flip = 2 * j + 1 == J ? -1 : J - 1 - j;
+
+        for (CeedInt b = 0; b < B / 2; b++) {
+          const CeedScalar t_even = t_even_odd[j * B + b], t_odd = t_even_odd[j * B + half_B + b];
+
+          for (CeedInt c = 0; c < C; c++) {
+            const CeedScalar u_b = u[(a * B + b) * C + c], u_flip = u[(a * B + B - 1 - b) * C + c];
+            const CeedScalar even = t_even * (u_b + u_flip), odd = t_odd * (u_b - u_flip);
+
+            v[(a * J + j) * C + c] += even + odd;
+            if (j_flip >= 0) v[(a * J + j_flip) * C + c] += parity * (even - odd);
+          }
+        }
+        if (B % 2) {
+          const CeedScalar t_mid = t_even_odd[j * B + B / 2];
+
+          for (CeedInt c = 0; c < C; c++) {
+            const CeedScalar even = t_mid * u[(a * B + B / 2) * C + c];
+
+            v[(a * J + j) * C + c] += even;
+            if (j_flip >= 0) v[(a * J + j_flip) * C + c] += parity * even;
+          }
+        }
+      }
+    }
+  } else {
+    // Fold pairs of inputs with the parity, then unfold the even and odd products into pairs of outputs
+    const CeedInt half_J = (J + 1) / 2;
+
+    for (CeedInt a = 0; a < A; a++) {
+      for (CeedInt b = 0; b < (B + 1) / 2; b++) {
+        const CeedInt    b_flip = B - 1 - b;
+        const CeedScalar sign   = 2 * b + 1 == B ? 0.0 : parity;
+
+        for (CeedInt j = 0; j < J / 2; j++) {
+          const CeedScalar t_even = t_even_odd[b * J + j], t_odd = t_even_odd[b * J + half_J + j];
+
+          for (CeedInt c = 0; c < C; c++) {
+            const CeedScalar u_b = u[(a * B + b) * C + c], u_flip = sign * u[(a * B + b_flip) * C + c];
+            const CeedScalar even = t_even * (u_b + u_flip), odd = t_odd * (u_b - u_flip);
+
+            v[(a * J + j) * C + c] += even + odd;
+            v[(a * J + J - 1 - j) * C + c] += even - odd;
+          }
+        }
+        if (J % 2) {
+          const CeedScalar t_mid = t_even_odd[b * J + J / 2];
+
+          for (CeedInt c = 0; c < C; c++) v[(a * J + J / 2) * C + c] += t_mid * (u[(a * B + b) * C + c] + sign * u[(a * B + b_flip) * C + c]);
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply Even-Odd
+//------------------------------------------------------------------------------
+static int CeedTensorContractApplyEvenOdd_Opt(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                              const CeedScalar *restrict t_even_odd, CeedInt parity, CeedTransposeMode t_mode, const CeedInt add,
+                                              const CeedScalar *restrict u, CeedScalar *restrict v) {
+  if (!add) {
+    for (CeedInt q = 0; q < A * J * C; q++) v[q] = (CeedScalar)0.0;
+  }
+
+  if (C == 1) return CeedTensorContractApplyEvenOdd_Core_Opt(contract, A, B, 1, J, t_even_odd, parity, t_mode, u, v);
+  else return CeedTensorContractApplyEvenOdd_Core_Opt(contract, A, B, C, J, t_even_odd, parity, t_mode, u, v);
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Create
 //------------------------------------------------------------------------------
 int CeedTensorContractCreate_Opt(CeedTensorContract contract) {
-  CeedCallBackend(CeedSetBackendFunction(CeedTensorContractReturnCeed(contract), "TensorContract", contract, "Apply", CeedTensorContractApply_Opt));
+  Ceed ceed = CeedTensorContractReturnCeed(contract);
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply", CeedTensorContractApply_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "ApplyEvenOdd", CeedTensorContractApplyEvenOdd_Opt));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -12,7 +12,7 @@
 #include <stdint.h>
 
 typedef struct {
-  CeedInt block_size;
+  CeedInt block_size; /* Default element block size, or CEED_BLOCK_SIZE_AUTO */
 } Ceed_Opt;
 
 typedef struct {
@@ -20,21 +20,58 @@ typedef struct {
 } CeedBasis_Opt;
 
 typedef struct {
-  bool                 is_identity_qf, is_identity_rstr_op;
-  bool                *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
-  CeedElemRestriction *block_rstr;   /* Blocked versions of restrictions */
-  CeedVector          *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  uint64_t            *input_states; /* State counter of inputs */
-  CeedVector          *e_vecs_in;    /* Element block input E-vectors  */
-  CeedVector          *e_vecs_out;   /* Element block output E-vectors */
-  CeedVector          *q_vecs_in;    /* Element block input Q-vectors  */
-  CeedVector          *q_vecs_out;   /* Element block output Q-vectors */
-  CeedInt              num_inputs, num_outputs;
-  CeedInt              qf_size_in, qf_size_out;
-  CeedVector           qf_l_vec;
-  CeedElemRestriction  qf_block_rstr;
+  bool                is_active;
+  bool                is_at_points; /* Restriction at points, gathered directly into element block Q-vectors */
+  CeedEvalMode        eval_mode;
+  CeedInt             size;         /* QFunction field size */
+  CeedInt             e_stride;     /* Length of single element data in full E-vector */
+  CeedBasis           basis;        /* Borrowed from operator field, NULL without basis action */
+  CeedElemRestriction rstr;         /* Borrowed from operator field, NULL without restriction */
+  CeedScalar         *q_data;       /* Element block Q-vector data owned by operator, NULL if not needed */
+} CeedOperatorFieldPlan_Opt;
+
+typedef struct {
+  bool                       is_identity_qf, is_identity_rstr_op, is_block_size_tuning_needed;
+  bool                      *skip_rstr_in, *skip_rstr_out, *skip_basis_in, *apply_add_basis_out;
+  CeedInt                   *fused_basis_in_indices;
+  CeedElemRestriction       *block_rstr;         /* Blocked versions of restrictions */
+  CeedVector                *e_vecs_full;        /* Full E-vectors, inputs followed by outputs */
+  uint64_t                  *input_states;       /* State counter of inputs */
+  float                    **e_data_fp32;        /* Single precision passive input E-vectors, restricted without full E-vectors */
+  CeedScalar               **block_data;         /* Single element block of converted passive input data */
+  CeedScalar               **q_cache_in;         /* Cached quadrature point values of passive inputs, NULL if not cached */
+  bool                      *is_q_cache_valid;   /* Whether cached quadrature point values match input states */
+  CeedVector                *e_vecs_in;          /* Element block input E-vectors  */
+  CeedVector                *e_vecs_out;         /* Element block output E-vectors */
+  CeedVector                *q_vecs_in;          /* Element block input Q-vectors  */
+  CeedVector                *q_vecs_out;         /* Element block output Q-vectors */
+  CeedOperatorFieldPlan_Opt *plan_in, *plan_out; /* Per-field data precomputed during setup */
+  CeedQFunctionUser          qf_user;            /* User QFunction called on raw arrays, NULL to use CeedQFunctionApply */
+  const CeedScalar         **qf_inputs;          /* Input arrays for direct QFunction calls */
+  CeedScalar               **qf_outputs;         /* Output arrays for direct QFunction calls */
+  CeedInt                    block_size;         /* Number of elements interleaved per block */
+  CeedInt                    num_inputs, num_outputs;
+  CeedInt                    qf_size_in, qf_size_out;
+  CeedVector                 qf_l_vec;
+  CeedElemRestriction        qf_block_rstr;
+  CeedVector                 point_coords_block;    /* Element block point coordinates for AtPoints operators */
+  CeedInt                    num_elem_at_points;    /* Number of elements with at least one point */
+  CeedInt                   *block_elems;           /* Elements sorted by decreasing number of points, grouped into blocks */
+  CeedInt                   *block_num_points;      /* Padded number of points per element in each block */
+  CeedInt                   *block_points_offsets;  /* Offset of first padded point of each block in blocked AtPoints E-vectors */
+  CeedInt                   *lane_num_points_in;    /* Number of points evaluated in each lane of an element block */
+  CeedInt                   *lane_num_points_out;   /* Number of points contributing from each lane of an element block */
+  CeedInt                   *points_offsets;        /* Offset of first point of each element in AtPoints E-vectors */
+  CeedInt                    max_num_points;        /* Capacity of single element and block vectors for AtPoints operators */
+  uint64_t                   points_state;          /* State counter of points at last AtPoints setup */
+  CeedOperator               op_assemble_at_points; /* Reference AtPoints operator used for assembly */
+  CeedInt                    num_active_blocks;     /* Number of element blocks with active elements */
+  CeedInt                   *active_blocks;         /* Element blocks with active elements, NULL when all elements are active */
+  bool                      *is_active_lane;        /* Active lanes of each element block with active elements */
+  bool                      *has_inactive_lanes;    /* Whether each element block with active elements has inactive lanes */
 } CeedOperator_Opt;
 
 CEED_INTERN int CeedTensorContractCreate_Opt(CeedTensorContract contract);
 
 CEED_INTERN int CeedOperatorCreate_Opt(CeedOperator op);
+CEED_INTERN int CeedOperatorCreateAtPoints_Opt(CeedOperator op);
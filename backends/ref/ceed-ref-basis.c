@@ -13,15 +13,526 @@
 
 #include "ceed-ref.h"
 
+// Bytes of packed element input and output per chunk when applying a basis to a large batch of elements
+#define CEED_BASIS_REF_CHUNK_SIZE (4096 * 1024)
+
 //------------------------------------------------------------------------------
-// Basis Apply
+// Tensor contraction with a 1D matrix, using the even-odd factorization when available
 //------------------------------------------------------------------------------
-static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector U,
-                                  CeedVector V) {
+static inline int CeedBasisTensorContractApply_Ref(CeedBasis_Ref *impl, CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                                   const CeedScalar *t, CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *u,
+                                                   CeedScalar *v) {
+  for (CeedInt i = 0; i < impl->num_even_odd; i++) {
+    if (impl->even_odd[i].t == t) {
+      CeedCallBackend(
+          CeedTensorContractApplyEvenOdd(contract, A, B, C, J, impl->even_odd[i].t_even_odd, impl->even_odd[i].parity, t_mode, add, u, v));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+  CeedCallBackend(CeedTensorContractApply(contract, A, B, C, J, t, t_mode, add, u, v));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get and restore reusable scratch space, growing the allocation as needed
+//   If another thread is applying the same basis, this call gets its own allocation instead
+//------------------------------------------------------------------------------
+static inline int CeedBasisGetScratch_Ref(CeedBasisScratch_Ref *scratch, CeedSize size, bool *is_shared, CeedScalar **data) {
+  *is_shared = pthread_mutex_trylock(&scratch->mutex) == 0;
+  if (!*is_shared) {
+    CeedCallBackend(CeedMalloc(size, data));
+    return CEED_ERROR_SUCCESS;
+  }
+  if (size > scratch->size) {
+    CeedCallBackend(CeedFree(&scratch->data));
+    CeedCallBackend(CeedMalloc(size, &scratch->data));
+    scratch->size = size;
+  }
+  *data = scratch->data;
+  return CEED_ERROR_SUCCESS;
+}
+
+static inline int CeedBasisRestoreScratch_Ref(CeedBasisScratch_Ref *scratch, bool is_shared, CeedScalar **data) {
+  if (is_shared) {
+    *data = NULL;
+    pthread_mutex_unlock(&scratch->mutex);
+  } else {
+    CeedCallBackend(CeedFree(data));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Number of elements per chunk for large batches, so the packed element data stays in cache
+//   while keeping the element dimension of the contractions long enough to vectorize
+//------------------------------------------------------------------------------
+static inline CeedInt CeedBasisGetNumElemChunk_Ref(CeedSize len_elem) {
+  const CeedSize num_elem_chunk = CEED_BASIS_REF_CHUNK_SIZE / (len_elem * (CeedSize)sizeof(CeedScalar));
+
+  return num_elem_chunk < 256 ? 256 : (CeedInt)(num_elem_chunk - num_elem_chunk % 8);
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Tensor Gradient
+//   In CEED_NOTRANSPOSE mode:
+//     u has shape [num_comp, P^dim, num_elem], row-major layout
+//     v has shape [dim, num_comp, Q^dim, num_elem], row-major layout
+//   In CEED_TRANSPOSE mode, the sizes of u and v are switched.
+//   If v_interp is provided in CEED_NOTRANSPOSE mode, the interpolated values are also stored, reusing the gradient passes.
+//------------------------------------------------------------------------------
+static int CeedBasisApplyTensorGrad_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, bool add, const CeedScalar *u, CeedScalar *v,
+                                        CeedScalar *v_interp) {
+  CeedInt            dim, num_comp, num_nodes, num_qpts, P_1d, Q_1d;
+  const CeedScalar  *interp_1d, *grad_1d;
+  CeedTensorContract contract;
+  CeedBasis_Ref     *impl;
+
+  CeedCallBackend(CeedBasisGetData(basis, &impl));
+  CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+  CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+  CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
+  CeedCallBackend(CeedBasisGetGrad1D(basis, &grad_1d));
+  CeedCallBackend(CeedBasisGetTensorContract(basis, &contract));
+
+  if (impl->collo_grad_1d) {
+    // Interpolate, then collocated gradient at quadrature points; the transpose reverses the passes
+    CeedInt        P = P_1d, Q = Q_1d;
+    const CeedSize tmp_len = (CeedSize)num_elem * num_comp * Q_1d * CeedIntPow(P_1d > Q_1d ? P_1d : Q_1d, dim - 1);
+    bool           is_shared;
+    CeedScalar    *work, *tmp[2], *interp;
+
+    CeedCallBackend(
+        CeedBasisGetScratch_Ref(&impl->work, 2 * tmp_len + (v_interp ? 0 : (CeedSize)num_elem * num_comp * num_qpts), &is_shared, &work));
+    tmp[0] = work;
+    tmp[1] = &work[tmp_len];
+    interp = v_interp ? v_interp : &work[2 * tmp_len];
+
+    if (t_mode == CEED_TRANSPOSE) P = Q_1d;
+    // Interpolate to quadrature points (NoTranspose)
+    //  or Grad to quadrature points (Transpose)
+    for (CeedInt d = 0, pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem; d < dim; d++, pre /= P, post *= Q) {
+      CeedCallBackend(CeedBasisTensorContractApply_Ref(
+          impl, contract, pre, P, post, Q, (t_mode == CEED_NOTRANSPOSE ? interp_1d : impl->collo_grad_1d), t_mode,
+          (t_mode == CEED_TRANSPOSE) && (d > 0), (t_mode == CEED_NOTRANSPOSE ? (d == 0 ? u : tmp[d % 2]) : &u[d * num_qpts * num_comp * num_elem]),
+          (t_mode == CEED_NOTRANSPOSE ? (d == dim - 1 ? interp : tmp[(d + 1) % 2]) : interp)));
+    }
+    // Grad to quadrature points (NoTranspose)
+    //  or Interpolate to nodes (Transpose)
+    P = Q_1d, Q = Q_1d;
+    if (t_mode == CEED_TRANSPOSE) Q = P_1d;
+    for (CeedInt d = 0, pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem; d < dim; d++, pre /= P, post *= Q) {
+      CeedCallBackend(CeedBasisTensorContractApply_Ref(
+          impl, contract, pre, P, post, Q, (t_mode == CEED_NOTRANSPOSE ? impl->collo_grad_1d : interp_1d), t_mode,
+          (t_mode == CEED_NOTRANSPOSE && add) || (t_mode == CEED_TRANSPOSE && (d == dim - 1)),
+          (t_mode == CEED_NOTRANSPOSE ? interp : (d == 0 ? interp : tmp[d % 2])),
+          (t_mode == CEED_NOTRANSPOSE ? &v[d * num_qpts * num_comp * num_elem] : (d == dim - 1 ? v : tmp[(d + 1) % 2]))));
+    }
+    CeedCallBackend(CeedBasisRestoreScratch_Ref(&impl->work, is_shared, &work));
+  } else if (impl->has_collo_interp) {
+    // Qpts collocated with nodes, dim contractions and identity in other directions
+    if (v_interp) memcpy(v_interp, u, num_elem * num_comp * num_nodes * sizeof(u[0]));
+    for (CeedInt d = 0, pre = num_comp * CeedIntPow(P_1d, dim - 1), post = num_elem; d < dim; d++, pre /= P_1d, post *= P_1d) {
+      CeedCallBackend(CeedBasisTensorContractApply_Ref(impl, contract, pre, P_1d, post, P_1d, grad_1d, t_mode, add,
+                                                       t_mode == CEED_NOTRANSPOSE ? u : &u[d * num_comp * num_qpts * num_elem],
+                                                       t_mode == CEED_TRANSPOSE ? v : &v[d * num_comp * num_qpts * num_elem]));
+    }
+  } else {
+    // Underintegration, P > Q
+    //   Direction d applies the gradient in pass d and interpolation in the other passes, so the passes before d are shared with
+    //     the interpolation and the passes after d are shared by the transpose
+    //   This takes dim (dim + 1) / 2 + dim - 1 contractions, 8 instead of 9 in 3D, plus one for the interpolated values; a collocated
+    //     gradient, with dim + dim contractions, is not possible as the quadrature points cannot represent the polynomial on the nodes
+    const CeedInt  P = t_mode == CEED_NOTRANSPOSE ? P_1d : Q_1d, Q = t_mode == CEED_NOTRANSPOSE ? Q_1d : P_1d;
+    const CeedSize tmp_len = (CeedSize)num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1);
+    bool           is_shared;
+    CeedScalar    *work, *shared[2], *tmp[2];
+
+    CeedCallBackend(CeedBasisGetScratch_Ref(&impl->work, 4 * tmp_len, &is_shared, &work));
+    shared[0] = work;
+    shared[1] = &work[tmp_len];
+    tmp[0]    = &work[2 * tmp_len];
+    tmp[1]    = &work[3 * tmp_len];
+
+    if (t_mode == CEED_NOTRANSPOSE) {
+      const CeedScalar *interp_prefix = u;
+
+      for (CeedInt p = 0; p < dim; p++) {
+        const CeedScalar *in = interp_prefix;
+
+        // Gradient in pass p, then interpolation in the remaining passes
+        for (CeedInt d = p; d < dim; d++) {
+          CeedScalar *out = d == dim - 1 ? &v[p * num_comp * num_qpts * num_elem] : tmp[(d - p) % 2];
+
+          CeedCallBackend(CeedBasisTensorContractApply_Ref(impl, contract, num_comp * CeedIntPow(P, dim - 1 - d), P, num_elem * CeedIntPow(Q, d), Q,
+                                                           d == p ? grad_1d : interp_1d, t_mode, add && (d == dim - 1), in, out));
+          in = out;
+        }
+        // Interpolation in pass p, shared by the later directions
+        if (p < dim - 1 || v_interp) {
+          CeedScalar *out = p == dim - 1 ? v_interp : shared[p % 2];
+
+          CeedCallBackend(CeedBasisTensorContractApply_Ref(impl, contract, num_comp * CeedIntPow(P, dim - 1 - p), P, num_elem * CeedIntPow(Q, p), Q,
+                                                           interp_1d, t_mode, false, interp_prefix, out));
+          interp_prefix = out;
+        }
+      }
+    } else {
+      const CeedScalar *grad_sum = NULL;
+
+      for (CeedInt p = 0; p < dim; p++) {
+        const CeedScalar *in  = &u[p * num_comp * num_qpts * num_elem];
+        CeedScalar       *out = p == dim - 1 ? v : shared[p % 2];
+
+        // Interpolation in the passes before p
+        for (CeedInt d = 0; d < p; d++) {
+          CeedCallBackend(CeedBasisTensorContractApply_Ref(impl, contract, num_comp * CeedIntPow(P, dim - 1 - d), P, num_elem * CeedIntPow(Q, d), Q,
+                                                           interp_1d, t_mode, false, in, tmp[d % 2]));
+          in = tmp[d % 2];
+        }
+        // Gradient in pass p, summed with interpolation of the earlier directions
+        CeedCallBackend(CeedBasisTensorContractApply_Ref(impl, contract, num_comp * CeedIntPow(P, dim - 1 - p), P, num_elem * CeedIntPow(Q, p), Q,
+                                                         grad_1d, t_mode, add && (p == dim - 1), in, out));
+        if (grad_sum) {
+          CeedCallBackend(CeedBasisTensorContractApply_Ref(impl, contract, num_comp * CeedIntPow(P, dim - 1 - p), P, num_elem * CeedIntPow(Q, p),
+                                                           Q, interp_1d, t_mode, true, grad_sum, out));
+        }
+        grad_sum = out;
+      }
+    }
+    CeedCallBackend(CeedBasisRestoreScratch_Ref(&impl->work, is_shared, &work));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Tensor H(div) and H(curl)
+//------------------------------------------------------------------------------
+static int CeedBasisApplyTensorVector_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, const CeedScalar *u,
+                                          CeedScalar *v) {
+  bool               is_hdiv;
+  CeedInt            dim, num_comp, num_nodes, num_qpts, P_1d, Q_1d, N;
+  CeedFESpace        fe_space;
+  const CeedScalar  *interp_1d, *grad_1d;
+  CeedTensorContract contract;
+  CeedBasis_Ref     *impl;
+
+  CeedCallBackend(CeedBasisGetData(basis, &impl));
+  CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+  CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+  CeedCallBackend(CeedBasisGetFESpace(basis, &fe_space));
+  CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
+  CeedCallBackend(CeedBasisGetGrad1D(basis, &grad_1d));
+  CeedCallBackend(CeedBasisGetTensorContract(basis, &contract));
+  is_hdiv = fe_space == CEED_FE_SPACE_HDIV;
+  CeedCheck(eval_mode == CEED_EVAL_INTERP || (eval_mode == CEED_EVAL_DIV && is_hdiv) || (eval_mode == CEED_EVAL_CURL && !is_hdiv),
+            CeedBasisReturnCeed(basis), CEED_ERROR_BACKEND, "%s not supported for %s", CeedEvalModes[eval_mode], CeedFESpaces[fe_space]);
+  N = num_nodes / dim;
+
+  // Each vector component b is a tensor-product block of nodes, closed 1D basis in direction b for H(div) and open for H(curl)
+  //   and each term is a sum-factorized pass, with the derivative in direction g for divergence and curl
+  const CeedInt  max_1d  = P_1d > Q_1d ? P_1d : Q_1d;
+  const CeedSize tmp_len = (CeedSize)num_elem * CeedIntPow(max_1d, dim);
+  bool           is_shared;
+  CeedScalar    *tmp[2];
+
+  CeedCallBackend(CeedBasisGetScratch_Ref(&impl->work, 2 * tmp_len, &is_shared, &tmp[0]));
+  tmp[1] = &tmp[0][tmp_len];
+
+  for (CeedInt c = 0; c < num_comp; c++) {
+    for (CeedInt b = 0; b < dim; b++) {
+      for (CeedInt g = -1; g < dim; g++) {
+        CeedInt    k = b, in_size[3], out_size[3], out_len = num_elem;
+        CeedScalar sign = 1.0;
+
+        // -- Select the terms for the evaluation mode
+        if (eval_mode == CEED_EVAL_INTERP) {
+          if (g >= 0) break;
+        } else if (g < 0 || (is_hdiv ? g != b : g == b)) {
+          continue;
+        } else if (is_hdiv) {
+          k = 0;
+        } else {
+          k    = dim == 3 ? 3 - g - b : 0;
+          sign = (dim == 3 ? g == (k + 1) % 3 : g == 0) ? 1.0 : -1.0;
+        }
+
+        // -- Sum-factorized pass, one direction at a time
+        const CeedInt     q_offset = (k * num_comp + c) * num_qpts * num_elem, node_offset = (c * num_nodes + b * N) * num_elem;
+        const CeedScalar *in       = &u[t_mode == CEED_NOTRANSPOSE ? node_offset : q_offset];
+        CeedScalar       *out      = &v[t_mode == CEED_NOTRANSPOSE ? q_offset : node_offset];
+
+        for (CeedInt d = 0; d < dim; d++) {
+          const CeedInt n_d = ((d == b) == is_hdiv) ? P_1d : P_1d - 1;
+
+          in_size[d]  = t_mode == CEED_NOTRANSPOSE ? n_d : Q_1d;
+          out_size[d] = t_mode == CEED_NOTRANSPOSE ? Q_1d : n_d;
+          out_len *= out_size[d];
+        }
+        for (CeedInt d = 0; d < dim; d++) {
+          const bool        is_last = d == dim - 1;
+          const CeedScalar *mat = d == g ? grad_1d : (((d == b) == is_hdiv) ? interp_1d : impl->interp_1d_open);
+          CeedInt           pre = 1, post = num_elem;
+
+          for (CeedInt j = d + 1; j < dim; j++) pre *= in_size[j];
+          for (CeedInt j = 0; j < d; j++) post *= out_size[j];
+          CeedCallBackend(CeedTensorContractApply(contract, pre, in_size[d], post, out_size[d], mat, t_mode, is_last && sign > 0,
+                                                  d == 0 ? in : tmp[d % 2], (is_last && sign > 0) ? out : tmp[(d + 1) % 2]));
+        }
+        if (sign < 0) {
+          for (CeedInt i = 0; i < out_len; i++) out[i] -= tmp[dim % 2][i];
+        }
+      }
+    }
+  }
+  CeedCallBackend(CeedBasisRestoreScratch_Ref(&impl->work, is_shared, &tmp[0]));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Simplex, Sum Factorization in Collapsed Coordinates
+//------------------------------------------------------------------------------
+// Nodal values are mapped to modal coefficients with the dense inverse Vandermonde matrix; only the modal basis is sum factorized
+// Modes (i, j[, k]) are ordered with i slowest; A, B, and C are the factors in the collapsed coordinates a, b, and c
+// Quadrature points are ordered with a fastest, and the element index is fastest in all arrays
+static void CeedBasisCollapsedToQuad_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, CeedInt num_elem, const CeedScalar *A, const CeedScalar *B,
+                                         const CeedScalar *C, bool add, const CeedScalar *modal, CeedScalar *g, CeedScalar *f, CeedScalar *out) {
+  const CeedInt     num_pairs = P_1d * (P_1d + 1) / 2, num_modes = dim == 2 ? num_pairs : num_pairs * (P_1d + 2) / 3, Q_c = dim == 3 ? Q_1d : 1;
+  const CeedScalar *g_in = modal;
+
+  // Contract k with c on tetrahedra
+  if (dim == 3) {
+    for (CeedInt i = 0, ij = 0, m = 0; i < P_1d; i++) {
+      for (CeedInt j = 0; j < P_1d - i; m += P_1d - i - j, j++, ij++) {
+        for (CeedInt q_c = 0; q_c < Q_1d; q_c++) {
+          CeedScalar *g_ij = &g[(ij * Q_1d + q_c) * num_elem];
+
+          for (CeedInt e = 0; e < num_elem; e++) g_ij[e] = 0.0;
+          for (CeedInt k = 0; k < P_1d - i - j; k++) {
+            const CeedScalar c_k = C[q_c * num_modes + m + k];
+
+            for (CeedInt e = 0; e < num_elem; e++) g_ij[e] += c_k * modal[(m + k) * num_elem + e];
+          }
+        }
+      }
+    }
+    g_in = g;
+  }
+  // Contract j with b
+  for (CeedInt i = 0, ij_0 = 0; i < P_1d; ij_0 += P_1d - i, i++) {
+    for (CeedInt q_c = 0; q_c < Q_c; q_c++) {
+      for (CeedInt q_b = 0; q_b < Q_1d; q_b++) {
+        CeedScalar *f_i = &f[((i * Q_c + q_c) * Q_1d + q_b) * num_elem];
+
+        for (CeedInt e = 0; e < num_elem; e++) f_i[e] = 0.0;
+        for (CeedInt j = 0; j < P_1d - i; j++) {
+          const CeedScalar b_j = B[q_b * num_pairs + ij_0 + j];
+
+          for (CeedInt e = 0; e < num_elem; e++) f_i[e] += b_j * g_in[((ij_0 + j) * Q_c + q_c) * num_elem + e];
+        }
+      }
+    }
+  }
+  // Contract i with a
+  for (CeedInt q_c = 0; q_c < Q_c; q_c++) {
+    for (CeedInt q_b = 0; q_b < Q_1d; q_b++) {
+      for (CeedInt q_a = 0; q_a < Q_1d; q_a++) {
+        CeedScalar *out_q = &out[((q_c * Q_1d + q_b) * Q_1d + q_a) * num_elem];
+
+        if (!add) {
+          for (CeedInt e = 0; e < num_elem; e++) out_q[e] = 0.0;
+        }
+        for (CeedInt i = 0; i < P_1d; i++) {
+          const CeedScalar a_i = A[q_a * P_1d + i];
+
+          for (CeedInt e = 0; e < num_elem; e++) out_q[e] += a_i * f[((i * Q_c + q_c) * Q_1d + q_b) * num_elem + e];
+        }
+      }
+    }
+  }
+}
+
+static void CeedBasisCollapsedFromQuad_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, CeedInt num_elem, const CeedScalar *A, const CeedScalar *B,
+                                           const CeedScalar *C, bool add, const CeedScalar *in, CeedScalar *f, CeedScalar *g, CeedScalar *modal) {
+  const CeedInt num_pairs = P_1d * (P_1d + 1) / 2, num_modes = dim == 2 ? num_pairs : num_pairs * (P_1d + 2) / 3, Q_c = dim == 3 ? Q_1d : 1;
+  CeedScalar   *g_out = dim == 3 ? g : modal;
+  const bool    add_g = dim == 3 ? false : add;
+
+  // Contract a with i
+  for (CeedInt i = 0; i < P_1d; i++) {
+    for (CeedInt q_c = 0; q_c < Q_c; q_c++) {
+      for (CeedInt q_b = 0; q_b < Q_1d; q_b++) {
+        CeedScalar *f_i = &f[((i * Q_c + q_c) * Q_1d + q_b) * num_elem];
+
+        for (CeedInt e = 0; e < num_elem; e++) f_i[e] = 0.0;
+        for (CeedInt q_a = 0; q_a < Q_1d; q_a++) {
+          const CeedScalar a_i = A[q_a * P_1d + i];
+
+          for (CeedInt e = 0; e < num_elem; e++) f_i[e] += a_i * in[((q_c * Q_1d + q_b) * Q_1d + q_a) * num_elem + e];
+        }
+      }
+    }
+  }
+  // Contract b with j
+  for (CeedInt i = 0, ij = 0; i < P_1d; i++) {
+    for (CeedInt j = 0; j < P_1d - i; j++, ij++) {
+      for (CeedInt q_c = 0; q_c < Q_c; q_c++) {
+        CeedScalar *g_ij = &g_out[(ij * Q_c + q_c) * num_elem];
+
+        if (!add_g) {
+          for (CeedInt e = 0; e < num_elem; e++) g_ij[e] = 0.0;
+        }
+        for (CeedInt q_b = 0; q_b < Q_1d; q_b++) {
+          const CeedScalar b_j = B[q_b * num_pairs + ij];
+
+          for (CeedInt e = 0; e < num_elem; e++) g_ij[e] += b_j * f[((i * Q_c + q_c) * Q_1d + q_b) * num_elem + e];
+        }
+      }
+    }
+  }
+  // Contract c with k on tetrahedra
+  if (dim == 3) {
+    for (CeedInt i = 0, ij = 0, m = 0; i < P_1d; i++) {
+      for (CeedInt j = 0; j < P_1d - i; j++, ij++) {
+        for (CeedInt k = 0; k < P_1d - i - j; k++, m++) {
+          CeedScalar *modal_m = &modal[m * num_elem];
+
+          if (!add) {
+            for (CeedInt e = 0; e < num_elem; e++) modal_m[e] = 0.0;
+          }
+          for (CeedInt q_c = 0; q_c < Q_1d; q_c++) {
+            const CeedScalar c_k = C[q_c * num_modes + m];
+
+            for (CeedInt e = 0; e < num_elem; e++) modal_m[e] += c_k * g[(ij * Q_1d + q_c) * num_elem + e];
+          }
+        }
+      }
+    }
+  }
+}
+
+static int CeedBasisApplySimplex_Ref(CeedBasis basis, bool apply_add, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode,
+                                     const CeedScalar *u, CeedScalar *v) {
+  CeedInt        dim, num_comp, num_nodes, num_qpts, P_1d, Q_1d, num_pairs;
+  CeedBasis_Ref *impl;
+
+  CeedCallBackend(CeedBasisGetData(basis, &impl));
+  CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+  P_1d      = impl->simplex_P_1d;
+  Q_1d      = impl->simplex_Q_1d;
+  num_pairs = P_1d * (P_1d + 1) / 2;
+
+  const CeedInt     num_deriv = eval_mode == CEED_EVAL_GRAD ? dim : 1;
+  const CeedScalar *v_inv = impl->simplex_v_inv, *jacobian = impl->simplex_jacobian;
+  const CeedScalar *factors[2][3] = {
+      {impl->simplex_interp_1d, &impl->simplex_interp_1d[Q_1d * P_1d], &impl->simplex_interp_1d[Q_1d * (P_1d + num_pairs)]},
+      {impl->simplex_grad_1d,   &impl->simplex_grad_1d[Q_1d * P_1d],   &impl->simplex_grad_1d[Q_1d * (P_1d + num_pairs)]  },
+  };
+  const CeedSize    modal_len = (CeedSize)num_nodes * num_elem, g_len = (CeedSize)num_pairs * Q_1d * num_elem;
+  const CeedSize    f_len = (CeedSize)P_1d * CeedIntPow(Q_1d, dim - 1) * num_elem, d_q_len = (CeedSize)num_qpts * num_elem;
+  bool              is_shared;
+  CeedScalar       *modal, *g, *f, *d_q[3];
+
+  CeedCallBackend(CeedBasisGetScratch_Ref(&impl->work, modal_len + g_len + f_len + num_deriv * d_q_len, &is_shared, &modal));
+  g = &modal[modal_len];
+  f = &g[g_len];
+  for (CeedInt d = 0; d < num_deriv; d++) d_q[d] = &f[f_len + d * d_q_len];
+
+  for (CeedInt c = 0; c < num_comp; c++) {
+    if (t_mode == CEED_NOTRANSPOSE) {
+      // -- Nodal values to modal coefficients
+      for (CeedInt m = 0; m < num_nodes; m++) {
+        CeedScalar *modal_m = &modal[m * num_elem];
+
+        for (CeedInt e = 0; e < num_elem; e++) modal_m[e] = 0.0;
+        for (CeedInt n = 0; n < num_nodes; n++) {
+          const CeedScalar v_inv_mn = v_inv[m * num_nodes + n];
+
+          for (CeedInt e = 0; e < num_elem; e++) modal_m[e] += v_inv_mn * u[(c * num_nodes + n) * num_elem + e];
+        }
+      }
+      // -- Modal coefficients to quadrature points
+      if (eval_mode == CEED_EVAL_INTERP) {
+        CeedBasisCollapsedToQuad_Ref(dim, P_1d, Q_1d, num_elem, factors[0][0], factors[0][1], factors[0][2], apply_add, modal, g, f,
+                                     &v[c * num_qpts * num_elem]);
+      } else {
+        // Derivatives in collapsed coordinates, then chain rule to the reference simplex
+        for (CeedInt h = 0; h < dim; h++) {
+          CeedBasisCollapsedToQuad_Ref(dim, P_1d, Q_1d, num_elem, factors[h == 0][0], factors[h == 1][1], factors[h == 2][2], false, modal, g, f,
+                                       d_q[h]);
+        }
+        for (CeedInt d = 0; d < dim; d++) {
+          CeedScalar *v_d = &v[(d * num_comp + c) * num_qpts * num_elem];
+
+          for (CeedInt q = 0; q < num_qpts; q++) {
+            const CeedScalar *jacobian_q = &jacobian[(q * dim + d) * dim];
+
+            if (!apply_add) {
+              for (CeedInt e = 0; e < num_elem; e++) v_d[q * num_elem + e] = 0.0;
+            }
+            for (CeedInt h = 0; h < dim; h++) {
+              if (jacobian_q[h] == 0.0) continue;
+              for (CeedInt e = 0; e < num_elem; e++) v_d[q * num_elem + e] += jacobian_q[h] * d_q[h][q * num_elem + e];
+            }
+          }
+        }
+      }
+    } else {
+      // -- Quadrature points to modal coefficients
+      if (eval_mode == CEED_EVAL_INTERP) {
+        CeedBasisCollapsedFromQuad_Ref(dim, P_1d, Q_1d, num_elem, factors[0][0], factors[0][1], factors[0][2], false, &u[c * num_qpts * num_elem], f,
+                                       g, modal);
+      } else {
+        // Transpose of the chain rule, then derivatives in collapsed coordinates
+        for (CeedInt h = 0; h < dim; h++) {
+          for (CeedInt q = 0; q < num_qpts; q++) {
+            for (CeedInt e = 0; e < num_elem; e++) d_q[h][q * num_elem + e] = 0.0;
+            for (CeedInt d = 0; d < dim; d++) {
+              const CeedScalar  jacobian_dh = jacobian[(q * dim + d) * dim + h];
+              const CeedScalar *u_d         = &u[((d * num_comp + c) * num_qpts + q) * num_elem];
+
+              if (jacobian_dh == 0.0) continue;
+              for (CeedInt e = 0; e < num_elem; e++) d_q[h][q * num_elem + e] += jacobian_dh * u_d[e];
+            }
+          }
+          CeedBasisCollapsedFromQuad_Ref(dim, P_1d, Q_1d, num_elem, factors[h == 0][0], factors[h == 1][1], factors[h == 2][2], h > 0, d_q[h], f, g,
+                                         modal);
+        }
+      }
+      // -- Modal coefficients to nodal values
+      for (CeedInt n = 0; n < num_nodes; n++) {
+        CeedScalar *v_n = &v[(c * num_nodes + n) * num_elem];
+
+        for (CeedInt m = 0; m < num_nodes; m++) {
+          const CeedScalar v_inv_mn = v_inv[m * num_nodes + n];
+
+          for (CeedInt e = 0; e < num_elem; e++) v_n[e] += v_inv_mn * modal[m * num_elem + e];
+        }
+      }
+    }
+  }
+  CeedCallBackend(CeedBasisRestoreScratch_Ref(&impl->work, is_shared, &modal));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply to Element Arrays
+//------------------------------------------------------------------------------
+static int CeedBasisApplyElems_Ref(CeedBasis basis, bool apply_add, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode,
+                                   const CeedScalar *u, CeedScalar *v) {
   bool               is_tensor_basis, add = apply_add || (t_mode == CEED_TRANSPOSE);
   CeedInt            dim, num_comp, q_comp, num_nodes, num_qpts;
-  const CeedScalar  *u;
-  CeedScalar        *v;
+  CeedFESpace        fe_space;
   CeedTensorContract contract;
   CeedBasis_Ref     *impl;
 
@@ -32,21 +543,25 @@ static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_e
   CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
   CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
   CeedCallBackend(CeedBasisGetTensorContract(basis, &contract));
-  if (U != CEED_VECTOR_NONE) CeedCallBackend(CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u));
-  else CeedCheck(eval_mode == CEED_EVAL_WEIGHT, CeedBasisReturnCeed(basis), CEED_ERROR_BACKEND, "An input vector is required for this CeedEvalMode");
-  // Clear v if operating in transpose
-  if (apply_add) CeedCallBackend(CeedVectorGetArray(V, CEED_MEM_HOST, &v));
-  else CeedCallBackend(CeedVectorGetArrayWrite(V, CEED_MEM_HOST, &v));
+  CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor_basis));
+  CeedCallBackend(CeedBasisGetFESpace(basis, &fe_space));
 
-  if (t_mode == CEED_TRANSPOSE && !apply_add) {
-    CeedSize len;
+  // Clear v if operating in transpose
+  if (t_mode == CEED_TRANSPOSE && !apply_add && eval_mode != CEED_EVAL_WEIGHT) {
+    const CeedSize len = (CeedSize)num_elem * num_comp * num_nodes;
 
-    CeedCallBackend(CeedVectorGetLength(V, &len));
-    for (CeedInt i = 0; i < len; i++) v[i] = 0.0;
+    for (CeedSize i = 0; i < len; i++) v[i] = 0.0;
   }
 
-  CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor_basis));
-  if (is_tensor_basis) {
+  if (is_tensor_basis && fe_space != CEED_FE_SPACE_H1 && eval_mode != CEED_EVAL_WEIGHT) {
+    // Tensor H(div) or H(curl) basis, terms accumulate into v
+    if (t_mode == CEED_NOTRANSPOSE && !apply_add) {
+      const CeedSize len = (CeedSize)num_elem * num_comp * q_comp * num_qpts;
+
+      for (CeedSize i = 0; i < len; i++) v[i] = 0.0;
+    }
+    CeedCallBackend(CeedBasisApplyTensorVector_Ref(basis, num_elem, t_mode, eval_mode, u, v));
+  } else if (is_tensor_basis) {
     // Tensor basis
     CeedInt P_1d, Q_1d;
 
@@ -65,105 +580,26 @@ static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_e
             Q = P_1d;
           }
           CeedInt           pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
-          CeedScalar        tmp[2][num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
+          const CeedSize    tmp_len = (CeedSize)num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1);
+          bool              is_shared;
+          CeedScalar       *tmp[2];
           const CeedScalar *interp_1d;
 
+          CeedCallBackend(CeedBasisGetScratch_Ref(&impl->work, 2 * tmp_len, &is_shared, &tmp[0]));
+          tmp[1] = &tmp[0][tmp_len];
           CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
           for (CeedInt d = 0; d < dim; d++) {
-            CeedCallBackend(CeedTensorContractApply(contract, pre, P, post, Q, interp_1d, t_mode, add && (d == dim - 1), d == 0 ? u : tmp[d % 2],
-                                                    d == dim - 1 ? v : tmp[(d + 1) % 2]));
+            CeedCallBackend(CeedBasisTensorContractApply_Ref(impl, contract, pre, P, post, Q, interp_1d, t_mode, add && (d == dim - 1),
+                                                             d == 0 ? u : tmp[d % 2], d == dim - 1 ? v : tmp[(d + 1) % 2]));
             pre /= P;
             post *= Q;
           }
+          CeedCallBackend(CeedBasisRestoreScratch_Ref(&impl->work, is_shared, &tmp[0]));
         }
       } break;
       // Evaluate the gradient to/from quadrature points
       case CEED_EVAL_GRAD: {
-        // In CEED_NOTRANSPOSE mode:
-        // u has shape [dim, num_comp, P^dim, num_elem], row-major layout
-        // v has shape [dim, num_comp, Q^dim, num_elem], row-major layout
-        // In CEED_TRANSPOSE mode, the sizes of u and v are switched.
-        CeedInt P = P_1d, Q = Q_1d;
-
-        if (t_mode == CEED_TRANSPOSE) {
-          P = Q_1d;
-          Q = Q_1d;
-        }
-        CeedInt           pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
-        const CeedScalar *interp_1d;
-
-        CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
-        if (impl->collo_grad_1d) {
-          CeedScalar tmp[2][num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
-          CeedScalar interp[num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
-
-          // Interpolate to quadrature points (NoTranspose)
-          //  or Grad to quadrature points (Transpose)
-          for (CeedInt d = 0; d < dim; d++) {
-            CeedCallBackend(CeedTensorContractApply(contract, pre, P, post, Q, (t_mode == CEED_NOTRANSPOSE ? interp_1d : impl->collo_grad_1d), t_mode,
-                                                    (t_mode == CEED_TRANSPOSE) && (d > 0),
-                                                    (t_mode == CEED_NOTRANSPOSE ? (d == 0 ? u : tmp[d % 2]) : &u[d * num_qpts * num_comp * num_elem]),
-                                                    (t_mode == CEED_NOTRANSPOSE ? (d == dim - 1 ? interp : tmp[(d + 1) % 2]) : interp)));
-            pre /= P;
-            post *= Q;
-          }
-          // Grad to quadrature points (NoTranspose)
-          //  or Interpolate to nodes (Transpose)
-          P = Q_1d, Q = Q_1d;
-          if (t_mode == CEED_TRANSPOSE) {
-            P = Q_1d;
-            Q = P_1d;
-          }
-          pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
-          for (CeedInt d = 0; d < dim; d++) {
-            CeedCallBackend(CeedTensorContractApply(
-                contract, pre, P, post, Q, (t_mode == CEED_NOTRANSPOSE ? impl->collo_grad_1d : interp_1d), t_mode,
-                (t_mode == CEED_NOTRANSPOSE && apply_add) || (t_mode == CEED_TRANSPOSE && (d == dim - 1)),
-                (t_mode == CEED_NOTRANSPOSE ? interp : (d == 0 ? interp : tmp[d % 2])),
-                (t_mode == CEED_NOTRANSPOSE ? &v[d * num_qpts * num_comp * num_elem] : (d == dim - 1 ? v : tmp[(d + 1) % 2]))));
-            pre /= P;
-            post *= Q;
-          }
-        } else if (impl->has_collo_interp) {  // Qpts collocated with nodes
-          const CeedScalar *grad_1d;
-
-          CeedCallBackend(CeedBasisGetGrad1D(basis, &grad_1d));
-
-          // Dim contractions, identity in other directions
-          CeedInt pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
-
-          for (CeedInt d = 0; d < dim; d++) {
-            CeedCallBackend(CeedTensorContractApply(contract, pre, P, post, Q, grad_1d, t_mode, add && (d > 0),
-                                                    t_mode == CEED_NOTRANSPOSE ? u : &u[d * num_comp * num_qpts * num_elem],
-                                                    t_mode == CEED_TRANSPOSE ? v : &v[d * num_comp * num_qpts * num_elem]));
-            pre /= P;
-            post *= Q;
-          }
-        } else {  // Underintegration, P > Q
-          const CeedScalar *grad_1d;
-
-          CeedCallBackend(CeedBasisGetGrad1D(basis, &grad_1d));
-
-          if (t_mode == CEED_TRANSPOSE) {
-            P = Q_1d;
-            Q = P_1d;
-          }
-          CeedScalar tmp[2][num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
-
-          // Dim**2 contractions, apply grad when pass == dim
-          for (CeedInt p = 0; p < dim; p++) {
-            CeedInt pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
-
-            for (CeedInt d = 0; d < dim; d++) {
-              CeedCallBackend(CeedTensorContractApply(
-                  contract, pre, P, post, Q, (p == d) ? grad_1d : interp_1d, t_mode, add && (d == dim - 1),
-                  (d == 0 ? (t_mode == CEED_NOTRANSPOSE ? u : &u[p * num_comp * num_qpts * num_elem]) : tmp[d % 2]),
-                  (d == dim - 1 ? (t_mode == CEED_TRANSPOSE ? v : &v[p * num_comp * num_qpts * num_elem]) : tmp[(d + 1) % 2])));
-              pre /= P;
-              post *= Q;
-            }
-          }
-        }
+        CeedCallBackend(CeedBasisApplyTensorGrad_Ref(basis, num_elem, t_mode, add, u, v, NULL));
       } break;
       // Retrieve interpolation weights
       case CEED_EVAL_WEIGHT: {
@@ -194,6 +630,9 @@ static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_e
         return CeedError(CeedBasisReturnCeed(basis), CEED_ERROR_BACKEND, "CEED_EVAL_NONE does not make sense in this context");
         // LCOV_EXCL_STOP
     }
+  } else if (impl && impl->simplex_P_1d > 0 && (eval_mode == CEED_EVAL_INTERP || eval_mode == CEED_EVAL_GRAD)) {
+    // Simplex basis in collapsed coordinates
+    CeedCallBackend(CeedBasisApplySimplex_Ref(basis, apply_add, num_elem, t_mode, eval_mode, u, v));
   } else {
     // Non-tensor basis
     CeedInt P = num_nodes, Q = num_qpts;
@@ -243,6 +682,63 @@ static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_e
         // LCOV_EXCL_STOP
     }
   }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply
+//------------------------------------------------------------------------------
+static int CeedBasisApplyCore_Ref(CeedBasis basis, bool apply_add, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector U,
+                                  CeedVector V) {
+  CeedInt           num_comp, q_comp, num_nodes, num_qpts;
+  const CeedScalar *u = NULL;
+  CeedScalar       *v;
+  CeedBasis_Ref    *impl;
+
+  CeedCallBackend(CeedBasisGetData(basis, &impl));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCallBackend(CeedBasisGetNumQuadratureComponents(basis, eval_mode, &q_comp));
+  CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+  if (U != CEED_VECTOR_NONE) CeedCallBackend(CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u));
+  else CeedCheck(eval_mode == CEED_EVAL_WEIGHT, CeedBasisReturnCeed(basis), CEED_ERROR_BACKEND, "An input vector is required for this CeedEvalMode");
+  if (apply_add) CeedCallBackend(CeedVectorGetArray(V, CEED_MEM_HOST, &v));
+  else CeedCallBackend(CeedVectorGetArrayWrite(V, CEED_MEM_HOST, &v));
+
+  {
+    const CeedSize len_nodes = (CeedSize)num_comp * num_nodes, len_qpts = (CeedSize)num_comp * q_comp * num_qpts;
+    const CeedSize len_in = t_mode == CEED_NOTRANSPOSE ? len_nodes : len_qpts, len_out = t_mode == CEED_NOTRANSPOSE ? len_qpts : len_nodes;
+    const CeedInt  num_elem_chunk = CeedBasisGetNumElemChunk_Ref(len_in + len_out);
+
+    if (impl && eval_mode != CEED_EVAL_WEIGHT && num_elem > num_elem_chunk) {
+      // Large batches are evaluated in chunks of elements, packed into reusable scratch space
+      bool        is_shared;
+      CeedScalar *u_chunk, *v_chunk;
+
+      CeedCallBackend(CeedBasisGetScratch_Ref(&impl->chunk, (len_in + len_out) * num_elem_chunk, &is_shared, &u_chunk));
+      v_chunk = &u_chunk[len_in * num_elem_chunk];
+      for (CeedInt e_start = 0; e_start < num_elem; e_start += num_elem_chunk) {
+        const CeedInt num_elem_e = num_elem - e_start < num_elem_chunk ? num_elem - e_start : num_elem_chunk;
+
+        for (CeedSize i = 0; i < len_in; i++) {
+          for (CeedInt e = 0; e < num_elem_e; e++) u_chunk[i * num_elem_e + e] = u[i * num_elem + e_start + e];
+        }
+        CeedCallBackend(CeedBasisApplyElems_Ref(basis, false, num_elem_e, t_mode, eval_mode, u_chunk, v_chunk));
+        if (apply_add) {
+          for (CeedSize i = 0; i < len_out; i++) {
+            for (CeedInt e = 0; e < num_elem_e; e++) v[i * num_elem + e_start + e] += v_chunk[i * num_elem_e + e];
+          }
+        } else {
+          for (CeedSize i = 0; i < len_out; i++) {
+            for (CeedInt e = 0; e < num_elem_e; e++) v[i * num_elem + e_start + e] = v_chunk[i * num_elem_e + e];
+          }
+        }
+      }
+      CeedCallBackend(CeedBasisRestoreScratch_Ref(&impl->chunk, is_shared, &u_chunk));
+    } else {
+      CeedCallBackend(CeedBasisApplyElems_Ref(basis, apply_add, num_elem, t_mode, eval_mode, u, v));
+    }
+  }
   if (U != CEED_VECTOR_NONE) {
     CeedCallBackend(CeedVectorRestoreArrayRead(U, &u));
   }
@@ -261,13 +757,77 @@ static int CeedBasisApplyAdd_Ref(CeedBasis basis, CeedInt num_elem, CeedTranspos
 }
 
 //------------------------------------------------------------------------------
-// Basis Destroy Tensor
+// Basis Apply Interpolation and Gradient
+//------------------------------------------------------------------------------
+static int CeedBasisApplyInterpAndGrad_Ref(CeedBasis basis, CeedInt num_elem, CeedVector U, CeedVector V_interp, CeedVector V_grad) {
+  CeedInt           dim, num_comp, num_nodes, num_qpts;
+  const CeedScalar *u;
+  CeedScalar       *v_interp, *v_grad;
+  CeedBasis_Ref    *impl;
+
+  CeedCallBackend(CeedBasisGetData(basis, &impl));
+  CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+  CeedCallBackend(CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u));
+  CeedCallBackend(CeedVectorGetArrayWrite(V_interp, CEED_MEM_HOST, &v_interp));
+  CeedCallBackend(CeedVectorGetArrayWrite(V_grad, CEED_MEM_HOST, &v_grad));
+  {
+    const CeedSize len_in = (CeedSize)num_comp * num_nodes, len_interp = (CeedSize)num_comp * num_qpts, len_grad = dim * len_interp;
+    const CeedInt  num_elem_chunk = CeedBasisGetNumElemChunk_Ref(len_in + len_interp + len_grad);
+
+    if (num_elem > num_elem_chunk) {
+      // Large batches are evaluated in chunks of elements, packed into reusable scratch space
+      bool        is_shared;
+      CeedScalar *u_chunk, *v_interp_chunk, *v_grad_chunk;
+
+      CeedCallBackend(CeedBasisGetScratch_Ref(&impl->chunk, (len_in + len_interp + len_grad) * num_elem_chunk, &is_shared, &u_chunk));
+      v_interp_chunk = &u_chunk[len_in * num_elem_chunk];
+      v_grad_chunk   = &v_interp_chunk[len_interp * num_elem_chunk];
+      for (CeedInt e_start = 0; e_start < num_elem; e_start += num_elem_chunk) {
+        const CeedInt num_elem_e = num_elem - e_start < num_elem_chunk ? num_elem - e_start : num_elem_chunk;
+
+        for (CeedSize i = 0; i < len_in; i++) {
+          for (CeedInt e = 0; e < num_elem_e; e++) u_chunk[i * num_elem_e + e] = u[i * num_elem + e_start + e];
+        }
+        CeedCallBackend(CeedBasisApplyTensorGrad_Ref(basis, num_elem_e, CEED_NOTRANSPOSE, false, u_chunk, v_grad_chunk, v_interp_chunk));
+        for (CeedSize i = 0; i < len_interp; i++) {
+          for (CeedInt e = 0; e < num_elem_e; e++) v_interp[i * num_elem + e_start + e] = v_interp_chunk[i * num_elem_e + e];
+        }
+        for (CeedSize i = 0; i < len_grad; i++) {
+          for (CeedInt e = 0; e < num_elem_e; e++) v_grad[i * num_elem + e_start + e] = v_grad_chunk[i * num_elem_e + e];
+        }
+      }
+      CeedCallBackend(CeedBasisRestoreScratch_Ref(&impl->chunk, is_shared, &u_chunk));
+    } else {
+      CeedCallBackend(CeedBasisApplyTensorGrad_Ref(basis, num_elem, CEED_NOTRANSPOSE, false, u, v_grad, v_interp));
+    }
+  }
+  CeedCallBackend(CeedVectorRestoreArrayRead(U, &u));
+  CeedCallBackend(CeedVectorRestoreArray(V_interp, &v_interp));
+  CeedCallBackend(CeedVectorRestoreArray(V_grad, &v_grad));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Destroy
 //------------------------------------------------------------------------------
-static int CeedBasisDestroyTensor_Ref(CeedBasis basis) {
+static int CeedBasisDestroy_Ref(CeedBasis basis) {
   CeedBasis_Ref *impl;
 
   CeedCallBackend(CeedBasisGetData(basis, &impl));
   CeedCallBackend(CeedFree(&impl->collo_grad_1d));
+  for (CeedInt i = 0; i < impl->num_even_odd; i++) CeedCallBackend(CeedFree(&impl->even_odd[i].t_even_odd));
+  CeedCallBackend(CeedFree(&impl->interp_1d_open));
+  CeedCallBackend(CeedFree(&impl->simplex_v_inv));
+  CeedCallBackend(CeedFree(&impl->simplex_interp_1d));
+  CeedCallBackend(CeedFree(&impl->simplex_grad_1d));
+  CeedCallBackend(CeedFree(&impl->simplex_jacobian));
+  CeedCallBackend(CeedFree(&impl->work.data));
+  CeedCallBackend(CeedFree(&impl->chunk.data));
+  pthread_mutex_destroy(&impl->work.mutex);
+  pthread_mutex_destroy(&impl->chunk.mutex);
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
@@ -285,6 +845,8 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const C
   CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
 
   CeedCallBackend(CeedCalloc(1, &impl));
+  pthread_mutex_init(&impl->work.mutex, NULL);
+  pthread_mutex_init(&impl->chunk.mutex, NULL);
   // Check for collocated interp
   if (Q_1d == P_1d) {
     bool has_collocated = true;
@@ -307,14 +869,76 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const C
   CeedCallBackend(CeedTensorContractCreate(ceed_parent, &contract));
   CeedCallBackend(CeedBasisSetTensorContract(basis, contract));
 
+  // Factor 1D matrices with even-odd symmetry, from symmetric nodes and quadrature points
+  {
+    const CeedScalar *matrices[3];
+    const CeedInt     num_cols[3] = {P_1d, P_1d, Q_1d};
+
+    CeedCallBackend(CeedBasisGetInterp1D(basis, &matrices[0]));
+    CeedCallBackend(CeedBasisGetGrad1D(basis, &matrices[1]));
+    matrices[2] = impl->collo_grad_1d;
+    for (CeedInt i = 0; i < 3; i++) {
+      CeedInt     parity;
+      CeedScalar *t_even_odd;
+
+      if (!matrices[i]) continue;
+      CeedCallBackend(CeedMalloc(((Q_1d + 1) / 2) * num_cols[i], &t_even_odd));
+      CeedCallBackend(CeedTensorContractGetEvenOdd(contract, Q_1d, num_cols[i], matrices[i], &parity, t_even_odd));
+      if (parity) impl->even_odd[impl->num_even_odd++] = (CeedBasisEvenOdd_Ref){matrices[i], t_even_odd, parity};
+      else CeedCallBackend(CeedFree(&t_even_odd));
+    }
+  }
+
   CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "Apply", CeedBasisApply_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "ApplyAdd", CeedBasisApplyAdd_Ref));
-  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "Destroy", CeedBasisDestroyTensor_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "ApplyInterpAndGrad", CeedBasisApplyInterpAndGrad_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "Destroy", CeedBasisDestroy_Ref));
   CeedCallBackend(CeedDestroy(&ceed));
   CeedCallBackend(CeedDestroy(&ceed_parent));
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Basis Create Tensor H(div) and H(curl)
+//------------------------------------------------------------------------------
+static int CeedBasisCreateTensorVector_Ref(CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d_open, CeedBasis basis) {
+  Ceed               ceed, ceed_parent;
+  CeedBasis_Ref     *impl;
+  CeedTensorContract contract;
+
+  CeedCallBackend(CeedBasisGetCeed(basis, &ceed));
+  CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  pthread_mutex_init(&impl->work.mutex, NULL);
+  pthread_mutex_init(&impl->chunk.mutex, NULL);
+  CeedCallBackend(CeedCalloc(Q_1d * (P_1d - 1), &impl->interp_1d_open));
+  if (interp_1d_open) memcpy(impl->interp_1d_open, interp_1d_open, Q_1d * (P_1d - 1) * sizeof(interp_1d_open[0]));
+  CeedCallBackend(CeedBasisSetData(basis, impl));
+
+  CeedCallBackend(CeedTensorContractCreate(ceed_parent, &contract));
+  CeedCallBackend(CeedBasisSetTensorContract(basis, contract));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "Apply", CeedBasisApply_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "ApplyAdd", CeedBasisApplyAdd_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "Destroy", CeedBasisDestroy_Ref));
+  CeedCallBackend(CeedDestroy(&ceed));
+  CeedCallBackend(CeedDestroy(&ceed_parent));
+  return CEED_ERROR_SUCCESS;
+}
+
+int CeedBasisCreateTensorHdiv_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d, const CeedScalar *grad_1d,
+                                  const CeedScalar *interp_1d_open, const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d, CeedBasis basis) {
+  CeedCallBackend(CeedBasisCreateTensorVector_Ref(P_1d, Q_1d, interp_1d_open, basis));
+  return CEED_ERROR_SUCCESS;
+}
+
+int CeedBasisCreateTensorHcurl_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d, const CeedScalar *grad_1d,
+                                   const CeedScalar *interp_1d_open, const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d, CeedBasis basis) {
+  CeedCallBackend(CeedBasisCreateTensorVector_Ref(P_1d, Q_1d, interp_1d_open, basis));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Basis Create Non-Tensor H^1
 //------------------------------------------------------------------------------
@@ -336,6 +960,48 @@ int CeedBasisCreateH1_Ref(CeedElemTopology topo, CeedInt dim, CeedInt num_nodes,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Basis Create Simplex H^1, Collapsed Coordinates
+//------------------------------------------------------------------------------
+int CeedBasisCreateSimplexH1_Ref(CeedElemTopology topo, CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *v_inv, const CeedScalar *interp_1d,
+                                 const CeedScalar *grad_1d, const CeedScalar *jacobian, CeedBasis basis) {
+  Ceed               ceed, ceed_parent;
+  CeedInt            num_nodes, num_qpts, num_pairs = P_1d * (P_1d + 1) / 2, num_factors;
+  CeedBasis_Ref     *impl;
+  CeedTensorContract contract;
+
+  CeedCallBackend(CeedBasisGetCeed(basis, &ceed));
+  CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
+  CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
+  CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+  num_factors = Q_1d * (P_1d + num_pairs + (dim == 3 ? num_nodes : 0));
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  pthread_mutex_init(&impl->work.mutex, NULL);
+  pthread_mutex_init(&impl->chunk.mutex, NULL);
+  impl->simplex_P_1d = P_1d;
+  impl->simplex_Q_1d = Q_1d;
+  CeedCallBackend(CeedMalloc(num_nodes * num_nodes, &impl->simplex_v_inv));
+  CeedCallBackend(CeedMalloc(num_factors, &impl->simplex_interp_1d));
+  CeedCallBackend(CeedMalloc(num_factors, &impl->simplex_grad_1d));
+  CeedCallBackend(CeedMalloc(dim * dim * num_qpts, &impl->simplex_jacobian));
+  memcpy(impl->simplex_v_inv, v_inv, num_nodes * num_nodes * sizeof(v_inv[0]));
+  memcpy(impl->simplex_interp_1d, interp_1d, num_factors * sizeof(interp_1d[0]));
+  memcpy(impl->simplex_grad_1d, grad_1d, num_factors * sizeof(grad_1d[0]));
+  memcpy(impl->simplex_jacobian, jacobian, dim * dim * num_qpts * sizeof(jacobian[0]));
+  CeedCallBackend(CeedBasisSetData(basis, impl));
+
+  CeedCallBackend(CeedTensorContractCreate(ceed_parent, &contract));
+  CeedCallBackend(CeedBasisSetTensorContract(basis, contract));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "Apply", CeedBasisApply_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "ApplyAdd", CeedBasisApplyAdd_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Basis", basis, "Destroy", CeedBasisDestroy_Ref));
+  CeedCallBackend(CeedDestroy(&ceed));
+  CeedCallBackend(CeedDestroy(&ceed_parent));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Basis Create Non-Tensor H(div)
 //------------------------------------------------------------------------------
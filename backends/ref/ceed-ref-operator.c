@@ -10,15 +10,69 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "ceed-ref.h"
 
+//------------------------------------------------------------------------------
+// Free Setup Data
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFree_Ref(CeedOperator_Ref *impl) {
+  CeedCallBackend(CeedFree(&impl->skip_rstr_in));
+  CeedCallBackend(CeedFree(&impl->skip_rstr_out));
+  CeedCallBackend(CeedFree(&impl->skip_basis_in));
+  CeedCallBackend(CeedFree(&impl->fused_basis_in_indices));
+  CeedCallBackend(CeedFree(&impl->e_data_out_indices));
+  CeedCallBackend(CeedFree(&impl->apply_add_basis_out));
+  for (CeedInt i = 0; i < impl->num_inputs + impl->num_outputs; i++) {
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->e_vecs_full));
+  CeedCallBackend(CeedFree(&impl->input_states));
+  if (impl->q_cache_in) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedFree(&impl->q_cache_in[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->q_cache_in));
+  CeedCallBackend(CeedFree(&impl->is_q_cache_valid));
+
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
+    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->e_vecs_in));
+  CeedCallBackend(CeedFree(&impl->q_vecs_in));
+
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i]));
+    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->e_vecs_out));
+  CeedCallBackend(CeedFree(&impl->q_vecs_out));
+
+  // Q-vector data is freed once no Q-vector borrows it
+  if (impl->plan_in) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) CeedCallBackend(CeedFree(&impl->plan_in[i].q_data));
+  }
+  if (impl->plan_out) {
+    for (CeedInt i = 0; i < impl->num_outputs; i++) CeedCallBackend(CeedFree(&impl->plan_out[i].q_data));
+  }
+  CeedCallBackend(CeedFree(&impl->plan_in));
+  CeedCallBackend(CeedFree(&impl->plan_out));
+  CeedCallBackend(CeedFree(&impl->qf_inputs));
+  CeedCallBackend(CeedFree(&impl->qf_outputs));
+  impl->qf_user = NULL;
+  CeedCallBackend(CeedVectorDestroy(&impl->point_coords_elem));
+  impl->num_inputs  = 0;
+  impl->num_outputs = 0;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
-static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, CeedInt *e_data_out_indices,
-                                       bool *apply_add_basis, CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs, CeedInt start_e,
-                                       CeedInt num_fields, CeedInt Q) {
+static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, bool *skip_basis,
+                                       CeedInt *fused_basis_indices, CeedInt *e_data_out_indices, bool *apply_add_basis, CeedVector *e_vecs_full,
+                                       CeedVector *e_vecs, CeedVector *q_vecs, CeedInt start_e, CeedInt num_fields, CeedInt Q) {
   Ceed                ceed;
   CeedSize            e_size, q_size;
   CeedInt             num_comp, size, P;
@@ -101,6 +155,26 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool i
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
           skip_rstr[j] = true;
+          // Fuse interpolation and gradient with the same basis, applied with the later field
+          if (!skip_basis[i] && !skip_basis[j] && fused_basis_indices[i] == -1 && fused_basis_indices[j] == -1) {
+            CeedEvalMode eval_mode_i, eval_mode_j;
+
+            CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode_i));
+            CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[j], &eval_mode_j));
+            if ((eval_mode_i == CEED_EVAL_INTERP && eval_mode_j == CEED_EVAL_GRAD) ||
+                (eval_mode_i == CEED_EVAL_GRAD && eval_mode_j == CEED_EVAL_INTERP)) {
+              CeedBasis basis_i, basis_j;
+
+              CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis_i));
+              CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[j], &basis_j));
+              if (basis_i == basis_j) {
+                skip_basis[i]          = true;
+                fused_basis_indices[j] = i;
+              }
+              CeedCallBackend(CeedBasisDestroy(&basis_i));
+              CeedCallBackend(CeedBasisDestroy(&basis_j));
+            }
+          }
         }
         CeedCallBackend(CeedVectorDestroy(&vec_j));
         CeedCallBackend(CeedElemRestrictionDestroy(&rstr_j));
@@ -139,12 +213,129 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool i
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Setup Cached Quadrature Point Values of Passive Inputs
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupQuadratureCache_Ref(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                                CeedInt num_elem, CeedInt Q, CeedOperator_Ref *impl) {
+  bool is_cached[CEED_FIELD_MAX] = {false};
+
+  // Identity QFunctions write their output into the input Q-vector
+  if (impl->is_identity_qf) return CEED_ERROR_SUCCESS;
+
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    bool         cache;
+    CeedEvalMode eval_mode;
+    CeedVector   vec;
+
+    CeedCallBackend(CeedOperatorFieldGetCacheQuadratureValues(op_input_fields[i], &cache));
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    is_cached[i] = cache && vec != CEED_VECTOR_ACTIVE && eval_mode != CEED_EVAL_NONE && eval_mode != CEED_EVAL_WEIGHT;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+  // Fields sharing a fused basis action are cached together
+  for (CeedInt j = 0; j < num_input_fields; j++) {
+    const CeedInt i = impl->fused_basis_in_indices[j];
+
+    if (i != -1) is_cached[i] = is_cached[j] = is_cached[i] || is_cached[j];
+  }
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedInt size;
+
+    if (!is_cached[i]) continue;
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+    CeedCallBackend(CeedCalloc((CeedSize)num_elem * Q * size, &impl->q_cache_in[i]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Per-Field Plan
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFieldPlan_Ref(CeedQFunctionField qf_field, CeedOperatorField op_field, CeedInt Q, CeedOperatorFieldPlan_Ref *plan) {
+  CeedVector vec;
+
+  CeedCallBackend(CeedOperatorFieldGetVector(op_field, &vec));
+  plan->is_active = vec == CEED_VECTOR_ACTIVE;
+  CeedCallBackend(CeedVectorDestroy(&vec));
+  CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_field, &plan->eval_mode));
+  CeedCallBackend(CeedQFunctionFieldGetSize(qf_field, &plan->size));
+  plan->e_stride = Q * plan->size;
+  switch (plan->eval_mode) {
+    case CEED_EVAL_NONE:
+    case CEED_EVAL_WEIGHT:
+      break;
+    case CEED_EVAL_INTERP:
+    case CEED_EVAL_GRAD:
+    case CEED_EVAL_DIV:
+    case CEED_EVAL_CURL: {
+      CeedInt             elem_size, num_comp;
+      CeedElemRestriction elem_rstr;
+      CeedBasis           basis;
+
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_field, &elem_rstr));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
+      CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+      CeedCallBackend(CeedOperatorFieldGetBasis(op_field, &basis));
+      CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+      // The operator field keeps its reference to the basis
+      plan->basis = basis;
+      CeedCallBackend(CeedBasisDestroy(&basis));
+      plan->e_stride = elem_size * num_comp;
+    } break;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Direct QFunction Calls
+//   Q-vectors with basis actions borrow operator owned arrays, so the element loop passes raw pointers to the user QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupQFunctionUser_Ref(CeedQFunction qf, CeedInt Q, CeedOperator_Ref *impl) {
+  bool              is_direct;
+  CeedInt           vec_length;
+  CeedQFunctionUser f;
+
+  // QFunction backends that do more than call the user function, such as memcheck, are applied through CeedQFunctionApply
+  CeedCallBackend(CeedQFunctionIsUserFunctionDirect(qf, &is_direct));
+  CeedCallBackend(CeedQFunctionGetVectorLength(qf, &vec_length));
+  CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+  if (impl->is_identity_qf || !is_direct || !f || Q % vec_length != 0) return CEED_ERROR_SUCCESS;
+
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    CeedOperatorFieldPlan_Ref *plan = &impl->plan_in[i];
+
+    if (plan->eval_mode == CEED_EVAL_NONE || impl->q_cache_in[i]) continue;
+    CeedCallBackend(CeedCalloc(Q * plan->size, &plan->q_data));
+    if (plan->eval_mode == CEED_EVAL_WEIGHT) {
+      const CeedScalar *q_weight;
+
+      CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_in[i], CEED_MEM_HOST, &q_weight));
+      memcpy(plan->q_data, q_weight, Q * sizeof(CeedScalar));
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_in[i], &q_weight));
+    }
+    CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, plan->q_data));
+    impl->qf_inputs[i] = plan->q_data;
+  }
+  for (CeedInt i = 0; i < impl->num_outputs; i++) {
+    CeedOperatorFieldPlan_Ref *plan = &impl->plan_out[i];
+
+    if (plan->eval_mode == CEED_EVAL_NONE) continue;
+    CeedCallBackend(CeedCalloc(Q * plan->size, &plan->q_data));
+    CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, plan->q_data));
+    impl->qf_outputs[i] = plan->q_data;
+  }
+  impl->qf_user = f;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------/*
 static int CeedOperatorSetup_Ref(CeedOperator op) {
   bool                is_setup_done;
-  CeedInt             Q, num_input_fields, num_output_fields;
+  CeedInt             Q, num_elem, num_input_fields, num_output_fields;
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
   CeedOperatorField  *op_input_fields, *op_output_fields;
@@ -156,6 +347,7 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedCallBackend(CeedQFunctionIsIdentity(qf, &impl->is_identity_qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
@@ -165,23 +357,40 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
 
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_basis_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->fused_basis_in_indices));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_data_out_indices));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->apply_add_basis_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->input_states));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_cache_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->is_q_cache_valid));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->plan_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->plan_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->qf_inputs));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->qf_outputs));
 
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
+  for (CeedInt i = 0; i < CEED_FIELD_MAX; i++) impl->fused_basis_in_indices[i] = -1;
+
+  // Per-field plans
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedOperatorSetupFieldPlan_Ref(qf_input_fields[i], op_input_fields[i], Q, &impl->plan_in[i]));
+  }
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedOperatorSetupFieldPlan_Ref(qf_output_fields[i], op_output_fields[i], Q, &impl->plan_out[i]));
+  }
 
   // Set up infield and outfield e_vecs and q_vecs
   // Infields
-  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, true, impl->skip_rstr_in, NULL, NULL, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0,
-                                              num_input_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, true, impl->skip_rstr_in, impl->skip_basis_in, impl->fused_basis_in_indices, NULL, NULL,
+                                              impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
   // Outfields
-  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, false, impl->skip_rstr_out, impl->e_data_out_indices, impl->apply_add_basis_out,
+  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, false, impl->skip_rstr_out, NULL, NULL, impl->e_data_out_indices, impl->apply_add_basis_out,
                                               impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields, num_output_fields, Q));
 
   // Identity QFunctions
@@ -200,17 +409,47 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
     }
   }
 
+  // Cached passive inputs
+  CeedCallBackend(CeedOperatorSetupQuadratureCache_Ref(num_input_fields, qf_input_fields, op_input_fields, num_elem, Q, impl));
+
+  // Direct QFunction calls
+  CeedCallBackend(CeedOperatorSetupQFunctionUser_Ref(qf, Q, impl));
+
   CeedCallBackend(CeedOperatorSetSetupDone(op));
   CeedCallBackend(CeedQFunctionDestroy(&qf));
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Restrict Active Elements
+//   Element views into the full E-vector are restricted one at a time, data of inactive elements is not touched
+//------------------------------------------------------------------------------
+static inline int CeedOperatorRestrictActiveElements_Ref(CeedElemRestriction elem_rstr, CeedTransposeMode t_mode, CeedVector vec,
+                                                         CeedVector e_vec_full, CeedVector e_vec_elem, CeedInt num_active_elem,
+                                                         const CeedInt *active_elems, CeedRequest *request) {
+  CeedSize    elem_length;
+  CeedScalar *e_data;
+
+  CeedCallBackend(CeedVectorGetLength(e_vec_elem, &elem_length));
+  if (t_mode == CEED_NOTRANSPOSE) CeedCallBackend(CeedVectorGetArrayWrite(e_vec_full, CEED_MEM_HOST, &e_data));
+  else CeedCallBackend(CeedVectorGetArray(e_vec_full, CEED_MEM_HOST, &e_data));
+  for (CeedInt a = 0; a < num_active_elem; a++) {
+    const CeedInt e = active_elems[a];
+
+    CeedCallBackend(CeedVectorSetArray(e_vec_elem, CEED_MEM_HOST, CEED_USE_POINTER, &e_data[(CeedSize)e * elem_length]));
+    if (t_mode == CEED_NOTRANSPOSE) CeedCallBackend(CeedElemRestrictionApplyBlock(elem_rstr, e, CEED_NOTRANSPOSE, vec, e_vec_elem, request));
+    else CeedCallBackend(CeedElemRestrictionApplyBlock(elem_rstr, e, CEED_TRANSPOSE, e_vec_elem, vec, request));
+  }
+  CeedCallBackend(CeedVectorRestoreArray(e_vec_full, &e_data));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator Inputs
 //------------------------------------------------------------------------------
 static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                              CeedVector in_vec, const bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
-                                              CeedOperator_Ref *impl, CeedRequest *request) {
+                                              CeedVector in_vec, const bool skip_active, CeedInt num_active_elem, const CeedInt *active_elems,
+                                              CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl, CeedRequest *request) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
     bool         is_active;
     uint64_t     state;
@@ -231,14 +470,20 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFun
     } else {
       // Restrict
       CeedCallBackend(CeedVectorGetState(vec, &state));
-      // Skip restriction if input is unchanged
+      // Skip restriction if input is unchanged, only active elements of the active input are restricted
       if ((state != impl->input_states[i] || vec == in_vec) && !impl->skip_rstr_in[i]) {
         CeedElemRestriction elem_rstr;
 
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
-        CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        if (is_active && active_elems) {
+          CeedCallBackend(CeedOperatorRestrictActiveElements_Ref(elem_rstr, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], impl->e_vecs_active[i],
+                                                                 num_active_elem, active_elems, request));
+        } else {
+          CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        }
         CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
       }
+      if (impl->is_q_cache_valid && state != impl->input_states[i]) impl->is_q_cache_valid[i] = false;
       impl->input_states[i] = state;
       // Get evec
       CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
@@ -250,46 +495,48 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFun
 
 //------------------------------------------------------------------------------
 // Input Basis Action
+//   Q-vectors only view element data when the QFunction is applied through them
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                             CeedInt num_input_fields, const bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
-                                             CeedOperator_Ref *impl) {
+static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q, CeedInt num_input_fields, const bool skip_active, const bool set_q_vecs,
+                                             CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedInt             elem_size, size, num_comp;
-    CeedEvalMode        eval_mode;
-    CeedElemRestriction elem_rstr;
-    CeedBasis           basis;
+    const CeedOperatorFieldPlan_Ref *plan = &impl->plan_in[i];
+    CeedScalar                      *e_data;
 
     // Skip active input
-    if (skip_active) {
-      bool       is_active;
-      CeedVector vec;
-
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (is_active) continue;
+    if (skip_active && plan->is_active) continue;
+    // Cached passive input, basis action writes into the cache until it is valid
+    if (impl->q_cache_in[i]) {
+      CeedScalar *q_cache = &impl->q_cache_in[i][(CeedSize)e * Q * plan->size];
+
+      impl->qf_inputs[i] = q_cache;
+      if (set_q_vecs || !impl->is_q_cache_valid[i]) {
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, q_cache));
+      }
+      if (impl->is_q_cache_valid[i]) continue;
     }
-    // Get elem_size, eval_mode, size
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
     // Basis action
-    switch (eval_mode) {
+    switch (plan->eval_mode) {
       case CEED_EVAL_NONE:
-        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * size]));
+        e_data             = &e_data_full[i][(CeedSize)e * plan->e_stride];
+        impl->qf_inputs[i] = e_data;
+        if (set_q_vecs) CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data));
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
-        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
-        CeedCallBackend(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
-        CeedCallBackend(CeedBasisDestroy(&basis));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * plan->e_stride]));
+        if (impl->fused_basis_in_indices[i] != -1) {
+          // Interpolation and gradient of the same field share their tensor contractions
+          const CeedInt j         = impl->fused_basis_in_indices[i];
+          const bool    is_interp = plan->eval_mode == CEED_EVAL_INTERP;
+
+          CeedCallBackend(CeedBasisApplyInterpAndGrad(plan->basis, 1, impl->e_vecs_in[i], impl->q_vecs_in[is_interp ? i : j],
+                                                      impl->q_vecs_in[is_interp ? j : i]));
+        } else if (!impl->skip_basis_in[i]) {
+          CeedCallBackend(CeedBasisApply(plan->basis, 1, CEED_NOTRANSPOSE, plan->eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
+        }
         break;
       case CEED_EVAL_WEIGHT:
         break;  // No action
@@ -301,38 +548,26 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunction
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
-                                              CeedInt num_input_fields, CeedInt num_output_fields, bool *apply_add_basis, CeedOperator op,
+static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt num_input_fields, CeedInt num_output_fields, bool *apply_add_basis, CeedOperator op,
                                               CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl) {
   for (CeedInt i = 0; i < num_output_fields; i++) {
-    CeedInt             elem_size, num_comp;
-    CeedEvalMode        eval_mode;
-    CeedElemRestriction elem_rstr;
-    CeedBasis           basis;
+    const CeedOperatorFieldPlan_Ref *plan = &impl->plan_out[i];
 
-    // Get elem_size, eval_mode
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
     // Basis action
-    switch (eval_mode) {
+    switch (plan->eval_mode) {
       case CEED_EVAL_NONE:
         break;  // No action
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
-        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
         CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
-                                           &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * plan->e_stride]));
         if (apply_add_basis[i]) {
-          CeedCallBackend(CeedBasisApplyAdd(basis, 1, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+          CeedCallBackend(CeedBasisApplyAdd(plan->basis, 1, CEED_TRANSPOSE, plan->eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         } else {
-          CeedCallBackend(CeedBasisApply(basis, 1, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+          CeedCallBackend(CeedBasisApply(plan->basis, 1, CEED_TRANSPOSE, plan->eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         }
-        CeedCallBackend(CeedBasisDestroy(&basis));
         break;
       // LCOV_EXCL_START
       case CEED_EVAL_WEIGHT: {
@@ -376,8 +611,9 @@ static inline int CeedOperatorRestoreInputs_Ref(CeedInt num_input_fields, CeedQF
 // Operator Apply
 //------------------------------------------------------------------------------
 static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
-  CeedInt             Q, num_elem, num_input_fields, num_output_fields, size;
-  CeedEvalMode        eval_mode;
+  void               *ctx_data = NULL;
+  CeedInt             Q, num_active_elem, num_input_fields, num_output_fields;
+  const CeedInt      *active_elems;
   CeedScalar         *e_data_full[2 * CEED_FIELD_MAX] = {NULL};
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
@@ -389,27 +625,38 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
 
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedOperatorGetActiveElements(op, &num_active_elem, &active_elems));
 
   // Restriction only operator
   if (impl->is_identity_rstr_op) {
     CeedElemRestriction elem_rstr;
 
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[0], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
+    if (active_elems) {
+      CeedCallBackend(CeedOperatorRestrictActiveElements_Ref(elem_rstr, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], impl->e_vecs_active[0],
+                                                             num_active_elem, active_elems, request));
+    } else {
+      CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
+    }
     CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[0], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    if (active_elems) {
+      CeedCallBackend(CeedOperatorRestrictActiveElements_Ref(elem_rstr, CEED_TRANSPOSE, out_vec, impl->e_vecs_full[0], impl->e_vecs_active[0],
+                                                             num_active_elem, active_elems, request));
+    } else {
+      CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    }
     CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
     return CEED_ERROR_SUCCESS;
   }
 
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, e_data_full, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, num_active_elem, active_elems,
+                                              e_data_full, impl, request));
 
   // Output Evecs
   for (CeedInt i = num_output_fields - 1; i >= 0; i--) {
@@ -420,30 +667,37 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
     }
   }
 
-  // Loop through elements
-  for (CeedInt e = 0; e < num_elem; e++) {
+  // QFunction context for direct calls
+  if (impl->qf_user) CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
+
+  // Loop through active elements
+  for (CeedInt a = 0; a < num_active_elem; a++) {
+    const CeedInt e = active_elems ? active_elems[a] : a;
+
     // Output pointers
     for (CeedInt i = 0; i < num_output_fields; i++) {
-      CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
-      if (eval_mode == CEED_EVAL_NONE) {
-        CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
-        CeedCallBackend(
-            CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][(CeedSize)e * Q * size]));
+      if (impl->plan_out[i].eval_mode == CEED_EVAL_NONE) {
+        CeedScalar *e_data = &e_data_full[i + num_input_fields][(CeedSize)e * impl->plan_out[i].e_stride];
+
+        if (impl->qf_user) impl->qf_outputs[i] = e_data;
+        else CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data));
       }
     }
 
     // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, false, e_data_full, impl));
+    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, num_input_fields, false, !impl->qf_user, e_data_full, impl));
 
     // Q function
-    if (!impl->is_identity_qf) {
+    if (impl->qf_user) {
+      CeedCallBackend(impl->qf_user(ctx_data, Q, impl->qf_inputs, impl->qf_outputs));
+    } else if (!impl->is_identity_qf) {
       CeedCallBackend(CeedQFunctionApply(qf, Q, impl->q_vecs_in, impl->q_vecs_out));
     }
 
     // Output basis apply
-    CeedCallBackend(CeedOperatorOutputBasis_Ref(e, Q, qf_output_fields, op_output_fields, num_input_fields, num_output_fields,
-                                                impl->apply_add_basis_out, op, e_data_full, impl));
+    CeedCallBackend(CeedOperatorOutputBasis_Ref(e, num_input_fields, num_output_fields, impl->apply_add_basis_out, op, e_data_full, impl));
   }
+  if (impl->qf_user) CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
 
   // Output restriction
   for (CeedInt i = 0; i < num_output_fields; i++) {
@@ -459,13 +713,23 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
     // Active
     is_active = vec == CEED_VECTOR_ACTIVE;
     if (is_active) vec = out_vec;
-    // Restrict
+    // Restrict, only active elements
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
+    if (active_elems) {
+      CeedCallBackend(CeedOperatorRestrictActiveElements_Ref(elem_rstr, CEED_TRANSPOSE, vec, impl->e_vecs_full[i + impl->num_inputs],
+                                                             impl->e_vecs_active[i + impl->num_inputs], num_active_elem, active_elems, request));
+    } else {
+      CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
+    }
     if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
     CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
   }
 
+  // Cached quadrature point values are complete once all elements are visited
+  if (!active_elems) {
+    for (CeedInt i = 0; i < num_input_fields; i++) impl->is_q_cache_valid[i] = impl->q_cache_in[i] != NULL;
+  }
+
   // Restore input arrays
   CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, false, e_data_full, impl));
   CeedCallBackend(CeedQFunctionDestroy(&qf));
@@ -502,7 +766,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
   CeedCheck(!impl->is_identity_rstr_op, CeedOperatorReturnCeed(op), CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data_full, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, 0, NULL, e_data_full, impl, request));
 
   // Count number of active input fields
   if (qf_size_in == 0) {
@@ -561,7 +825,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
   // Loop through elements
   for (CeedInt e = 0; e < num_elem; e++) {
     // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, true, e_data_full, impl));
+    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, num_input_fields, true, true, e_data_full, impl));
 
     // Assemble QFunction
 
@@ -638,6 +902,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
       // Check if active output
       if (vec == CEED_VECTOR_ACTIVE && num_elem > 0) {
         CeedCallBackend(CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL));
+        // Restore operator owned array used by direct QFunction calls
+        if (impl->plan_out[out].q_data) {
+          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, impl->plan_out[out].q_data));
+        }
       }
       CeedCallBackend(CeedVectorDestroy(&vec));
     }
@@ -706,6 +974,8 @@ static int CeedOperatorSetupFieldsAtPoints_Ref(CeedQFunction qf, CeedOperator op
     CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr_points, &dim));
     CeedCallBackend(CeedElemRestrictionDestroy(&rstr_points));
     CeedCallBackend(CeedOperatorGetData(op, &impl));
+    // -- Keep any extra capacity requested for moving points
+    max_num_points = CeedIntMax(max_num_points, impl->max_num_points);
     if (is_input) {
       CeedCallBackend(CeedVectorCreate(ceed, dim * max_num_points, &impl->point_coords_elem));
       CeedCallBackend(CeedVectorSetValue(impl->point_coords_elem, 0.0));
@@ -826,21 +1096,92 @@ static int CeedOperatorSetupFieldsAtPoints_Ref(CeedQFunction qf, CeedOperator op
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Update Setup for Moved Points
+//------------------------------------------------------------------------------
+static int CeedOperatorUpdatePointsAtPoints_Ref(CeedOperator op, uint64_t points_state, bool *is_updated) {
+  CeedInt             max_num_points, num_input_fields, num_output_fields;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedElemRestriction rstr_points = NULL;
+  CeedOperator_Ref   *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, NULL));
+  CeedCallBackend(CeedElemRestrictionGetMaxPointsInElement(rstr_points, &max_num_points));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_points));
+
+  // Rebuild with headroom when single element vectors are too short
+  *is_updated = max_num_points <= impl->max_num_points;
+  if (!*is_updated) {
+    CeedCallBackend(CeedOperatorSetupFree_Ref(impl));
+    impl->max_num_points = 2 * max_num_points;
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Grow full E-vectors for fields at points, shared E-vectors are replaced together
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    bool                is_at_points = false;
+    CeedSize            e_size, length;
+    CeedElemRestriction elem_rstr;
+    CeedOperatorField   op_field = i < num_input_fields ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+
+    if (!impl->e_vecs_full[i]) continue;
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_field, &elem_rstr));
+    CeedCallBackend(CeedElemRestrictionIsAtPoints(elem_rstr, &is_at_points));
+    CeedCallBackend(CeedElemRestrictionGetEVectorSize(elem_rstr, &e_size));
+    CeedCallBackend(CeedVectorGetLength(impl->e_vecs_full[i], &length));
+    if (is_at_points && length < e_size) {
+      CeedVector e_vec_old = NULL, e_vec_new = NULL;
+
+      CeedCallBackend(CeedVectorReferenceCopy(impl->e_vecs_full[i], &e_vec_old));
+      CeedCallBackend(CeedElemRestrictionCreateVector(elem_rstr, NULL, &e_vec_new));
+      CeedCallBackend(CeedVectorSetValue(e_vec_new, 0.0));
+      for (CeedInt j = i; j < num_input_fields + num_output_fields; j++) {
+        if (impl->e_vecs_full[j] == e_vec_old) CeedCallBackend(CeedVectorReferenceCopy(e_vec_new, &impl->e_vecs_full[j]));
+      }
+      CeedCallBackend(CeedVectorDestroy(&e_vec_old));
+      CeedCallBackend(CeedVectorDestroy(&e_vec_new));
+    }
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+  }
+
+  // Passive inputs must be restricted again
+  for (CeedInt i = 0; i < num_input_fields; i++) impl->input_states[i] = (uint64_t)-1;
+  impl->points_state = points_state;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupAtPoints_Ref(CeedOperator op) {
   bool                is_setup_done;
+  uint64_t            points_state;
   CeedInt             Q, num_input_fields, num_output_fields;
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
   CeedOperatorField  *op_input_fields, *op_output_fields;
   CeedOperator_Ref   *impl;
 
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  {
+    CeedElemRestriction rstr_points = NULL;
+
+    CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, NULL));
+    CeedCallBackend(CeedElemRestrictionGetAtPointsState(rstr_points, &points_state));
+    CeedCallBackend(CeedElemRestrictionDestroy(&rstr_points));
+  }
   CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
-  if (is_setup_done) return CEED_ERROR_SUCCESS;
+  if (is_setup_done) {
+    bool is_updated;
+
+    if (points_state == impl->points_state) return CEED_ERROR_SUCCESS;
+    CeedCallBackend(CeedOperatorUpdatePointsAtPoints_Ref(op, points_state, &is_updated));
+    if (is_updated) return CEED_ERROR_SUCCESS;
+  }
+  impl->points_state = points_state;
 
-  CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
   CeedCallBackend(CeedQFunctionIsIdentity(qf, &impl->is_identity_qf));
@@ -1037,7 +1378,7 @@ static int CeedOperatorApplyAddAtPoints_Ref(CeedOperator op, CeedVector in_vec,
   CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, &point_coords));
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, 0, NULL, e_data, impl, request));
 
   // Loop through elements
   for (CeedInt e = 0; e < num_elem; e++) {
@@ -1109,7 +1450,7 @@ static inline int CeedOperatorLinearAssembleQFunctionAtPointsCore_Ref(CeedOperat
   CeedCallBackend(CeedElemRestrictionGetMaxPointsInElement(rstr_points, &max_num_points));
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data_full, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, 0, NULL, e_data_full, impl, request));
 
   // Count number of active input fields
   if (qf_size_in == 0) {
@@ -1373,7 +1714,7 @@ static int CeedOperatorLinearAssembleAddDiagonalAtPoints_Ref(CeedOperator op, Ce
   }
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, 0, NULL, e_data, impl, request));
 
   // Loop through elements
   for (CeedInt e = 0; e < num_elem; e++) {
@@ -1553,41 +1894,386 @@ static int CeedOperatorLinearAssembleAddDiagonalAtPoints_Ref(CeedOperator op, Ce
 }
 
 //------------------------------------------------------------------------------
-// Operator Destroy
+// Composite Operator Sub-Operator Access
+//   Objects with backend state count as written; only passive input vectors and point coordinates are read-only
 //------------------------------------------------------------------------------
-static int CeedOperatorDestroy_Ref(CeedOperator op) {
-  CeedOperator_Ref *impl;
+static int CeedCompositeOperatorGetAccess_Ref(CeedOperator op, CeedInt *num_access, CeedOperatorAccess_Ref **access) {
+  bool                 is_at_points;
+  CeedInt              num_input_fields, num_output_fields;
+  CeedOperatorField   *op_input_fields, *op_output_fields;
+  CeedQFunction        qf;
+  CeedQFunctionContext ctx;
+
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedRealloc(5 + 3 * (num_input_fields + num_output_fields), access));
+  *num_access                = 0;
+  (*access)[(*num_access)++] = (CeedOperatorAccess_Ref){op, true};
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  (*access)[(*num_access)++] = (CeedOperatorAccess_Ref){qf, true};
+  CeedCallBackend(CeedQFunctionGetContext(qf, &ctx));
+  if (ctx) (*access)[(*num_access)++] = (CeedOperatorAccess_Ref){ctx, true};
+  CeedCallBackend(CeedQFunctionContextDestroy(&ctx));
+  CeedCallBackend(CeedQFunctionDestroy(&qf));
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    const bool          is_input = i < num_input_fields;
+    CeedElemRestriction elem_rstr;
+    CeedBasis           basis;
+    CeedVector          vec;
+
+    CeedCallBackend(
+        CeedOperatorFieldGetData(is_input ? op_input_fields[i] : op_output_fields[i - num_input_fields], NULL, &elem_rstr, &basis, &vec));
+    if (elem_rstr != CEED_ELEMRESTRICTION_NONE) (*access)[(*num_access)++] = (CeedOperatorAccess_Ref){elem_rstr, true};
+    if (basis != CEED_BASIS_NONE) (*access)[(*num_access)++] = (CeedOperatorAccess_Ref){basis, true};
+    if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) (*access)[(*num_access)++] = (CeedOperatorAccess_Ref){vec, !is_input};
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+    CeedCallBackend(CeedBasisDestroy(&basis));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+  CeedCallBackend(CeedOperatorIsAtPoints(op, &is_at_points));
+  if (is_at_points) {
+    CeedElemRestriction rstr_points;
+    CeedVector          point_coords;
+
+    CeedCallBackend(CeedOperatorAtPointsGetPoints(op, &rstr_points, &point_coords));
+    (*access)[(*num_access)++] = (CeedOperatorAccess_Ref){rstr_points, true};
+    (*access)[(*num_access)++] = (CeedOperatorAccess_Ref){point_coords, false};
+    CeedCallBackend(CeedElemRestrictionDestroy(&rstr_points));
+    CeedCallBackend(CeedVectorDestroy(&point_coords));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Sub-Operator Conflict
+//------------------------------------------------------------------------------
+static bool CeedCompositeOperatorHasConflict_Ref(CeedInt num_access_a, const CeedOperatorAccess_Ref *access_a, CeedInt num_access_b,
+                                                 const CeedOperatorAccess_Ref *access_b) {
+  for (CeedInt i = 0; i < num_access_a; i++) {
+    for (CeedInt j = 0; j < num_access_b; j++) {
+      if (access_a[i].object == access_b[j].object && (access_a[i].is_write || access_b[j].is_write)) return true;
+    }
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Coloring
+//   Greedy coloring, sub-operators in one color share no object that any of them writes
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorSetupColors_Ref(CeedOperator op, CeedOperatorComposite_Ref *impl) {
+  CeedInt                 num_sub_ops, num_read_vecs = 0, colors[CEED_COMPOSITE_MAX], num_access[CEED_COMPOSITE_MAX] = {0};
+  CeedOperator           *sub_ops;
+  CeedOperatorAccess_Ref *access[CEED_COMPOSITE_MAX] = {NULL};
+
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub_ops));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_ops));
+  impl->num_colors     = 0;
+  impl->max_color_size = 0;
+  for (CeedInt c = 0; c <= CEED_COMPOSITE_MAX; c++) impl->color_offsets[c] = 0;
+  for (CeedInt i = 0; i < num_sub_ops; i++) {
+    bool is_color_used[CEED_COMPOSITE_MAX] = {false};
+
+    CeedCallBackend(CeedCompositeOperatorGetAccess_Ref(sub_ops[i], &num_access[i], &access[i]));
+    for (CeedInt j = 0; j < i; j++) {
+      if (CeedCompositeOperatorHasConflict_Ref(num_access[i], access[i], num_access[j], access[j])) is_color_used[colors[j]] = true;
+    }
+    for (colors[i] = 0; is_color_used[colors[i]]; colors[i]++) continue;
+    impl->num_colors     = CeedIntMax(impl->num_colors, colors[i] + 1);
+    impl->max_color_size = CeedIntMax(impl->max_color_size, ++impl->color_offsets[colors[i] + 1]);
+  }
+  for (CeedInt c = 0; c < impl->num_colors; c++) impl->color_offsets[c + 1] += impl->color_offsets[c];
+
+  // Group sub-operators and their read-only passive vectors by color
+  {
+    CeedInt num_access_total = 0, color_sizes[CEED_COMPOSITE_MAX] = {0};
+
+    for (CeedInt i = 0; i < num_sub_ops; i++) num_access_total += num_access[i];
+    CeedCallBackend(CeedFree(&impl->color_read_vecs));
+    CeedCallBackend(CeedFree(&impl->color_read_offsets));
+    CeedCallBackend(CeedCalloc(num_access_total, &impl->color_read_vecs));
+    CeedCallBackend(CeedCalloc(impl->num_colors + 1, &impl->color_read_offsets));
+    for (CeedInt c = 0; c < impl->num_colors; c++) {
+      for (CeedInt i = 0; i < num_sub_ops; i++) {
+        if (colors[i] != c) continue;
+        impl->color_sub_ops[impl->color_offsets[c] + color_sizes[c]++] = sub_ops[i];
+        for (CeedInt j = 0; j < num_access[i]; j++) {
+          bool is_new = !access[i][j].is_write;
+
+          for (CeedInt k = impl->color_read_offsets[c]; k < num_read_vecs && is_new; k++) is_new = impl->color_read_vecs[k] != access[i][j].object;
+          if (is_new) impl->color_read_vecs[num_read_vecs++] = (CeedVector)access[i][j].object;
+        }
+      }
+      impl->color_read_offsets[c + 1] = num_read_vecs;
+    }
+  }
+  for (CeedInt i = 0; i < num_sub_ops; i++) CeedCallBackend(CeedFree(&access[i]));
+
+  // Record states, so the coloring is rebuilt once the composite or any sub-operator changes
+  CeedCallBackend(CeedOperatorGetState(op, &impl->colored_states[0]));
+  for (CeedInt i = 0; i < num_sub_ops; i++) CeedCallBackend(CeedOperatorGetState(sub_ops[i], &impl->colored_states[i + 1]));
+  impl->is_colored = true;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Check Coloring Matches Current Sub-Operators
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorIsColoringCurrent_Ref(CeedOperator op, CeedOperatorComposite_Ref *impl, bool *is_current) {
+  CeedInt       num_sub_ops;
+  uint64_t      state;
+  CeedOperator *sub_ops;
+
+  *is_current = impl->is_colored;
+  if (!*is_current) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedOperatorGetState(op, &state));
+  *is_current = state == impl->colored_states[0];
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub_ops));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_ops));
+  for (CeedInt i = 0; i < num_sub_ops && *is_current; i++) {
+    CeedCallBackend(CeedOperatorGetState(sub_ops[i], &state));
+    *is_current = state == impl->colored_states[i + 1];
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply Color on Thread
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorApplyColor_Ref(CeedOperatorComposite_Ref *impl, CeedInt id) {
+  for (CeedInt i = id; i < impl->num_sub_ops_color; i += impl->num_threads) {
+    CeedCallBackend(CeedOperatorApplyAdd(impl->sub_ops_color[i], impl->in_vec, impl->out_vecs[id], CEED_REQUEST_IMMEDIATE));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Pool Thread
+//------------------------------------------------------------------------------
+static void *CeedCompositeOperatorThreadRun_Ref(void *data) {
+  uint64_t                         generation = 0;
+  CeedOperatorCompositeThread_Ref *thread     = data;
+  CeedOperatorComposite_Ref       *impl       = thread->impl;
+
+  pthread_mutex_lock(&impl->mutex);
+  while (true) {
+    int error;
+
+    while (impl->generation == generation && !impl->is_stopping) pthread_cond_wait(&impl->cond_start, &impl->mutex);
+    if (impl->is_stopping) break;
+    generation = impl->generation;
+    pthread_mutex_unlock(&impl->mutex);
+    error = CeedCompositeOperatorApplyColor_Ref(impl, thread->id);
+    pthread_mutex_lock(&impl->mutex);
+    if (error && !impl->error) impl->error = error;
+    if (--impl->num_busy == 0) pthread_cond_signal(&impl->cond_done);
+  }
+  pthread_mutex_unlock(&impl->mutex);
+  return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Pool Destroy
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorThreadsDestroy_Ref(CeedOperatorComposite_Ref *impl) {
+  pthread_mutex_lock(&impl->mutex);
+  impl->is_stopping = true;
+  pthread_cond_broadcast(&impl->cond_start);
+  pthread_mutex_unlock(&impl->mutex);
+  for (CeedInt i = 1; i < impl->num_threads; i++) pthread_join(impl->pthreads[i], NULL);
+  impl->is_stopping = false;
+  for (CeedInt i = 1; i < impl->num_threads; i++) CeedCallBackend(CeedVectorDestroy(&impl->out_vecs[i]));
+  CeedCallBackend(CeedFree(&impl->out_vecs));
+  CeedCallBackend(CeedFree(&impl->pthreads));
+  CeedCallBackend(CeedFree(&impl->threads));
+  impl->num_threads = 0;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Pool Create
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorThreadsCreate_Ref(CeedOperator op, CeedOperatorComposite_Ref *impl, CeedInt num_threads) {
+  CeedCallBackend(CeedCalloc(num_threads, &impl->threads));
+  CeedCallBackend(CeedCalloc(num_threads, &impl->pthreads));
+  CeedCallBackend(CeedCalloc(num_threads, &impl->out_vecs));
+  impl->generation = 0;
+  for (CeedInt i = 1; i < num_threads; i++) {
+    impl->threads[i] = (CeedOperatorCompositeThread_Ref){impl, i};
+    if (pthread_create(&impl->pthreads[i], NULL, CeedCompositeOperatorThreadRun_Ref, &impl->threads[i])) {
+      // LCOV_EXCL_START
+      impl->num_threads = i;
+      CeedCallBackend(CeedCompositeOperatorThreadsDestroy_Ref(impl));
+      return CeedError(CeedOperatorReturnCeed(op), CEED_ERROR_BACKEND, "Unable to start threads for concurrent sub-operators");
+      // LCOV_EXCL_STOP
+    }
+  }
+  impl->num_threads = num_threads;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddComposite_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool                       is_concurrent = false;
+  CeedInt                    num_threads, num_sub_ops;
+  CeedOperator              *sub_ops;
+  CeedOperatorComposite_Ref *impl;
 
   CeedCallBackend(CeedOperatorGetData(op, &impl));
-  CeedCallBackend(CeedFree(&impl->skip_rstr_in));
-  CeedCallBackend(CeedFree(&impl->skip_rstr_out));
-  CeedCallBackend(CeedFree(&impl->e_data_out_indices));
-  CeedCallBackend(CeedFree(&impl->apply_add_basis_out));
-  for (CeedInt i = 0; i < impl->num_inputs + impl->num_outputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
+  CeedCallBackend(CeedCompositeOperatorGetNumThreads(op, &num_threads));
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub_ops));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_ops));
+
+  // Sub-operators are set up one at a time on their first application
+  if (num_threads > 1) {
+    is_concurrent = true;
+    for (CeedInt i = 0; i < num_sub_ops && is_concurrent; i++) CeedCallBackend(CeedOperatorIsSetupDone(sub_ops[i], &is_concurrent));
   }
-  CeedCallBackend(CeedFree(&impl->e_vecs_full));
-  CeedCallBackend(CeedFree(&impl->input_states));
 
-  for (CeedInt i = 0; i < impl->num_inputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i]));
+  // Coloring is kept until sub-operators are added or their fields or points change
+  if (is_concurrent) {
+    bool is_coloring_current;
+
+    CeedCallBackend(CeedCompositeOperatorIsColoringCurrent_Ref(op, impl, &is_coloring_current));
+    if (!is_coloring_current) CeedCallBackend(CeedCompositeOperatorSetupColors_Ref(op, impl));
+    is_concurrent = impl->num_colors < num_sub_ops;
   }
-  CeedCallBackend(CeedFree(&impl->e_vecs_in));
-  CeedCallBackend(CeedFree(&impl->q_vecs_in));
 
-  for (CeedInt i = 0; i < impl->num_outputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i]));
+  // Apply sub-operators in order
+  if (!is_concurrent) {
+    for (CeedInt i = 0; i < num_sub_ops; i++) CeedCallBackend(CeedOperatorApplyAdd(sub_ops[i], in_vec, out_vec, request));
+    return CEED_ERROR_SUCCESS;
   }
-  CeedCallBackend(CeedFree(&impl->e_vecs_out));
-  CeedCallBackend(CeedFree(&impl->q_vecs_out));
-  CeedCallBackend(CeedVectorDestroy(&impl->point_coords_elem));
 
+  // Pool and private active outputs
+  num_threads = CeedIntMin(num_threads, impl->max_color_size);
+  if (impl->num_threads != num_threads) {
+    CeedCallBackend(CeedCompositeOperatorThreadsDestroy_Ref(impl));
+    CeedCallBackend(CeedCompositeOperatorThreadsCreate_Ref(op, impl, num_threads));
+  }
+  impl->in_vec      = in_vec;
+  impl->out_vecs[0] = out_vec;
+  for (CeedInt i = 1; i < num_threads; i++) {
+    if (out_vec == CEED_VECTOR_NONE) {
+      CeedCallBackend(CeedVectorDestroy(&impl->out_vecs[i]));
+      impl->out_vecs[i] = CEED_VECTOR_NONE;
+    } else {
+      CeedSize length, length_private = -1;
+
+      CeedCallBackend(CeedVectorGetLength(out_vec, &length));
+      if (impl->out_vecs[i] && impl->out_vecs[i] != CEED_VECTOR_NONE) CeedCallBackend(CeedVectorGetLength(impl->out_vecs[i], &length_private));
+      if (length_private != length) {
+        CeedCallBackend(CeedVectorDestroy(&impl->out_vecs[i]));
+        CeedCallBackend(CeedVectorCreate(CeedVectorReturnCeed(out_vec), length, &impl->out_vecs[i]));
+      }
+      CeedCallBackend(CeedVectorSetValue(impl->out_vecs[i], 0.0));
+    }
+  }
+
+  // Apply each color on the pool
+  for (CeedInt c = 0; c < impl->num_colors; c++) {
+    int               error;
+    const CeedInt     num_read_vecs = impl->color_read_offsets[c + 1] - impl->color_read_offsets[c];
+    CeedVector       *read_vecs     = &impl->color_read_vecs[impl->color_read_offsets[c]];
+    const CeedScalar *in_array      = NULL, *read_arrays[num_read_vecs > 0 ? num_read_vecs : 1];
+
+    // Shared inputs are accessed before launch, so threads only take additional read access
+    if (in_vec != CEED_VECTOR_NONE) CeedCallBackend(CeedVectorGetArrayRead(in_vec, CEED_MEM_HOST, &in_array));
+    for (CeedInt i = 0; i < num_read_vecs; i++) CeedCallBackend(CeedVectorGetArrayRead(read_vecs[i], CEED_MEM_HOST, &read_arrays[i]));
+
+    // Launch
+    pthread_mutex_lock(&impl->mutex);
+    impl->sub_ops_color     = &impl->color_sub_ops[impl->color_offsets[c]];
+    impl->num_sub_ops_color = impl->color_offsets[c + 1] - impl->color_offsets[c];
+    impl->num_busy          = num_threads - 1;
+    impl->generation++;
+    pthread_cond_broadcast(&impl->cond_start);
+    pthread_mutex_unlock(&impl->mutex);
+    error = CeedCompositeOperatorApplyColor_Ref(impl, 0);
+    pthread_mutex_lock(&impl->mutex);
+    while (impl->num_busy > 0) pthread_cond_wait(&impl->cond_done, &impl->mutex);
+    if (!error) error = impl->error;
+    impl->error = CEED_ERROR_SUCCESS;
+    pthread_mutex_unlock(&impl->mutex);
+
+    for (CeedInt i = 0; i < num_read_vecs; i++) CeedCallBackend(CeedVectorRestoreArrayRead(read_vecs[i], &read_arrays[i]));
+    if (in_vec != CEED_VECTOR_NONE) CeedCallBackend(CeedVectorRestoreArrayRead(in_vec, &in_array));
+    CeedCallBackend(error);
+  }
+
+  // Sum private active outputs
+  if (out_vec != CEED_VECTOR_NONE) {
+    for (CeedInt i = 1; i < num_threads; i++) CeedCallBackend(CeedVectorAXPY(out_vec, 1.0, impl->out_vecs[i]));
+  }
+  impl->in_vec      = NULL;
+  impl->out_vecs[0] = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyComposite_Ref(CeedOperator op) {
+  CeedOperatorComposite_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedCompositeOperatorThreadsDestroy_Ref(impl));
+  pthread_mutex_destroy(&impl->mutex);
+  pthread_cond_destroy(&impl->cond_start);
+  pthread_cond_destroy(&impl->cond_done);
+  CeedCallBackend(CeedFree(&impl->color_read_offsets));
+  CeedCallBackend(CeedFree(&impl->color_read_vecs));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Ref(CeedOperator op) {
+  CeedOperator_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorSetupFree_Ref(impl));
+  for (CeedInt i = 0; i < 2 * CEED_FIELD_MAX; i++) CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_active[i]));
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Set Active Elements
+//   Element views into full E-vectors let the active elements be restricted one at a time
+//------------------------------------------------------------------------------
+static int CeedOperatorSetActiveElements_Ref(CeedOperator op) {
+  CeedInt            num_active_elem, num_input_fields, num_output_fields;
+  const CeedInt     *active_elems;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  CeedOperator_Ref  *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetActiveElements(op, &num_active_elem, &active_elems));
+  if (!active_elems) return CEED_ERROR_SUCCESS;
+
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    CeedElemRestriction elem_rstr;
+
+    if (impl->e_vecs_active[i]) continue;
+    CeedCallBackend(
+        CeedOperatorFieldGetElemRestriction(i < num_input_fields ? op_input_fields[i] : op_output_fields[i - num_input_fields], &elem_rstr));
+    if (elem_rstr != CEED_ELEMRESTRICTION_NONE) {
+      CeedInt elem_size, num_comp;
+
+      CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(elem_rstr, &num_comp));
+      CeedCallBackend(CeedVectorCreate(CeedOperatorReturnCeed(op), (CeedSize)elem_size * num_comp, &impl->e_vecs_active[i]));
+    }
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Create
 //------------------------------------------------------------------------------
@@ -1601,6 +2287,7 @@ int CeedOperatorCreate_Ref(CeedOperator op) {
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "SetActiveElements", CeedOperatorSetActiveElements_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Ref));
   CeedCallBackend(CeedDestroy(&ceed));
   return CEED_ERROR_SUCCESS;
@@ -1627,3 +2314,22 @@ int CeedOperatorCreateAtPoints_Ref(CeedOperator op) {
 }
 
 //------------------------------------------------------------------------------
+// Composite Operator Create
+//------------------------------------------------------------------------------
+int CeedCompositeOperatorCreate_Ref(CeedOperator op) {
+  Ceed                       ceed;
+  CeedOperatorComposite_Ref *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedCalloc(1, &impl));
+  pthread_mutex_init(&impl->mutex, NULL);
+  pthread_cond_init(&impl->cond_start, NULL);
+  pthread_cond_init(&impl->cond_done, NULL);
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite", CeedOperatorApplyAddComposite_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroyComposite_Ref));
+  CeedCallBackend(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -69,6 +69,7 @@ int CeedQFunctionCreate_Ref(CeedQFunction qf) {
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->inputs));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->outputs));
   CeedCallBackend(CeedQFunctionSetData(qf, impl));
+  CeedCallBackend(CeedQFunctionSetUserFunctionDirect(qf, true));
   CeedCallBackend(CeedSetBackendFunction(ceed, "QFunction", qf, "Apply", CeedQFunctionApply_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "QFunction", qf, "Destroy", CeedQFunctionDestroy_Ref));
   CeedCallBackend(CeedDestroy(&ceed));
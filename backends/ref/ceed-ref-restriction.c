@@ -74,6 +74,77 @@ static inline int CeedElemRestrictionApplyOffsetNoTranspose_Ref_Core(CeedElemRes
   return CEED_ERROR_SUCCESS;
 }
 
+static inline int CeedElemRestrictionApplyCompressedNoTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
+                                                                         const CeedInt comp_stride, CeedInt start, CeedInt stop, CeedInt num_elem,
+                                                                         CeedInt elem_size, CeedSize v_offset, const CeedScalar *__restrict__ uu,
+                                                                         CeedScalar *__restrict__ vv) {
+  // Default restriction with compressed offsets
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+    const CeedInt *__restrict__ base   = &impl->offsets_base[e];
+    const uint16_t *__restrict__ local = &impl->offsets_local[e * elem_size];
+
+    CeedPragmaSIMD for (CeedSize k = 0; k < num_comp; k++) {
+      for (CeedSize n = 0; n < elem_size; n++) {
+        CeedPragmaSIMD for (CeedSize j = 0; j < block_size; j++) {
+          vv[elem_size * (k * block_size + e * num_comp) + n * block_size + j - v_offset] =
+              uu[base[j] + local[n * block_size + j] + k * comp_stride];
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+static inline int CeedElemRestrictionApplyStructuredNoTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
+                                                                         const CeedInt comp_stride, CeedInt start, CeedInt stop, CeedInt num_elem,
+                                                                         CeedInt elem_size, CeedSize v_offset, const CeedScalar *__restrict__ uu,
+                                                                         CeedScalar *__restrict__ vv) {
+  // Structured grid restriction, offsets computed from the element position in the grid
+  bool    is_periodic[3];
+  CeedInt dim, num_elem_1d[3], P_1d, node_stride, num_nodes_1d[3], p[3];
+
+  CeedCallBackend(CeedElemRestrictionGetStructure(rstr, &dim, num_elem_1d, &P_1d, is_periodic, &node_stride));
+  for (CeedInt d = 0; d < 3; d++) {
+    p[d]            = d < dim ? P_1d : 1;
+    num_nodes_1d[d] = d < dim ? num_elem_1d[d] * (P_1d - 1) + !is_periodic[d] : 1;
+  }
+  for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+    for (CeedSize j = 0; j < block_size; j++) {
+      const CeedInt elem = CeedIntMin(e + j, num_elem - 1);
+      const CeedInt x_0 = (elem % num_elem_1d[0]) * (P_1d - 1), y_0 = ((elem / num_elem_1d[0]) % num_elem_1d[1]) * (P_1d - 1),
+                    z_0    = (elem / (num_elem_1d[0] * num_elem_1d[1])) * (P_1d - 1);
+      const bool    wrap_x = x_0 + p[0] > num_nodes_1d[0];
+
+      for (CeedSize k = 0; k < num_comp; k++) {
+        const CeedScalar *__restrict__ uu_k = &uu[k * comp_stride];
+        CeedScalar *__restrict__ vv_k       = &vv[e * elem_size * num_comp + k * elem_size * block_size + j - v_offset];
+
+        for (CeedInt n_z = 0; n_z < p[2]; n_z++) {
+          for (CeedInt n_y = 0; n_y < p[1]; n_y++) {
+            const CeedSize row   = ((CeedSize)((z_0 + n_z) % num_nodes_1d[2]) * num_nodes_1d[1] + (y_0 + n_y) % num_nodes_1d[1]) * num_nodes_1d[0];
+            const CeedInt  n_row = (n_z * p[1] + n_y) * p[0];
+
+            if (wrap_x) {
+              for (CeedInt n_x = 0; n_x < p[0]; n_x++) {
+                vv_k[(n_row + n_x) * block_size] = uu_k[(row + (x_0 + n_x) % num_nodes_1d[0]) * node_stride];
+              }
+            } else {
+              // Contiguous in the L-vector along the first direction
+              CeedPragmaSIMD for (CeedInt n_x = 0; n_x < p[0]; n_x++) {
+                vv_k[(n_row + n_x) * block_size] = uu_k[(row + x_0 + n_x) * node_stride];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 static inline int CeedElemRestrictionApplyOrientedNoTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                                        const CeedInt comp_stride, CeedInt start, CeedInt stop, CeedInt num_elem,
                                                                        CeedInt elem_size, CeedSize v_offset, const CeedScalar *__restrict__ uu,
@@ -241,6 +312,75 @@ static inline int CeedElemRestrictionApplyOffsetTranspose_Ref_Core(CeedElemRestr
   return CEED_ERROR_SUCCESS;
 }
 
+static inline int CeedElemRestrictionApplyCompressedTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
+                                                                       const CeedInt comp_stride, CeedInt start, CeedInt stop, CeedInt num_elem,
+                                                                       CeedInt elem_size, CeedSize v_offset, const CeedScalar *__restrict__ uu,
+                                                                       CeedScalar *__restrict__ vv) {
+  // Default restriction with compressed offsets
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+    const CeedInt *__restrict__ base   = &impl->offsets_base[e];
+    const uint16_t *__restrict__ local = &impl->offsets_local[e * elem_size];
+
+    for (CeedSize k = 0; k < num_comp; k++) {
+      for (CeedSize n = 0; n < elem_size; n++) {
+        // Iteration bound set to discard padding elements
+        for (CeedSize j = 0; j < CeedIntMin(block_size, num_elem - e); j++) {
+          CeedScalar vv_loc;
+
+          vv_loc = uu[elem_size * (k * block_size + e * num_comp) + n * block_size + j - v_offset];
+          CeedPragmaAtomic vv[base[j] + local[n * block_size + j] + k * comp_stride] += vv_loc;
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+static inline int CeedElemRestrictionApplyStructuredTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
+                                                                       const CeedInt comp_stride, CeedInt start, CeedInt stop, CeedInt num_elem,
+                                                                       CeedInt elem_size, CeedSize v_offset, const CeedScalar *__restrict__ uu,
+                                                                       CeedScalar *__restrict__ vv) {
+  // Structured grid restriction, offsets computed from the element position in the grid
+  bool    is_periodic[3];
+  CeedInt dim, num_elem_1d[3], P_1d, node_stride, num_nodes_1d[3], p[3];
+
+  CeedCallBackend(CeedElemRestrictionGetStructure(rstr, &dim, num_elem_1d, &P_1d, is_periodic, &node_stride));
+  for (CeedInt d = 0; d < 3; d++) {
+    p[d]            = d < dim ? P_1d : 1;
+    num_nodes_1d[d] = d < dim ? num_elem_1d[d] * (P_1d - 1) + !is_periodic[d] : 1;
+  }
+  for (CeedSize e = start * block_size; e < stop * block_size; e += block_size) {
+    // Iteration bound set to discard padding elements
+    for (CeedSize j = 0; j < CeedIntMin(block_size, num_elem - e); j++) {
+      const CeedInt elem = e + j;
+      const CeedInt x_0 = (elem % num_elem_1d[0]) * (P_1d - 1), y_0 = ((elem / num_elem_1d[0]) % num_elem_1d[1]) * (P_1d - 1),
+                    z_0 = (elem / (num_elem_1d[0] * num_elem_1d[1])) * (P_1d - 1);
+
+      for (CeedSize k = 0; k < num_comp; k++) {
+        const CeedScalar *__restrict__ uu_k = &uu[e * elem_size * num_comp + k * elem_size * block_size + j - v_offset];
+        CeedScalar *__restrict__ vv_k       = &vv[k * comp_stride];
+
+        for (CeedInt n_z = 0; n_z < p[2]; n_z++) {
+          for (CeedInt n_y = 0; n_y < p[1]; n_y++) {
+            const CeedSize row   = ((CeedSize)((z_0 + n_z) % num_nodes_1d[2]) * num_nodes_1d[1] + (y_0 + n_y) % num_nodes_1d[1]) * num_nodes_1d[0];
+            const CeedInt  n_row = (n_z * p[1] + n_y) * p[0];
+
+            for (CeedInt n_x = 0; n_x < p[0]; n_x++) {
+              CeedScalar vv_loc = uu_k[(n_row + n_x) * block_size];
+
+              CeedPragmaAtomic vv_k[(row + (x_0 + n_x) % num_nodes_1d[0]) * node_stride] += vv_loc;
+            }
+          }
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 static inline int CeedElemRestrictionApplyOrientedTranspose_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                                      const CeedInt comp_stride, CeedInt start, CeedInt stop, CeedInt num_elem,
                                                                      CeedInt elem_size, CeedSize v_offset, const CeedScalar *__restrict__ uu,
@@ -392,9 +532,68 @@ static inline int CeedElemRestrictionApplyAtPointsInElement_Ref_Core(CeedElemRes
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Compressed offsets setup
+//   Only attempted on the first apply, under the mutex, so no apply on another thread can still be reading the full offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionSetupCompressedOffsetsCore_Ref(CeedElemRestriction rstr, CeedElemRestriction_Ref *impl) {
+  CeedInt num_block, block_size, elem_size;
+
+  CeedCallBackend(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
+  CeedCallBackend(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+
+  // Per element base index, offsets layout is [num_block, elem_size, block_size]
+  CeedCallBackend(CeedCalloc(num_block * block_size, &impl->offsets_base));
+  for (CeedSize e = 0; e < num_block * block_size; e += block_size) {
+    for (CeedSize j = 0; j < block_size; j++) {
+      CeedInt min_offset = impl->offsets[e * elem_size + j], max_offset = min_offset;
+
+      for (CeedSize n = 1; n < elem_size; n++) {
+        min_offset = CeedIntMin(min_offset, impl->offsets[e * elem_size + n * block_size + j]);
+        max_offset = CeedIntMax(max_offset, impl->offsets[e * elem_size + n * block_size + j]);
+      }
+      // Element spans too large a range of the L-vector, keep uncompressed offsets
+      if (max_offset - min_offset > UINT16_MAX) {
+        CeedCallBackend(CeedFree(&impl->offsets_base));
+        return CEED_ERROR_SUCCESS;
+      }
+      impl->offsets_base[e + j] = min_offset;
+    }
+  }
+
+  // Local offsets relative to the element base index
+  CeedCallBackend(CeedCalloc(num_block * block_size * elem_size, &impl->offsets_local));
+  for (CeedSize e = 0; e < num_block * block_size; e += block_size) {
+    for (CeedSize i = 0; i < elem_size * block_size; i++) {
+      impl->offsets_local[e * elem_size + i] = (uint16_t)(impl->offsets[e * elem_size + i] - impl->offsets_base[e + i % block_size]);
+    }
+  }
+
+  // Full offsets are rebuilt from the compressed offsets if requested
+  CeedCallBackend(CeedFree(&impl->offsets_owned));
+  impl->offsets_borrowed = NULL;
+  impl->offsets          = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+static int CeedElemRestrictionSetupCompressedOffsets_Ref(CeedElemRestriction rstr) {
+  int                      ierr = CEED_ERROR_SUCCESS;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  pthread_mutex_lock(&impl->mutex);
+  // Offsets handed out by GetOffsets must stay valid, so keep them uncompressed
+  if (!impl->is_compression_checked && impl->num_offsets_readers == 0) ierr = CeedElemRestrictionSetupCompressedOffsetsCore_Ref(rstr, impl);
+  impl->is_compression_checked = true;
+  pthread_mutex_unlock(&impl->mutex);
+  return ierr;
+}
+
 static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                     const CeedInt comp_stride, CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs,
                                                     bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
+  bool                use_compressed = false;
   CeedInt             num_elem, elem_size;
   CeedSize            v_offset = 0;
   CeedRestrictionType rstr_type;
@@ -405,6 +604,15 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
   CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
   v_offset = start * block_size * elem_size * (CeedSize)num_comp;
   CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
+  if (rstr_type == CEED_RESTRICTION_STANDARD) {
+    CeedElemRestriction_Ref *impl;
+
+    CeedCallBackend(CeedElemRestrictionGetUseCompressedOffsets(rstr, &use_compressed));
+    if (use_compressed) CeedCallBackend(CeedElemRestrictionSetupCompressedOffsets_Ref(rstr));
+    // Compressed offsets replace the full offsets once built
+    CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+    use_compressed = impl->offsets_local != NULL;
+  }
   CeedCallBackend(CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu));
 
   if (t_mode == CEED_TRANSPOSE) {
@@ -426,8 +634,13 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
             CeedElemRestrictionApplyStridedTranspose_Ref_Core(rstr, num_comp, block_size, start, stop, num_elem, elem_size, v_offset, uu, vv));
         break;
       case CEED_RESTRICTION_STANDARD:
-        CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
-                                                                         v_offset, uu, vv));
+        if (use_compressed) {
+          CeedCallBackend(CeedElemRestrictionApplyCompressedTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
+                                                                               elem_size, v_offset, uu, vv));
+        } else {
+          CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
+                                                                           v_offset, uu, vv));
+        }
         break;
       case CEED_RESTRICTION_ORIENTED:
         if (use_signs) {
@@ -450,6 +663,10 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
                                                                            v_offset, uu, vv));
         }
         break;
+      case CEED_RESTRICTION_STRUCTURED:
+        CeedCallBackend(CeedElemRestrictionApplyStructuredTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
+                                                                             elem_size, v_offset, uu, vv));
+        break;
       case CEED_RESTRICTION_POINTS:
         CeedCallBackend(CeedElemRestrictionApplyAtPointsInElement_Ref_Core(rstr, num_comp, start, stop, t_mode, uu, vv));
         break;
@@ -466,8 +683,13 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
             CeedElemRestrictionApplyStridedNoTranspose_Ref_Core(rstr, num_comp, block_size, start, stop, num_elem, elem_size, v_offset, uu, vv));
         break;
       case CEED_RESTRICTION_STANDARD:
-        CeedCallBackend(CeedElemRestrictionApplyOffsetNoTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
-                                                                           v_offset, uu, vv));
+        if (use_compressed) {
+          CeedCallBackend(CeedElemRestrictionApplyCompressedNoTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
+                                                                                 elem_size, v_offset, uu, vv));
+        } else {
+          CeedCallBackend(CeedElemRestrictionApplyOffsetNoTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
+                                                                             elem_size, v_offset, uu, vv));
+        }
         break;
       case CEED_RESTRICTION_ORIENTED:
         if (use_signs) {
@@ -490,6 +712,10 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
                                                                              elem_size, v_offset, uu, vv));
         }
         break;
+      case CEED_RESTRICTION_STRUCTURED:
+        CeedCallBackend(CeedElemRestrictionApplyStructuredNoTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
+                                                                               elem_size, v_offset, uu, vv));
+        break;
       case CEED_RESTRICTION_POINTS:
         CeedCallBackend(CeedElemRestrictionApplyAtPointsInElement_Ref_Core(rstr, num_comp, start, stop, t_mode, uu, vv));
         break;
@@ -663,13 +889,53 @@ static int CeedElemRestrictionApplyBlock_Ref(CeedElemRestriction rstr, CeedInt b
 // ElemRestriction Get Offsets
 //------------------------------------------------------------------------------
 static int CeedElemRestrictionGetOffsets_Ref(CeedElemRestriction rstr, CeedMemType mem_type, const CeedInt **offsets) {
+  int                      ierr = CEED_ERROR_SUCCESS;
+  bool                     is_structured;
+  CeedInt                  num_block, block_size, elem_size;
   CeedElemRestriction_Ref *impl;
 
   CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
 
   CeedCheck(mem_type == CEED_MEM_HOST, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_BACKEND, "Can only provide to HOST memory");
+  CeedCallBackend(CeedElemRestrictionIsStructured(rstr, &is_structured));
+  CeedCallBackend(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
+  CeedCallBackend(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+
+  // Structured and compressed restrictions only build explicit offsets on request, e.g. for assembly, and free them once restored
+  pthread_mutex_lock(&impl->mutex);
+  if (!impl->offsets && !impl->offsets_rebuilt && (is_structured || impl->offsets_local)) {
+    ierr = CeedMalloc(num_block * block_size * elem_size, &impl->offsets_rebuilt);
+    if (!ierr && is_structured) {
+      ierr = CeedElemRestrictionGetStructuredOffsets(rstr, impl->offsets_rebuilt);
+    } else if (!ierr) {
+      for (CeedSize e = 0; e < num_block * block_size; e += block_size) {
+        for (CeedSize i = 0; i < elem_size * block_size; i++) {
+          impl->offsets_rebuilt[e * elem_size + i] = impl->offsets_base[e + i % block_size] + impl->offsets_local[e * elem_size + i];
+        }
+      }
+    }
+    if (ierr) CeedFree(&impl->offsets_rebuilt);
+  }
+  if (!ierr) {
+    *offsets = impl->offsets ? impl->offsets : impl->offsets_rebuilt;
+    impl->num_offsets_readers++;
+  }
+  pthread_mutex_unlock(&impl->mutex);
+  return ierr;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Restore Offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionRestoreOffsets_Ref(CeedElemRestriction rstr, const CeedInt **offsets) {
+  CeedElemRestriction_Ref *impl;
 
-  *offsets = impl->offsets;
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  pthread_mutex_lock(&impl->mutex);
+  impl->num_offsets_readers--;
+  if (impl->num_offsets_readers == 0) CeedFree(&impl->offsets_rebuilt);
+  pthread_mutex_unlock(&impl->mutex);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -701,6 +967,57 @@ static int CeedElemRestrictionGetCurlOrientations_Ref(CeedElemRestriction rstr,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Expand E-vector Size for AtPoints
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionSetAtPointsEVectorSize_Ref(CeedElemRestriction rstr, const CeedInt *offsets) {
+  CeedInt  num_elem, num_comp;
+  CeedSize max_points = 0, num_points_total = 0;
+
+  CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  for (CeedInt i = 0; i < num_elem; i++) {
+    CeedInt num_points = offsets[i + 1] - offsets[i];
+
+    max_points = CeedIntMax(max_points, num_points);
+    num_points_total += num_points;
+  }
+  // -- Increase size for last element
+  if (num_elem > 0) num_points_total += (max_points - (offsets[num_elem] - offsets[num_elem - 1]));
+  CeedCallBackend(CeedElemRestrictionSetAtPointsEVectorSize(rstr, num_points_total * num_comp));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Set AtPoints Offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionSetAtPointsOffsets_Ref(CeedElemRestriction rstr, const CeedInt *offsets) {
+  CeedInt                  num_elem, num_comp, num_points;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  CeedCallBackend(CeedElemRestrictionGetNumPoints(rstr, &num_points));
+
+  // Own storage for every point the L-vector can hold, so later updates only copy
+  if (!impl->has_points_capacity) {
+    CeedSize l_size;
+    CeedInt *offsets_new;
+
+    CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+    CeedCallBackend(CeedCalloc(num_elem + 1 + l_size / num_comp, &offsets_new));
+    CeedCallBackend(CeedFree(&impl->offsets_owned));
+    impl->offsets_owned       = offsets_new;
+    impl->offsets_borrowed    = NULL;
+    impl->offsets             = impl->offsets_owned;
+    impl->has_points_capacity = true;
+  }
+  memcpy((CeedInt *)impl->offsets_owned, offsets, (num_elem + 1 + num_points) * sizeof(CeedInt));
+  CeedCallBackend(CeedElemRestrictionSetAtPointsEVectorSize_Ref(rstr, impl->offsets));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Destroy
 //------------------------------------------------------------------------------
@@ -711,6 +1028,10 @@ static int CeedElemRestrictionDestroy_Ref(CeedElemRestriction rstr) {
   CeedCallBackend(CeedFree(&impl->offsets_owned));
   CeedCallBackend(CeedFree(&impl->orients_owned));
   CeedCallBackend(CeedFree(&impl->curl_orients_owned));
+  CeedCallBackend(CeedFree(&impl->offsets_base));
+  CeedCallBackend(CeedFree(&impl->offsets_local));
+  CeedCallBackend(CeedFree(&impl->offsets_rebuilt));
+  pthread_mutex_destroy(&impl->mutex);
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
@@ -737,6 +1058,7 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   CeedCheck(mem_type == CEED_MEM_HOST, ceed, CEED_ERROR_BACKEND, "Only MemType = HOST supported");
 
   CeedCallBackend(CeedCalloc(1, &impl));
+  pthread_mutex_init(&impl->mutex, NULL);
   CeedCallBackend(CeedElemRestrictionSetData(rstr, impl));
 
   // Set layouts
@@ -754,22 +1076,10 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   }
 
   // Expand E-vector size for AtPoints
-  if (rstr_type == CEED_RESTRICTION_POINTS) {
-    CeedSize max_points = 0, num_points_total = 0;
-
-    for (CeedInt i = 0; i < num_elem; i++) {
-      CeedInt num_points = offsets[i + 1] - offsets[i];
-
-      max_points = CeedIntMax(max_points, num_points);
-      num_points_total += num_points;
-    }
-    // -- Increase size for last element
-    num_points_total += (max_points - (offsets[num_elem] - offsets[num_elem - 1]));
-    CeedCallBackend(CeedElemRestrictionSetAtPointsEVectorSize(rstr, num_points_total * num_comp));
-  }
+  if (rstr_type == CEED_RESTRICTION_POINTS) CeedCallBackend(CeedElemRestrictionSetAtPointsEVectorSize_Ref(rstr, offsets));
 
   // Offsets data
-  if (rstr_type != CEED_RESTRICTION_STRIDED) {
+  if (rstr_type != CEED_RESTRICTION_STRIDED && rstr_type != CEED_RESTRICTION_STRUCTURED) {
     const char *resource;
 
     // Check indices for ref or memcheck backends
@@ -862,9 +1172,11 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyUnoriented", CeedElemRestrictionApplyUnoriented_Ref));
   if (rstr_type == CEED_RESTRICTION_POINTS) {
     CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyAtPointsInElement", CeedElemRestrictionApplyAtPointsInElement_Ref));
+    CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "SetAtPointsOffsets", CeedElemRestrictionSetAtPointsOffsets_Ref));
   }
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "ApplyBlock", CeedElemRestrictionApplyBlock_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetOffsets", CeedElemRestrictionGetOffsets_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "RestoreOffsets", CeedElemRestrictionRestoreOffsets_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetOrientations", CeedElemRestrictionGetOrientations_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "GetCurlOrientations", CeedElemRestrictionGetCurlOrientations_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", rstr, "Destroy", CeedElemRestrictionDestroy_Ref));
@@ -8,6 +8,7 @@
 
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -27,13 +28,42 @@ typedef struct {
   const CeedInt8 *curl_orients; /* Tridiagonal matrix (row-major) for a general transformation during restriction */
   const CeedInt8 *curl_orients_borrowed;
   const CeedInt8 *curl_orients_owned;
+  CeedInt        *offsets_base;        /* Compressed offsets, base index for each (padded) element */
+  uint16_t       *offsets_local;       /* Compressed offsets, relative to the element base index */
+  CeedInt        *offsets_rebuilt;     /* Full offsets built for readers of structured or compressed restrictions */
+  CeedInt         num_offsets_readers; /* Readers of the offsets, rebuilt offsets are freed after the last one */
+  pthread_mutex_t mutex;               /* Guards compression, rebuilt offsets, and the reader count */
+  bool            is_compression_checked;
+  bool            has_points_capacity; /* Owned offsets have room for every point in the L-vector */
   int (*Apply)(CeedElemRestriction, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, CeedTransposeMode, bool, bool, CeedVector, CeedVector,
                CeedRequest *);
 } CeedElemRestriction_Ref;
 
 typedef struct {
-  CeedScalar *collo_grad_1d;
-  bool        has_collo_interp;
+  const CeedScalar *t;          /* 1D matrix with even-odd symmetry */
+  CeedScalar       *t_even_odd; /* Even and odd parts, see CeedTensorContractGetEvenOdd */
+  CeedInt           parity;
+} CeedBasisEvenOdd_Ref;
+
+typedef struct {
+  CeedScalar     *data;
+  CeedSize        size;
+  pthread_mutex_t mutex; /* held while a call uses data; concurrent calls allocate their own scratch */
+} CeedBasisScratch_Ref;
+
+typedef struct {
+  CeedScalar          *collo_grad_1d;
+  CeedInt              num_even_odd;
+  CeedBasisEvenOdd_Ref even_odd[3];
+  CeedScalar          *interp_1d_open; /* Open 1D basis for tensor-product H(div) and H(curl) bases */
+  bool                 has_collo_interp;
+  CeedInt              simplex_P_1d, simplex_Q_1d; /* Simplex bases in collapsed coordinates */
+  CeedScalar          *simplex_v_inv;
+  CeedScalar          *simplex_interp_1d;
+  CeedScalar          *simplex_grad_1d;
+  CeedScalar          *simplex_jacobian;
+  CeedBasisScratch_Ref work;  /* Sum factorization temporaries */
+  CeedBasisScratch_Ref chunk; /* Packed element input and output for large batches */
 } CeedBasis_Ref;
 
 typedef struct {
@@ -48,20 +78,73 @@ typedef struct {
 } CeedQFunctionContext_Ref;
 
 typedef struct {
-  bool        is_identity_qf, is_identity_rstr_op;
-  bool       *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
-  CeedInt    *e_data_out_indices;
-  uint64_t   *input_states; /* State counter of inputs */
-  CeedVector *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  CeedVector *e_vecs_in;    /* Single element input E-vectors  */
-  CeedVector *e_vecs_out;   /* Single element output E-vectors */
-  CeedVector *q_vecs_in;    /* Single element input Q-vectors  */
-  CeedVector *q_vecs_out;   /* Single element output Q-vectors */
-  CeedInt     num_inputs, num_outputs;
-  CeedInt     qf_size_in, qf_size_out;
-  CeedVector  point_coords_elem;
+  bool         is_active;
+  CeedEvalMode eval_mode;
+  CeedInt      size;     /* QFunction field size */
+  CeedInt      e_stride; /* Length of single element data in full E-vector */
+  CeedBasis    basis;    /* Borrowed from operator field, NULL without basis action */
+  CeedScalar  *q_data;   /* Single element Q-vector data owned by operator, NULL if not needed */
+} CeedOperatorFieldPlan_Ref;
+
+typedef struct {
+  bool                       is_identity_qf, is_identity_rstr_op;
+  bool                      *skip_rstr_in, *skip_rstr_out, *skip_basis_in, *apply_add_basis_out;
+  CeedInt                   *e_data_out_indices, *fused_basis_in_indices;
+  uint64_t                  *input_states;       /* State counter of inputs */
+  CeedScalar               **q_cache_in;         /* Cached quadrature point values of passive inputs, NULL if not cached */
+  bool                      *is_q_cache_valid;   /* Whether cached quadrature point values match input states */
+  CeedVector                *e_vecs_full;        /* Full E-vectors, inputs followed by outputs */
+  CeedVector                *e_vecs_in;          /* Single element input E-vectors  */
+  CeedVector                *e_vecs_out;         /* Single element output E-vectors */
+  CeedVector                *q_vecs_in;          /* Single element input Q-vectors  */
+  CeedVector                *q_vecs_out;         /* Single element output Q-vectors */
+  CeedOperatorFieldPlan_Ref *plan_in, *plan_out; /* Per-field data precomputed during setup */
+  CeedQFunctionUser          qf_user;            /* User QFunction called on raw arrays, NULL to use CeedQFunctionApply */
+  const CeedScalar         **qf_inputs;          /* Input arrays for direct QFunction calls */
+  CeedScalar               **qf_outputs;         /* Output arrays for direct QFunction calls */
+  CeedInt                    num_inputs, num_outputs;
+  CeedInt                    qf_size_in, qf_size_out;
+  CeedVector                 point_coords_elem;
+  CeedInt                    max_num_points;                    /* Capacity of single element vectors at points */
+  uint64_t                   points_state;                      /* State counter of points at last setup */
+  CeedVector                 e_vecs_active[2 * CEED_FIELD_MAX]; /* Single element views into full E-vectors, inputs followed by outputs */
 } CeedOperator_Ref;
 
+typedef struct {
+  const void *object;
+  bool        is_write; /* Objects a sub-operator writes conflict with every other access */
+} CeedOperatorAccess_Ref;
+
+typedef struct CeedOperatorComposite_Ref CeedOperatorComposite_Ref;
+
+typedef struct {
+  CeedOperatorComposite_Ref *impl;
+  CeedInt                    id;
+} CeedOperatorCompositeThread_Ref;
+
+struct CeedOperatorComposite_Ref {
+  CeedInt                          num_threads; /* Threads in pool, including the calling thread */
+  CeedOperatorCompositeThread_Ref *threads;
+  pthread_t                       *pthreads;
+  pthread_mutex_t                  mutex;
+  pthread_cond_t                   cond_start, cond_done;
+  uint64_t                         generation; /* Incremented each time a color is launched */
+  CeedInt                          num_busy;   /* Pool threads still applying the current color */
+  bool                             is_stopping;
+  int                              error; /* First error from a pool thread */
+  CeedOperator                    *sub_ops_color;
+  CeedInt                          num_sub_ops_color;
+  CeedVector                       in_vec;
+  CeedVector                      *out_vecs;            /* Active output for each thread, 0 is the composite output */
+  bool                             is_colored;
+  uint64_t                         colored_states[CEED_COMPOSITE_MAX + 1]; /* Composite and sub-operator states when colored */
+  CeedInt                          num_colors, max_color_size;
+  CeedInt                          color_offsets[CEED_COMPOSITE_MAX + 1];
+  CeedOperator                     color_sub_ops[CEED_COMPOSITE_MAX]; /* Sub-operators grouped by color */
+  CeedInt                         *color_read_offsets;
+  CeedVector                      *color_read_vecs; /* Passive vectors only read by each color, without duplicates */
+};
+
 CEED_INTERN int CeedVectorCreate_Ref(CeedSize n, CeedVector vec);
 
 CEED_INTERN int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, const bool *orients,
@@ -69,8 +152,16 @@ CEED_INTERN int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode
 
 CEED_INTERN int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d, const CeedScalar *grad_1d,
                                             const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d, CeedBasis basis);
+CEED_INTERN int CeedBasisCreateTensorHdiv_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d, const CeedScalar *grad_1d,
+                                              const CeedScalar *interp_1d_open, const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d,
+                                              CeedBasis basis);
+CEED_INTERN int CeedBasisCreateTensorHcurl_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d, const CeedScalar *grad_1d,
+                                               const CeedScalar *interp_1d_open, const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d,
+                                               CeedBasis basis);
 CEED_INTERN int CeedBasisCreateH1_Ref(CeedElemTopology topo, CeedInt dim, CeedInt num_nodes, CeedInt num_qpts, const CeedScalar *interp,
                                       const CeedScalar *grad, const CeedScalar *q_ref, const CeedScalar *q_weight, CeedBasis basis);
+CEED_INTERN int CeedBasisCreateSimplexH1_Ref(CeedElemTopology topo, CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *v_inv,
+                                             const CeedScalar *interp_1d, const CeedScalar *grad_1d, const CeedScalar *jacobian, CeedBasis basis);
 CEED_INTERN int CeedBasisCreateHdiv_Ref(CeedElemTopology topo, CeedInt dim, CeedInt num_nodes, CeedInt num_qpts, const CeedScalar *interp,
                                         const CeedScalar *div, const CeedScalar *q_ref, const CeedScalar *q_weight, CeedBasis basis);
 CEED_INTERN int CeedBasisCreateHcurl_Ref(CeedElemTopology topo, CeedInt dim, CeedInt num_nodes, CeedInt num_qpts, const CeedScalar *interp,
@@ -84,3 +175,4 @@ CEED_INTERN int CeedQFunctionContextCreate_Ref(CeedQFunctionContext ctx);
 
 CEED_INTERN int CeedOperatorCreate_Ref(CeedOperator op);
 CEED_INTERN int CeedOperatorCreateAtPoints_Ref(CeedOperator op);
+CEED_INTERN int CeedCompositeOperatorCreate_Ref(CeedOperator op);
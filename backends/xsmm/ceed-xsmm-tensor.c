@@ -11,25 +11,89 @@
 
 #include "ceed-xsmm.h"
 
+//------------------------------------------------------------------------------
+// Find a cached kernel, with the cache mutex held
+//------------------------------------------------------------------------------
+static bool CeedTensorContractFindKernel_Xsmm(const CeedTensorContract_Xsmm *impl, CeedInt m, CeedInt n, CeedInt k, CeedInt lda, CeedInt ldb,
+                                              CeedInt ldc, CeedInt flags, CeedSize stride_a, CeedSize stride_b, libxsmm_gemmfunction *kernel) {
+  for (CeedInt i = 0; i < impl->num_kernels; i++) {
+    const CeedTensorContractKernel_Xsmm *entry = &impl->kernels[i];
+
+    if (entry->m == m && entry->n == n && entry->k == k && entry->lda == lda && entry->ldb == ldb && entry->ldc == ldc && entry->flags == flags &&
+        entry->stride_a == stride_a && entry->stride_b == stride_b) {
+      *kernel = entry->kernel;
+      return true;
+    }
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+// Get a cached kernel or build and cache a new one
+//   Strides are given in entries; nonzero strides build a stride batch-reduce kernel
+//   The cache is shared by threads applying the same basis, kernels are built outside the lock
+//------------------------------------------------------------------------------
+static int CeedTensorContractGetKernel_Xsmm(CeedTensorContract contract, CeedInt m, CeedInt n, CeedInt k, CeedInt lda, CeedInt ldb, CeedInt ldc,
+                                            CeedInt flags, CeedSize stride_a, CeedSize stride_b, libxsmm_gemmfunction *kernel) {
+  bool                     is_cached;
+  int                      ierr = CEED_ERROR_SUCCESS;
+  CeedTensorContract_Xsmm *impl;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+
+  // Query cache
+  pthread_mutex_lock(&impl->mutex);
+  is_cached = CeedTensorContractFindKernel_Xsmm(impl, m, n, k, lda, ldb, ldc, flags, stride_a, stride_b, kernel);
+  pthread_mutex_unlock(&impl->mutex);
+  if (is_cached) return CEED_ERROR_SUCCESS;
+
+  // Build kernel
+  {
+    const libxsmm_datatype   data_type  = (CEED_SCALAR_TYPE == CEED_SCALAR_FP64) ? LIBXSMM_DATATYPE_F64 : LIBXSMM_DATATYPE_F32;
+    const libxsmm_gemm_shape gemm_shape = libxsmm_create_gemm_shape(m, n, k, lda, ldb, ldc, data_type, data_type, data_type, data_type);
+
+    if (stride_a || stride_b) {
+      const libxsmm_gemm_batch_reduce_config br_config = libxsmm_create_gemm_batch_reduce_config(
+          LIBXSMM_GEMM_BATCH_REDUCE_STRIDE, stride_a * sizeof(CeedScalar), stride_b * sizeof(CeedScalar), 0);
+
+      *kernel = libxsmm_dispatch_brgemm(gemm_shape, (libxsmm_bitfield)(flags), (libxsmm_bitfield)LIBXSMM_GEMM_PREFETCH_NONE, br_config);
+    } else {
+      *kernel = libxsmm_dispatch_gemm(gemm_shape, (libxsmm_bitfield)(flags), (libxsmm_bitfield)LIBXSMM_GEMM_PREFETCH_NONE);
+    }
+    CeedCheck(*kernel, CeedTensorContractReturnCeed(contract), CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
+  }
+
+  // Cache kernel, unless another thread cached the same shape meanwhile
+  pthread_mutex_lock(&impl->mutex);
+  if (!CeedTensorContractFindKernel_Xsmm(impl, m, n, k, lda, ldb, ldc, flags, stride_a, stride_b, kernel)) {
+    if (impl->num_kernels == impl->max_kernels) {
+      const CeedInt max_kernels = impl->max_kernels ? 2 * impl->max_kernels : 8;
+
+      ierr = CeedRealloc(max_kernels, &impl->kernels);
+      if (ierr == CEED_ERROR_SUCCESS) impl->max_kernels = max_kernels;
+    }
+    if (ierr == CEED_ERROR_SUCCESS) {
+      impl->kernels[impl->num_kernels++] = (CeedTensorContractKernel_Xsmm){m, n, k, lda, ldb, ldc, flags, stride_a, stride_b, *kernel};
+    }
+  }
+  pthread_mutex_unlock(&impl->mutex);
+  return ierr;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
 static int CeedTensorContractApply_Xsmm(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
                                         CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const int            flags_ab = (!add) ? LIBXSMM_GEMM_FLAG_BETA_0 : LIBXSMM_BASIC_GEMM_FLAG_NONE;
+  libxsmm_gemmfunction kernel;
+  libxsmm_gemm_param   gemm_param;
+
   if (C == 1) {
     // Build or query the required kernel
-    const int                  flags_t    = LIBXSMM_GEMM_FLAGS(!t_mode ? 'T' : 'N', 'N');
-    const int                  flags_ab   = (!add) ? LIBXSMM_GEMM_FLAG_BETA_0 : LIBXSMM_BASIC_GEMM_FLAG_NONE;
-    const int                  flags      = (flags_t | flags_ab);
-    const libxsmm_gemm_shape   gemm_shape = (CEED_SCALAR_TYPE == CEED_SCALAR_FP64)
-                                                ? libxsmm_create_gemm_shape(J, A, B, !t_mode ? B : J, B, J, LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64,
-                                                                            LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64)
-                                                : libxsmm_create_gemm_shape(J, A, B, !t_mode ? B : J, B, J, LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32,
-                                                                            LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32);
-    const libxsmm_gemmfunction kernel = libxsmm_dispatch_gemm(gemm_shape, (libxsmm_bitfield)(flags), (libxsmm_bitfield)LIBXSMM_GEMM_PREFETCH_NONE);
-    libxsmm_gemm_param         gemm_param;
-
-    CeedCheck(kernel, CeedTensorContractReturnCeed(contract), CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
+    const int flags_t = LIBXSMM_GEMM_FLAGS(!t_mode ? 'T' : 'N', 'N');
+
+    CeedCallBackend(CeedTensorContractGetKernel_Xsmm(contract, J, A, B, !t_mode ? B : J, B, J, flags_t | flags_ab, 0, 0, &kernel));
 
     // Run kernel
     gemm_param.a.primary = (CeedScalar *)&t[0];
@@ -38,18 +102,9 @@ static int CeedTensorContractApply_Xsmm(CeedTensorContract contract, CeedInt A,
     kernel(&gemm_param);
   } else {
     // Build or query the required kernel
-    const int                  flags_t    = LIBXSMM_GEMM_FLAGS('N', t_mode ? 'T' : 'N');
-    const int                  flags_ab   = (!add) ? LIBXSMM_GEMM_FLAG_BETA_0 : LIBXSMM_BASIC_GEMM_FLAG_NONE;
-    const int                  flags      = (flags_t | flags_ab);
-    const libxsmm_gemm_shape   gemm_shape = (CEED_SCALAR_TYPE == CEED_SCALAR_FP64)
-                                                ? libxsmm_create_gemm_shape(C, J, B, C, !t_mode ? B : J, C, LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64,
-                                                                            LIBXSMM_DATATYPE_F64, LIBXSMM_DATATYPE_F64)
-                                                : libxsmm_create_gemm_shape(C, J, B, C, !t_mode ? B : J, C, LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32,
-                                                                            LIBXSMM_DATATYPE_F32, LIBXSMM_DATATYPE_F32);
-    const libxsmm_gemmfunction kernel = libxsmm_dispatch_gemm(gemm_shape, (libxsmm_bitfield)(flags), (libxsmm_bitfield)LIBXSMM_GEMM_PREFETCH_NONE);
-    libxsmm_gemm_param         gemm_param;
-
-    CeedCheck(kernel, CeedTensorContractReturnCeed(contract), CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
+    const int flags_t = LIBXSMM_GEMM_FLAGS('N', t_mode ? 'T' : 'N');
+
+    CeedCallBackend(CeedTensorContractGetKernel_Xsmm(contract, C, J, B, C, !t_mode ? B : J, C, flags_t | flags_ab, 0, 0, &kernel));
 
     // Run kernel
     gemm_param.b.primary = (CeedScalar *)&t[0];
@@ -62,11 +117,82 @@ static int CeedTensorContractApply_Xsmm(CeedTensorContract contract, CeedInt A,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Strided Apply
+//   The transpose sums over D, so a single stride batch-reduce GEMM covers all D matrices for each A
+//------------------------------------------------------------------------------
+static int CeedTensorContractStridedApply_Xsmm(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt D, CeedInt J,
+                                               const CeedScalar *restrict t, CeedTransposeMode t_mode, const CeedInt add,
+                                               const CeedScalar *restrict u, CeedScalar *restrict v) {
+  if (t_mode == CEED_NOTRANSPOSE) {
+    // Independent output blocks, one cached kernel for all D
+    for (CeedInt d = 0; d < D; d++) {
+      CeedCallBackend(CeedTensorContractApply_Xsmm(contract, A, B, C, J, t + d * B * J, t_mode, add, u, v + d * A * J * C));
+    }
+  } else {
+    const int            flags_ab = (!add) ? LIBXSMM_GEMM_FLAG_BETA_0 : LIBXSMM_BASIC_GEMM_FLAG_NONE;
+    unsigned long long   num_batch = D;
+    libxsmm_gemmfunction kernel;
+    libxsmm_gemm_param   gemm_param;
+
+    gemm_param.op.tertiary = &num_batch;
+    if (C == 1) {
+      // Build or query the required kernel
+      const int flags_t = LIBXSMM_GEMM_FLAGS('N', 'N');
+
+      CeedCallBackend(
+          CeedTensorContractGetKernel_Xsmm(contract, B, A, J, B, J, B, flags_t | flags_ab, (CeedSize)B * J, (CeedSize)A * J, &kernel));
+
+      // Run kernel
+      gemm_param.a.primary = (CeedScalar *)&t[0];
+      gemm_param.b.primary = (CeedScalar *)&u[0];
+      gemm_param.c.primary = (CeedScalar *)&v[0];
+      kernel(&gemm_param);
+    } else {
+      // Build or query the required kernel
+      const int flags_t = LIBXSMM_GEMM_FLAGS('N', 'T');
+
+      CeedCallBackend(CeedTensorContractGetKernel_Xsmm(contract, C, B, J, C, B, C, flags_t | flags_ab, (CeedSize)A * J * C, (CeedSize)B * J, &kernel));
+
+      // Run kernel
+      gemm_param.b.primary = (CeedScalar *)&t[0];
+      for (CeedInt a = 0; a < A; a++) {
+        gemm_param.a.primary = (CeedScalar *)&u[a * J * C];
+        gemm_param.c.primary = (CeedScalar *)&v[a * B * C];
+        kernel(&gemm_param);
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Destroy
+//------------------------------------------------------------------------------
+static int CeedTensorContractDestroy_Xsmm(CeedTensorContract contract) {
+  CeedTensorContract_Xsmm *impl;
+
+  CeedCallBackend(CeedTensorContractGetData(contract, &impl));
+  pthread_mutex_destroy(&impl->mutex);
+  CeedCallBackend(CeedFree(&impl->kernels));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Create
 //------------------------------------------------------------------------------
 int CeedTensorContractCreate_Xsmm(CeedTensorContract contract) {
-  CeedCallBackend(CeedSetBackendFunction(CeedTensorContractReturnCeed(contract), "TensorContract", contract, "Apply", CeedTensorContractApply_Xsmm));
+  Ceed                     ceed = CeedTensorContractReturnCeed(contract);
+  CeedTensorContract_Xsmm *impl;
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  pthread_mutex_init(&impl->mutex, NULL);
+  CeedCallBackend(CeedTensorContractSetData(contract, impl));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply", CeedTensorContractApply_Xsmm));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "StridedApply", CeedTensorContractStridedApply_Xsmm));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy", CeedTensorContractDestroy_Xsmm));
   return CEED_ERROR_SUCCESS;
 }
 
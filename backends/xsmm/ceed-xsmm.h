@@ -8,5 +8,20 @@
 
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <libxsmm.h>
+#include <pthread.h>
+#include <stdbool.h>
+
+typedef struct {
+  CeedInt              m, n, k, lda, ldb, ldc, flags;
+  CeedSize             stride_a, stride_b; /* Batch-reduce strides, in entries; zero for plain GEMM kernels */
+  libxsmm_gemmfunction kernel;
+} CeedTensorContractKernel_Xsmm;
+
+typedef struct {
+  CeedInt                        num_kernels, max_kernels;
+  CeedTensorContractKernel_Xsmm *kernels;
+  pthread_mutex_t                mutex; /* Guards the kernel cache, bases may be applied from several threads */
+} CeedTensorContract_Xsmm;
 
 CEED_INTERN int CeedTensorContractCreate_Xsmm(CeedTensorContract contract);
@@ -19,10 +19,13 @@ CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Mass3DBuild)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_MassApply)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Vector3MassApply)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Poisson1DApply)
+CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Poisson1DApplyOnTheFly)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Poisson1DBuild)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Poisson2DApply)
+CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Poisson2DApplyOnTheFly)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Poisson2DBuild)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Poisson3DApply)
+CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Poisson3DApplyOnTheFly)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Poisson3DBuild)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Vector3Poisson1DApply)
 CEED_GALLERY_QFUNCTION(CeedQFunctionRegister_Vector3Poisson2DApply)
@@ -0,0 +1,39 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <ceed/jit-source/gallery/ceed-poisson1dapplyonthefly.h>
+#include <string.h>
+
+/**
+  @brief Set fields for `CeedQFunction` applying the 1D Poisson operator with geometric data computed from the coordinates
+**/
+static int CeedQFunctionInit_Poisson1DApplyOnTheFly(Ceed ceed, const char *requested, CeedQFunction qf) {
+  // Check QFunction name
+  const char *name = "Poisson1DApplyOnTheFly";
+  CeedCheck(!strcmp(name, requested), ceed, CEED_ERROR_UNSUPPORTED, "QFunction '%s' does not match requested name: %s", name, requested);
+
+  // Add QFunction fields
+  const CeedInt dim = 1;
+  CeedCall(CeedQFunctionAddInput(qf, "du", dim, CEED_EVAL_GRAD));
+  CeedCall(CeedQFunctionAddInput(qf, "dx", dim * dim, CEED_EVAL_GRAD));
+  CeedCall(CeedQFunctionAddInput(qf, "weights", 1, CEED_EVAL_WEIGHT));
+  CeedCall(CeedQFunctionAddOutput(qf, "dv", dim, CEED_EVAL_GRAD));
+
+  CeedCall(CeedQFunctionSetUserFlopsEstimate(qf, 2));
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Register `CeedQFunction` for applying the 1D Poisson operator with geometric data computed from the coordinates
+**/
+CEED_INTERN int CeedQFunctionRegister_Poisson1DApplyOnTheFly(void) {
+  return CeedQFunctionRegister("Poisson1DApplyOnTheFly", Poisson1DApplyOnTheFly_loc, 1, Poisson1DApplyOnTheFly,
+                               CeedQFunctionInit_Poisson1DApplyOnTheFly);
+}
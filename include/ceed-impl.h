@@ -11,10 +11,16 @@
 
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <pthread.h>
 #include <stdbool.h>
 
 CEED_INTERN const char *CeedJitSourceRootDefault;
 
+// Reference and access counts may be updated by sub-operators applied concurrently
+#define CeedAtomicIncrement(count) __atomic_add_fetch(&(count), 1, __ATOMIC_ACQ_REL)
+#define CeedAtomicDecrement(count) __atomic_sub_fetch(&(count), 1, __ATOMIC_ACQ_REL)
+#define CeedAtomicLoad(count) __atomic_load_n(&(count), __ATOMIC_ACQUIRE)
+
 /** @defgroup CeedUser Public API for Ceed
     @ingroup Ceed
 */
@@ -90,6 +96,22 @@ struct CeedWorkVectors_private {
   CeedVector *vecs;
 };
 
+// Worker thread and FIFO for non-blocking requests
+typedef struct CeedRequestQueue_private *CeedRequestQueue;
+
+struct CeedRequest_private {
+  Ceed ceed;
+  int (*Run)(CeedRequest);
+  CeedOperator        op;
+  CeedElemRestriction rstr;
+  CeedTransposeMode   t_mode;
+  CeedVector          in, out;
+  bool                is_add;
+  bool                is_done;
+  int                 error;
+  CeedRequest         next;
+};
+
 struct Ceed_private {
   const char  *resource;
   Ceed         delegate;
@@ -110,9 +132,16 @@ struct Ceed_private {
   int (*ElemRestrictionCreate)(CeedMemType, CeedCopyMode, const CeedInt *, const bool *, const CeedInt8 *, CeedElemRestriction);
   int (*ElemRestrictionCreateAtPoints)(CeedMemType, CeedCopyMode, const CeedInt *, const bool *, const CeedInt8 *, CeedElemRestriction);
   int (*ElemRestrictionCreateBlocked)(CeedMemType, CeedCopyMode, const CeedInt *, const bool *, const CeedInt8 *, CeedElemRestriction);
+  int (*ElemRestrictionCreateStructured)(CeedMemType, CeedCopyMode, const CeedInt *, const bool *, const CeedInt8 *, CeedElemRestriction);
   int (*BasisCreateTensorH1)(CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *, CeedBasis);
+  int (*BasisCreateTensorHdiv)(CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *,
+                                const CeedScalar *, CeedBasis);
+  int (*BasisCreateTensorHcurl)(CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *,
+                                 const CeedScalar *, CeedBasis);
   int (*BasisCreateH1)(CeedElemTopology, CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *,
                        CeedBasis);
+  int (*BasisCreateSimplexH1)(CeedElemTopology, CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *,
+                               const CeedScalar *, CeedBasis);
   int (*BasisCreateHdiv)(CeedElemTopology, CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *,
                          CeedBasis);
   int (*BasisCreateHcurl)(CeedElemTopology, CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *,
@@ -131,6 +160,10 @@ struct Ceed_private {
   char            err_msg[CEED_MAX_RESOURCE_LEN];
   FOffset        *f_offsets;
   CeedWorkVectors work_vectors;
+
+  CeedRequestQueue request_queue;
+  pthread_mutex_t  mutex;         /* guards work vectors and lazily created fallback Ceed and request queue */
+  pthread_mutex_t  err_msg_mutex; /* guards err_msg */
 };
 
 struct CeedVector_private {
@@ -160,6 +193,8 @@ struct CeedVector_private {
   uint64_t state;
   uint64_t num_readers;
   void    *data;
+  void    *mapped_file;
+  size_t   mapped_file_size;
 };
 
 struct CeedElemRestriction_private {
@@ -171,7 +206,9 @@ struct CeedElemRestriction_private {
   int (*ApplyAtPointsInElement)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyBlock)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
   int (*GetAtPointsElementOffset)(CeedElemRestriction, CeedInt, CeedSize *);
+  int (*SetAtPointsOffsets)(CeedElemRestriction, const CeedInt *);
   int (*GetOffsets)(CeedElemRestriction, CeedMemType, const CeedInt **);
+  int (*RestoreOffsets)(CeedElemRestriction, const CeedInt **);
   int (*GetOrientations)(CeedElemRestriction, CeedMemType, const bool **);
   int (*GetCurlOrientations)(CeedElemRestriction, CeedMemType, const CeedInt8 **);
   int (*Destroy)(CeedElemRestriction);
@@ -192,12 +229,22 @@ struct CeedElemRestriction_private {
            rstr_type;   /* initialized in element restriction constructor for default, oriented, curl-oriented, or strided element restriction */
   uint64_t num_readers; /* number of instances of offset read only access */
   void    *data;        /* place for the backend to store any data */
+
+  CeedInt dim;            /* dimension of the grid, for structured restriction */
+  CeedInt num_elem_1d[3]; /* number of elements in each direction, for structured restriction */
+  CeedInt P_1d;           /* number of nodes per element in each direction, for structured restriction */
+  bool    is_periodic[3]; /* periodicity in each direction, for structured restriction */
+  CeedInt node_stride;    /* stride between consecutive grid nodes in the L-vector, for structured restriction */
+
+  uint64_t points_state;           /* number of updates of the points, for points restriction */
+  bool     use_compressed_offsets; /* hint for backends to use compressed offsets */
 };
 
 struct CeedBasis_private {
   Ceed ceed;
   int (*Apply)(CeedBasis, CeedInt, CeedTransposeMode, CeedEvalMode, CeedVector, CeedVector);
   int (*ApplyAdd)(CeedBasis, CeedInt, CeedTransposeMode, CeedEvalMode, CeedVector, CeedVector);
+  int (*ApplyInterpAndGrad)(CeedBasis, CeedInt, CeedVector, CeedVector, CeedVector);
   int (*ApplyAtPoints)(CeedBasis, CeedInt, const CeedInt *, CeedTransposeMode, CeedEvalMode, CeedVector, CeedVector, CeedVector);
   int (*ApplyAddAtPoints)(CeedBasis, CeedInt, const CeedInt *, CeedTransposeMode, CeedEvalMode, CeedVector, CeedVector, CeedVector);
   int (*Destroy)(CeedBasis);
@@ -217,12 +264,13 @@ struct CeedBasis_private {
   CeedScalar *interp; /* row-major matrix of shape [Q, P] or [dim * Q, P] expressing the values of nodal basis functions or vector basis functions at
                          quadrature points */
   CeedScalar *interp_1d; /* row-major matrix of shape [Q1d, P1d] expressing the values of nodal basis functions at quadrature points */
+  CeedScalar *interp_1d_open; /* row-major matrix of shape [Q1d, P1d - 1] expressing the values of the open 1D basis functions at quadrature points
+                                for tensor-product H(div) and H(curl) discretizations */
   CeedScalar *grad;      /* row-major matrix of shape [dim * Q, P] matrix expressing derivatives of nodal basis functions at quadrature points */
   CeedScalar *grad_1d;   /* row-major matrix of shape [Q1d, P1d] matrix expressing derivatives of nodal basis functions at quadrature points */
   CeedScalar *div; /* row-major matrix of shape [Q, P] expressing the divergence of basis functions at quadrature points for H(div) discretizations */
   CeedScalar *curl; /* row-major matrix of shape [curl_dim * Q, P], curl_dim = 1 if dim < 3 else dim, expressing the curl of basis functions at
                        quadrature points for H(curl) discretizations */
-  CeedVector  vec_chebyshev;
   CeedBasis   basis_chebyshev; /* basis interpolating from nodes to Chebyshev polynomial coefficients */
   void       *data;            /* place for the backend to store any data */
 };
@@ -231,6 +279,10 @@ struct CeedTensorContract_private {
   Ceed ceed;
   int (*Apply)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt, const CeedScalar *restrict, CeedTransposeMode, const CeedInt,
                const CeedScalar *restrict, CeedScalar *restrict);
+  int (*StridedApply)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, const CeedScalar *restrict, CeedTransposeMode, const CeedInt,
+                      const CeedScalar *restrict, CeedScalar *restrict);
+  int (*ApplyEvenOdd)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt, const CeedScalar *restrict, CeedInt, CeedTransposeMode, const CeedInt,
+                      const CeedScalar *restrict, CeedScalar *restrict);
   int (*Destroy)(CeedTensorContract);
   int   ref_count;
   void *data;
@@ -264,7 +316,8 @@ struct CeedQFunction_private {
   bool                 is_fortran;
   bool                 is_immutable;
   bool                 is_context_writable;
-  CeedQFunctionContext ctx;  /* user context for function */
+  bool                 is_user_function_direct; /* Backend Apply only calls the user function, so operators may call it on raw arrays */
+  CeedQFunctionContext ctx;                     /* user context for function */
   void                *data; /* place for the backend to store any data */
 };
 
@@ -321,6 +374,9 @@ struct CeedOperatorField_private {
   CeedBasis           basis;      /* Basis or CEED_BASIS_NONE for collocated fields */
   CeedVector          vec;        /* State vector for passive fields or CEED_VECTOR_NONE for no vector */
   const char         *field_name; /* matching QFunction field name */
+
+  CeedScalarType storage_precision; /* Precision backends may store passive field data in */
+  bool           cache_qpt_values;  /* Whether backends may cache quadrature point values of passive field */
 };
 
 struct CeedQFunctionAssemblyData_private {
@@ -362,7 +418,9 @@ struct CeedOperator_private {
   int (*ApplyComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAdd)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAddComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyAddMultiple)(CeedOperator, CeedInt, CeedVector *, CeedVector *, CeedRequest *);
   int (*ApplyJacobian)(CeedOperator, CeedVector, CeedVector, CeedVector, CeedVector, CeedRequest *);
+  int (*SetActiveElements)(CeedOperator);
   int (*Destroy)(CeedOperator);
   CeedOperatorField        *input_fields;
   CeedOperatorField        *output_fields;
@@ -390,4 +448,17 @@ struct CeedOperator_private {
   CeedContextFieldLabel    *context_labels;
   CeedElemRestriction       rstr_points, first_points_rstr;
   CeedVector                point_coords;
+
+  CeedInt  block_size;      /* Requested element block size, 0 for backend default */
+  CeedInt  num_threads;     /* Requested threads for concurrent sub-operators, 0 for backend default */
+  CeedInt  num_active_elem; /* Number of elements in active element list */
+  CeedInt *active_elems;    /* Sorted active element list, NULL if all elements are active */
+  uint64_t state;           /* Incremented when fields, points, or sub-operators change */
 };
+
+CEED_INTERN int CeedRequestIsAsync(Ceed ceed, CeedRequest *request, bool *is_async);
+CEED_INTERN int CeedRequestCreate(Ceed ceed, int (*Run)(CeedRequest), CeedRequest *req);
+CEED_INTERN int CeedRequestDestroy(CeedRequest *req);
+CEED_INTERN int CeedRequestSubmit(CeedRequest req, CeedRequest *request);
+CEED_INTERN int CeedRequestQueueWait(Ceed ceed);
+CEED_INTERN int CeedRequestSetImmediate(CeedRequest **request);
@@ -286,6 +286,8 @@ typedef enum {
   CEED_RESTRICTION_STRIDED = 4,
   /// Point-in-cell element restriction
   CEED_RESTRICTION_POINTS = 5,
+  /// Structured grid element restriction with implicit offsets
+  CEED_RESTRICTION_STRUCTURED = 6,
 } CeedRestrictionType;
 
 CEED_EXTERN int CeedElemRestrictionGetType(CeedElemRestriction rstr, CeedRestrictionType *rstr_type);
@@ -294,8 +296,13 @@ CEED_EXTERN int CeedElemRestrictionIsAtPoints(CeedElemRestriction rstr, bool *is
 CEED_EXTERN int CeedElemRestrictionAtPointsAreCompatible(CeedElemRestriction rstr_a, CeedElemRestriction rstr_b, bool *are_compatible);
 CEED_EXTERN int CeedElemRestrictionGetStrides(CeedElemRestriction rstr, CeedInt strides[3]);
 CEED_EXTERN int CeedElemRestrictionHasBackendStrides(CeedElemRestriction rstr, bool *has_backend_strides);
+CEED_EXTERN int CeedElemRestrictionIsStructured(CeedElemRestriction rstr, bool *is_structured);
+CEED_EXTERN int CeedElemRestrictionGetStructure(CeedElemRestriction rstr, CeedInt *dim, CeedInt num_elem_1d[3], CeedInt *P_1d, bool is_periodic[3],
+                                                CeedInt *node_stride);
+CEED_EXTERN int CeedElemRestrictionGetStructuredOffsets(CeedElemRestriction rstr, CeedInt *offsets);
 CEED_EXTERN int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mem_type, const CeedInt **offsets);
 CEED_EXTERN int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr, const CeedInt **offsets);
+CEED_EXTERN int CeedElemRestrictionGetUseCompressedOffsets(CeedElemRestriction rstr, bool *use_compressed);
 CEED_EXTERN int CeedElemRestrictionGetOrientations(CeedElemRestriction rstr, CeedMemType mem_type, const bool **orients);
 CEED_EXTERN int CeedElemRestrictionRestoreOrientations(CeedElemRestriction rstr, const bool **orients);
 CEED_EXTERN int CeedElemRestrictionGetCurlOrientations(CeedElemRestriction rstr, CeedMemType mem_type, const CeedInt8 **curl_orients);
@@ -306,6 +313,7 @@ CEED_EXTERN int CeedElemRestrictionGetELayout(CeedElemRestriction rstr, CeedInt
 CEED_EXTERN int CeedElemRestrictionSetELayout(CeedElemRestriction rstr, CeedInt layout[3]);
 CEED_EXTERN int CeedElemRestrictionGetAtPointsElementOffset(CeedElemRestriction rstr, CeedInt elem, CeedSize *elem_offset);
 CEED_EXTERN int CeedElemRestrictionSetAtPointsEVectorSize(CeedElemRestriction rstr, CeedSize e_size);
+CEED_EXTERN int CeedElemRestrictionGetAtPointsState(CeedElemRestriction rstr, uint64_t *state);
 CEED_EXTERN int CeedElemRestrictionGetData(CeedElemRestriction rstr, void *data);
 CEED_EXTERN int CeedElemRestrictionSetData(CeedElemRestriction rstr, void *data);
 CEED_EXTERN int CeedElemRestrictionReference(CeedElemRestriction rstr);
@@ -350,6 +358,11 @@ CEED_EXTERN int  CeedTensorContractApply(CeedTensorContract contract, CeedInt A,
 CEED_EXTERN int  CeedTensorContractStridedApply(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt D, CeedInt J,
                                                 const CeedScalar *__restrict__ t, CeedTransposeMode t_mode, const CeedInt add,
                                                 const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v);
+CEED_EXTERN int  CeedTensorContractGetEvenOdd(CeedTensorContract contract, CeedInt J, CeedInt B, const CeedScalar *t, CeedInt *parity,
+                                              CeedScalar *t_even_odd);
+CEED_EXTERN int  CeedTensorContractApplyEvenOdd(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                                const CeedScalar *__restrict__ t_even_odd, CeedInt parity, CeedTransposeMode t_mode,
+                                                const CeedInt add, const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v);
 CEED_EXTERN int  CeedTensorContractGetCeed(CeedTensorContract contract, Ceed *ceed);
 CEED_EXTERN Ceed CeedTensorContractReturnCeed(CeedTensorContract contract);
 CEED_EXTERN int  CeedTensorContractGetData(CeedTensorContract contract, void *data);
@@ -375,6 +388,8 @@ CEED_EXTERN int CeedQFunctionGetInnerContextData(CeedQFunction qf, CeedMemType m
 CEED_EXTERN int CeedQFunctionRestoreInnerContextData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionIsIdentity(CeedQFunction qf, bool *is_identity);
 CEED_EXTERN int CeedQFunctionIsContextWritable(CeedQFunction qf, bool *is_writable);
+CEED_EXTERN int CeedQFunctionIsUserFunctionDirect(CeedQFunction qf, bool *is_direct);
+CEED_EXTERN int CeedQFunctionSetUserFunctionDirect(CeedQFunction qf, bool is_direct);
 CEED_EXTERN int CeedQFunctionGetData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionSetData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionIsImmutable(CeedQFunction qf, bool *is_immutable);
@@ -450,6 +465,10 @@ CEED_EXTERN int CeedOperatorGetNumArgs(CeedOperator op, CeedInt *num_args);
 CEED_EXTERN int CeedOperatorHasTensorBases(CeedOperator op, bool *has_tensor_bases);
 CEED_EXTERN int CeedOperatorIsImmutable(CeedOperator op, bool *is_immutable);
 CEED_EXTERN int CeedOperatorIsSetupDone(CeedOperator op, bool *is_setup_done);
+CEED_EXTERN int CeedOperatorGetState(CeedOperator op, uint64_t *state);
+CEED_EXTERN int CeedOperatorGetBlockSize(CeedOperator op, CeedInt *block_size);
+CEED_EXTERN int CeedCompositeOperatorGetNumThreads(CeedOperator op, CeedInt *num_threads);
+CEED_EXTERN int CeedOperatorGetActiveElements(CeedOperator op, CeedInt *num_active_elem, const CeedInt **active_elems);
 CEED_EXTERN int CeedOperatorGetQFunction(CeedOperator op, CeedQFunction *qf);
 CEED_EXTERN int CeedOperatorIsComposite(CeedOperator op, bool *is_composite);
 CEED_EXTERN int CeedOperatorGetData(CeedOperator op, void *data);
@@ -181,6 +181,8 @@ CEED_EXTERN const char *const  CeedContextFieldTypes[];
 CEED_EXTERN int CeedGetPreferredMemType(Ceed ceed, CeedMemType *type);
 
 CEED_EXTERN int  CeedVectorCreate(Ceed ceed, CeedSize len, CeedVector *vec);
+CEED_EXTERN int  CeedVectorCreateFromFile(Ceed ceed, const char *file_name, size_t offset, CeedSize length, CeedMapMode map_mode, int hints,
+                                          CeedVector *vec);
 CEED_EXTERN int  CeedVectorReferenceCopy(CeedVector vec, CeedVector *vec_copy);
 CEED_EXTERN int  CeedVectorCopy(CeedVector vec, CeedVector vec_copy);
 CEED_EXTERN int  CeedVectorCopyStrided(CeedVector vec, CeedSize start, CeedSize stop, CeedSize step, CeedVector vec_copy);
@@ -241,6 +243,10 @@ CEED_EXTERN const CeedQFunction CEED_QFUNCTION_NONE;
 /// @ingroup CeedElemRestriction
 CEED_EXTERN const CeedInt CEED_STRIDES_BACKEND[3];
 
+/// Argument for @ref CeedOperatorSetBlockSize() that the backend should select the element block size by timing candidate block sizes.
+/// @ingroup CeedOperator
+CEED_EXTERN const CeedInt CEED_BLOCK_SIZE_AUTO;
+
 CEED_EXTERN int  CeedElemRestrictionCreate(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedInt comp_stride, CeedSize l_size,
                                            CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, CeedElemRestriction *rstr);
 CEED_EXTERN int  CeedElemRestrictionCreateOriented(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedInt comp_stride,
@@ -251,6 +257,9 @@ CEED_EXTERN int  CeedElemRestrictionCreateCurlOriented(Ceed ceed, CeedInt num_el
                                                        const CeedInt8 *curl_orients, CeedElemRestriction *rstr);
 CEED_EXTERN int  CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedSize l_size,
                                                   const CeedInt strides[3], CeedElemRestriction *rstr);
+CEED_EXTERN int  CeedElemRestrictionCreateStructured(Ceed ceed, CeedInt dim, const CeedInt num_elem_1d[], CeedInt P_1d, const bool is_periodic[],
+                                                    CeedInt num_comp, CeedInt node_stride, CeedInt comp_stride, CeedSize l_size,
+                                                    CeedElemRestriction *rstr);
 CEED_EXTERN int  CeedElemRestrictionCreateAtPoints(Ceed ceed, CeedInt num_elem, CeedInt num_points, CeedInt num_comp, CeedSize l_size,
                                                    CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, CeedElemRestriction *rstr);
 CEED_EXTERN int  CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt block_size, CeedInt num_comp,
@@ -264,6 +273,13 @@ CEED_EXTERN int  CeedElemRestrictionCreateBlockedCurlOriented(Ceed ceed, CeedInt
                                                               const CeedInt *offsets, const CeedInt8 *curl_orients, CeedElemRestriction *rstr);
 CEED_EXTERN int  CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt block_size, CeedInt num_comp,
                                                          CeedSize l_size, const CeedInt strides[3], CeedElemRestriction *rstr);
+CEED_EXTERN int  CeedElemRestrictionCreateBlockedStructured(Ceed ceed, CeedInt dim, const CeedInt num_elem_1d[], CeedInt P_1d, CeedInt block_size,
+                                                           const bool is_periodic[], CeedInt num_comp, CeedInt node_stride, CeedInt comp_stride,
+                                                           CeedSize l_size, CeedElemRestriction *rstr);
+CEED_EXTERN int  CeedElemRestrictionCreateReordered(CeedElemRestriction rstr, bool renumber_nodes, CeedInt *elem_perm, CeedInt *l_perm,
+                                                   CeedElemRestriction *rstr_reordered);
+CEED_EXTERN int  CeedElemRestrictionCreateAtPointsByLocation(CeedElemRestriction rstr_x, CeedBasis basis_x, CeedVector x_coords, CeedVector x_points,
+                                                            CeedInt *point_elem, CeedElemRestriction *rstr_points, CeedVector *x_ref_points);
 CEED_EXTERN int  CeedElemRestrictionCreateUnsignedCopy(CeedElemRestriction rstr, CeedElemRestriction *rstr_unsigned);
 CEED_EXTERN int  CeedElemRestrictionCreateUnorientedCopy(CeedElemRestriction rstr, CeedElemRestriction *rstr_unoriented);
 CEED_EXTERN int  CeedElemRestrictionReferenceCopy(CeedElemRestriction rstr, CeedElemRestriction *rstr_copy);
@@ -288,6 +304,8 @@ CEED_EXTERN int  CeedElemRestrictionGetEVectorSize(CeedElemRestriction rstr, Cee
 CEED_EXTERN int  CeedElemRestrictionGetNumComponents(CeedElemRestriction rstr, CeedInt *num_comp);
 CEED_EXTERN int  CeedElemRestrictionGetNumBlocks(CeedElemRestriction rstr, CeedInt *num_block);
 CEED_EXTERN int  CeedElemRestrictionGetBlockSize(CeedElemRestriction rstr, CeedInt *block_size);
+CEED_EXTERN int  CeedElemRestrictionSetUseCompressedOffsets(CeedElemRestriction rstr, bool use_compressed);
+CEED_EXTERN int  CeedElemRestrictionSetAtPointsOffsets(CeedElemRestriction rstr, CeedInt num_points, const CeedInt *offsets);
 CEED_EXTERN int  CeedElemRestrictionGetMultiplicity(CeedElemRestriction rstr, CeedVector mult);
 CEED_EXTERN int  CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream);
 CEED_EXTERN int  CeedElemRestrictionDestroy(CeedElemRestriction *rstr);
@@ -300,8 +318,19 @@ CEED_EXTERN int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim, CeedInt
                                                 CeedBasis *basis);
 CEED_EXTERN int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d,
                                         const CeedScalar *grad_1d, const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d, CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateTensorHdivLagrange(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P, CeedInt Q, CeedQuadMode quad_mode,
+                                                  CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateTensorHdiv(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d,
+                                          const CeedScalar *grad_1d, const CeedScalar *interp_1d_open, const CeedScalar *q_ref_1d,
+                                          const CeedScalar *q_weight_1d, CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateTensorHcurlLagrange(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P, CeedInt Q, CeedQuadMode quad_mode,
+                                                   CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateTensorHcurl(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d,
+                                           const CeedScalar *grad_1d, const CeedScalar *interp_1d_open, const CeedScalar *q_ref_1d,
+                                           const CeedScalar *q_weight_1d, CeedBasis *basis);
 CEED_EXTERN int CeedBasisCreateH1(Ceed ceed, CeedElemTopology topo, CeedInt num_comp, CeedInt num_nodes, CeedInt nqpts, const CeedScalar *interp,
                                   const CeedScalar *grad, const CeedScalar *q_ref, const CeedScalar *q_weights, CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateSimplexH1(Ceed ceed, CeedElemTopology topo, CeedInt num_comp, CeedInt P, CeedInt Q, CeedBasis *basis);
 CEED_EXTERN int CeedBasisCreateHdiv(Ceed ceed, CeedElemTopology topo, CeedInt num_comp, CeedInt num_nodes, CeedInt nqpts, const CeedScalar *interp,
                                     const CeedScalar *div, const CeedScalar *q_ref, const CeedScalar *q_weights, CeedBasis *basis);
 CEED_EXTERN int CeedBasisCreateHcurl(Ceed ceed, CeedElemTopology topo, CeedInt num_comp, CeedInt num_nodes, CeedInt nqpts, const CeedScalar *interp,
@@ -311,6 +340,7 @@ CEED_EXTERN int CeedBasisReferenceCopy(CeedBasis basis, CeedBasis *basis_copy);
 CEED_EXTERN int CeedBasisView(CeedBasis basis, FILE *stream);
 CEED_EXTERN int CeedBasisApply(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector u, CeedVector v);
 CEED_EXTERN int CeedBasisApplyAdd(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector u, CeedVector v);
+CEED_EXTERN int CeedBasisApplyInterpAndGrad(CeedBasis basis, CeedInt num_elem, CeedVector u, CeedVector v_interp, CeedVector v_grad);
 CEED_EXTERN int CeedBasisApplyAtPoints(CeedBasis basis, CeedInt num_elem, const CeedInt *num_points, CeedTransposeMode t_mode, CeedEvalMode eval_mode,
                                        CeedVector x_ref, CeedVector u, CeedVector v);
 CEED_EXTERN int CeedBasisApplyAddAtPoints(CeedBasis basis, CeedInt num_elem, const CeedInt *num_points, CeedTransposeMode t_mode,
@@ -410,18 +440,21 @@ CEED_EXTERN int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx);
 CEED_EXTERN int CeedOperatorCreate(Ceed ceed, CeedQFunction qf, CeedQFunction dqf, CeedQFunction dqfT, CeedOperator *op);
 CEED_EXTERN int CeedOperatorCreateAtPoints(Ceed ceed, CeedQFunction qf, CeedQFunction dqf, CeedQFunction dqfT, CeedOperator *op);
 CEED_EXTERN int CeedCompositeOperatorCreate(Ceed ceed, CeedOperator *op);
+CEED_EXTERN int CeedOperatorLoad(Ceed ceed, const char *file_name, CeedInt num_qf, CeedQFunction *qfs, CeedOperator *op);
 CEED_EXTERN int CeedOperatorReferenceCopy(CeedOperator op, CeedOperator *op_copy);
 CEED_EXTERN int CeedOperatorSetField(CeedOperator op, const char *field_name, CeedElemRestriction rstr, CeedBasis basis, CeedVector vec);
 CEED_EXTERN int CeedOperatorGetFields(CeedOperator op, CeedInt *num_input_fields, CeedOperatorField **input_fields, CeedInt *num_output_fields,
                                       CeedOperatorField **output_fields);
 
 CEED_EXTERN int  CeedOperatorAtPointsSetPoints(CeedOperator op, CeedElemRestriction rstr_points, CeedVector point_coords);
+CEED_EXTERN int  CeedOperatorAtPointsUpdatePoints(CeedOperator op, CeedInt num_points, const CeedInt *offsets);
 CEED_EXTERN int  CeedOperatorAtPointsGetPoints(CeedOperator op, CeedElemRestriction *rstr_points, CeedVector *point_coords);
 CEED_EXTERN int  CeedOperatorIsAtPoints(CeedOperator op, bool *is_at_points);
 CEED_EXTERN int  CeedCompositeOperatorAddSub(CeedOperator composite_op, CeedOperator sub_op);
 CEED_EXTERN int  CeedCompositeOperatorGetNumSub(CeedOperator op, CeedInt *num_suboperators);
 CEED_EXTERN int  CeedCompositeOperatorGetSubList(CeedOperator op, CeedOperator **sub_operators);
 CEED_EXTERN int  CeedCompositeOperatorGetSubByName(CeedOperator op, const char *op_name, CeedOperator *sub_op);
+CEED_EXTERN int  CeedCompositeOperatorSetNumThreads(CeedOperator op, CeedInt num_threads);
 CEED_EXTERN int  CeedOperatorCheckReady(CeedOperator op);
 CEED_EXTERN int  CeedOperatorGetActiveVectorLengths(CeedOperator op, CeedSize *input_size, CeedSize *output_size);
 CEED_EXTERN int  CeedOperatorSetQFunctionAssemblyReuse(CeedOperator op, bool reuse_assembly_data);
@@ -448,8 +481,13 @@ CEED_EXTERN int  CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVe
                                                     CeedOperator *op_prolong, CeedOperator *op_restrict);
 CEED_EXTERN int  CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorSetName(CeedOperator op, const char *name);
+CEED_EXTERN int  CeedOperatorSetBlockSize(CeedOperator op, CeedInt block_size);
+CEED_EXTERN int  CeedOperatorSetActiveElements(CeedOperator op, CeedInt num_active_elem, const CeedInt *active_elems);
+CEED_EXTERN int  CeedOperatorSetFieldStoragePrecision(CeedOperator op, const char *field_name, CeedScalarType precision);
+CEED_EXTERN int  CeedOperatorSetFieldCacheQuadratureValues(CeedOperator op, const char *field_name, bool cache);
 CEED_EXTERN int  CeedOperatorView(CeedOperator op, FILE *stream);
 CEED_EXTERN int  CeedOperatorViewTerse(CeedOperator op, FILE *stream);
+CEED_EXTERN int  CeedOperatorSave(CeedOperator op, const char *file_name);
 CEED_EXTERN int  CeedOperatorGetCeed(CeedOperator op, Ceed *ceed);
 CEED_EXTERN Ceed CeedOperatorReturnCeed(CeedOperator op);
 CEED_EXTERN int  CeedOperatorGetNumElements(CeedOperator op, CeedInt *num_elem);
@@ -468,6 +506,8 @@ CEED_EXTERN int  CeedOperatorGetContextBooleanRead(CeedOperator op, CeedContextF
 CEED_EXTERN int  CeedOperatorRestoreContextBooleanRead(CeedOperator op, CeedContextFieldLabel field_label, const bool **values);
 CEED_EXTERN int  CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int  CeedOperatorApplyMultiple(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out, CeedRequest *request);
+CEED_EXTERN int  CeedOperatorApplyAddMultiple(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorAssemblyDataStrip(CeedOperator op);
 CEED_EXTERN int  CeedOperatorDestroy(CeedOperator *op);
 
@@ -476,6 +516,8 @@ CEED_EXTERN int CeedOperatorFieldGetName(CeedOperatorField op_field, const char
 CEED_EXTERN int CeedOperatorFieldGetElemRestriction(CeedOperatorField op_field, CeedElemRestriction *rstr);
 CEED_EXTERN int CeedOperatorFieldGetBasis(CeedOperatorField op_field, CeedBasis *basis);
 CEED_EXTERN int CeedOperatorFieldGetVector(CeedOperatorField op_field, CeedVector *vec);
+CEED_EXTERN int CeedOperatorFieldGetStoragePrecision(CeedOperatorField op_field, CeedScalarType *precision);
+CEED_EXTERN int CeedOperatorFieldGetCacheQuadratureValues(CeedOperatorField op_field, bool *cache);
 CEED_EXTERN int CeedOperatorFieldGetData(CeedOperatorField op_field, const char **field_name, CeedElemRestriction *rstr, CeedBasis *basis,
                                          CeedVector *vec);
 
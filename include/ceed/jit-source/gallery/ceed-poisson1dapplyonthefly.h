@@ -0,0 +1,28 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+
+/**
+  @brief Ceed QFunction for applying the 1D Poisson operator with geometric data computed from the coordinates
+**/
+#include <ceed/types.h>
+
+CEED_QFUNCTION(Poisson1DApplyOnTheFly)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  // At every quadrature point, compute w/det(J) and apply it to gradient u without storing it.
+  // in[0] is gradient u, size (Q)
+  // in[1] is Jacobians, size (Q)
+  // in[2] is quadrature weights, size (Q)
+  const CeedScalar *ug = in[0], *J = in[1], *w = in[2];
+
+  // out[0] is output to multiply against gradient v, size (Q)
+  CeedScalar *vg = out[0];
+
+  // Quadrature point loop
+  CeedPragmaSIMD for (CeedInt i = 0; i < Q; i++) { vg[i] = ug[i] * w[i] / J[i]; }  // End of Quadrature Point Loop
+
+  return CEED_ERROR_SUCCESS;
+}
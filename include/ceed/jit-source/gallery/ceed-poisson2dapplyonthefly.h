@@ -0,0 +1,50 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+
+/**
+  @brief Ceed QFunction for applying the 2D Poisson operator with geometric data computed from the coordinates
+**/
+#include <ceed/types.h>
+
+CEED_QFUNCTION(Poisson2DApplyOnTheFly)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  // At every quadrature point, compute w/det(J).adj(J).adj(J)^T and apply it to gradient u without storing it.
+  // in[0] is gradient u, shape [2, nc=1, Q]
+  // in[1] is Jacobians with shape [2, nc=2, Q]
+  // in[2] is quadrature weights, size (Q)
+  const CeedScalar(*ug)[CEED_Q_VLA] = (const CeedScalar(*)[CEED_Q_VLA])in[0], (*J)[2][CEED_Q_VLA] = (const CeedScalar(*)[2][CEED_Q_VLA])in[1],
+        *w = in[2];
+  // out[0] is output to multiply against gradient v, shape [2, nc=1, Q]
+  CeedScalar(*vg)[CEED_Q_VLA] = (CeedScalar(*)[CEED_Q_VLA])out[0];
+
+  const CeedInt dim = 2;
+
+  // Quadrature point loop
+  CeedPragmaSIMD for (CeedInt i = 0; i < Q; i++) {
+    // Compute dXdxdXdxT symmetric matrix
+    // J: 0 2   q: 0 2   adj(J):  J11 -J01
+    //    1 3      2 1           -J10  J00
+    const CeedScalar J00 = J[0][0][i];
+    const CeedScalar J10 = J[0][1][i];
+    const CeedScalar J01 = J[1][0][i];
+    const CeedScalar J11 = J[1][1][i];
+    const CeedScalar qw  = w[i] / (J00 * J11 - J10 * J01);
+    const CeedScalar q_0 = qw * (J01 * J01 + J11 * J11);
+    const CeedScalar q_1 = qw * (J00 * J00 + J10 * J10);
+    const CeedScalar q_2 = -qw * (J00 * J01 + J10 * J11);
+    const CeedScalar dXdxdXdxT[2][2] = {
+        {q_0, q_2},
+        {q_2, q_1}
+    };
+
+    // Apply Poisson operator
+    // j = direction of vg
+    for (CeedInt j = 0; j < dim; j++) vg[j][i] = (ug[0][i] * dXdxdXdxT[0][j] + ug[1][i] * dXdxdXdxT[1][j]);
+  }  // End of Quadrature Point Loop
+
+  return CEED_ERROR_SUCCESS;
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+
+/**
+  @brief Ceed QFunction for applying the 3D Poisson operator with geometric data computed from the coordinates
+**/
+#include <ceed/types.h>
+
+CEED_QFUNCTION(Poisson3DApplyOnTheFly)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  // At every quadrature point, compute w/det(J).adj(J).adj(J)^T and apply it to gradient u without storing it.
+  // in[0] is gradient u, shape [3, nc=1, Q]
+  // in[1] is Jacobians with shape [3, nc=3, Q]
+  // in[2] is quadrature weights, size (Q)
+  const CeedScalar(*ug)[CEED_Q_VLA] = (const CeedScalar(*)[CEED_Q_VLA])in[0], (*J)[3][CEED_Q_VLA] = (const CeedScalar(*)[3][CEED_Q_VLA])in[1],
+        *w = in[2];
+  // out[0] is output to multiply against gradient v, shape [3, nc=1, Q]
+  CeedScalar(*vg)[CEED_Q_VLA] = (CeedScalar(*)[CEED_Q_VLA])out[0];
+
+  const CeedInt dim = 3;
+
+  // Quadrature point loop
+  CeedPragmaSIMD for (CeedInt i = 0; i < Q; i++) {
+    // Compute the adjoint
+    CeedScalar A[3][3];
+    for (CeedInt j = 0; j < dim; j++)
+      for (CeedInt k = 0; k < dim; k++)
+        // Equivalent code with no mod operations:
+        // A[k][j] = J[k+1][j+1]*J[k+2][j+2] - J[k+2][j+1]*J[k+1][j+2]
+        A[k][j] = J[(k + 1) % dim][(j + 1) % dim][i] * J[(k + 2) % dim][(j + 2) % dim][i] -
+                  J[(k + 2) % dim][(j + 1) % dim][i] * J[(k + 1) % dim][(j + 2) % dim][i];
+
+    // Compute quadrature weight / det(J)
+    const CeedScalar qw = w[i] / (J[0][0][i] * A[0][0] + J[0][1][i] * A[0][1] + J[0][2][i] * A[0][2]);
+
+    // Compute dXdxdXdxT symmetric matrix
+    CeedScalar dXdxdXdxT[3][3];
+    for (CeedInt j = 0; j < dim; j++) {
+      for (CeedInt k = j; k < dim; k++) {
+        dXdxdXdxT[j][k] = qw * (A[j][0] * A[k][0] + A[j][1] * A[k][1] + A[j][2] * A[k][2]);
+        dXdxdXdxT[k][j] = dXdxdXdxT[j][k];
+      }
+    }
+
+    // Apply Poisson operator
+    // j = direction of vg
+    for (CeedInt j = 0; j < dim; j++) vg[j][i] = (ug[0][i] * dXdxdXdxT[0][j] + ug[1][i] * dXdxdXdxT[1][j] + ug[2][i] * dXdxdXdxT[2][j]);
+  }  // End of Quadrature Point Loop
+
+  return CEED_ERROR_SUCCESS;
+}
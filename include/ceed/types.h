@@ -188,6 +188,27 @@ typedef enum {
   CEED_NORM_MAX,
 } CeedNormType;
 
+/// Denotes how the file backing a `CeedVector` created with @ref CeedVectorCreateFromFile() is mapped
+/// @ingroup CeedVector
+typedef enum {
+  /// File is opened read-only; entries modified through the `CeedVector` are private to the process and never written to the file
+  CEED_MAP_READ,
+  /// File is opened for reading and writing; entries modified through the `CeedVector` are written back to the file
+  CEED_MAP_READ_WRITE,
+} CeedMapMode;
+
+/// Hints for mapping the file backing a `CeedVector`, which may be combined with bitwise or.
+/// Hints not supported by the operating system are ignored.
+/// @ingroup CeedVector
+typedef enum {
+  /// No hints
+  CEED_MAP_HINT_NONE = 0,
+  /// Back the mapping with transparent huge pages where possible
+  CEED_MAP_HINT_HUGE_PAGES = 1,
+  /// Read the whole file range into the page cache when the `CeedVector` is created
+  CEED_MAP_HINT_PREFETCH = 2,
+} CeedMapHint;
+
 /// Denotes whether a linear transformation or its transpose should be applied
 /// @ingroup CeedBasis
 typedef enum {
@@ -52,29 +52,128 @@ static int CeedChebyshevPolynomialsAtPoint(CeedScalar x, CeedInt n, CeedScalar *
   return CEED_ERROR_SUCCESS;
 }
 
+/// Number of points evaluated together by the default implementation of @ref CeedBasisApplyAtPoints()
+#define CEED_AT_POINTS_BATCH_SIZE 16
+
 /**
-  @brief Compute values of the derivative of Chebyshev polynomials at a point
+  @brief Compute Chebyshev polynomial values, and optionally their derivatives, at a batch of `CEED_AT_POINTS_BATCH_SIZE` points
+
+  Values are stored point fastest, `chebyshev_x[i * CEED_AT_POINTS_BATCH_SIZE + b]` for polynomial `i` at point `b`, so contractions vectorize across points.
 
-  @param[in]  x            Coordinate to evaluate derivative of Chebyshev polynomials at
-  @param[in]  n            Number of Chebyshev polynomials to evaluate, `n >= 2`
-  @param[out] chebyshev_dx Array of Chebyshev polynomial derivative values
+  @param[in]  x            Coordinates of the points
+  @param[in]  n            Number of Chebyshev polynomials to evaluate
+  @param[out] chebyshev_x  Array of Chebyshev polynomial values
+  @param[out] chebyshev_dx Array of Chebyshev polynomial derivative values, or NULL
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
-static int CeedChebyshevDerivativeAtPoint(CeedScalar x, CeedInt n, CeedScalar *chebyshev_dx) {
-  CeedScalar chebyshev_x[3];
+static int CeedChebyshevAtPointsBatch(const CeedScalar *x, CeedInt n, CeedScalar *chebyshev_x, CeedScalar *chebyshev_dx) {
+  const CeedInt B = CEED_AT_POINTS_BATCH_SIZE;
+
+  for (CeedInt b = 0; b < B; b++) chebyshev_x[b] = 1.0;
+  if (n > 1) {
+    for (CeedInt b = 0; b < B; b++) chebyshev_x[B + b] = 2 * x[b];
+  }
+  for (CeedInt i = 2; i < n; i++) {
+    CeedPragmaSIMD for (CeedInt b = 0; b < B; b++) chebyshev_x[i * B + b] = 2 * x[b] * chebyshev_x[(i - 1) * B + b] - chebyshev_x[(i - 2) * B + b];
+  }
+  if (!chebyshev_dx) return CEED_ERROR_SUCCESS;
 
-  chebyshev_x[1]  = 1.0;
-  chebyshev_x[2]  = 2 * x;
-  chebyshev_dx[0] = 0.0;
-  chebyshev_dx[1] = 2.0;
+  for (CeedInt b = 0; b < B; b++) chebyshev_dx[b] = 0.0;
+  if (n > 1) {
+    for (CeedInt b = 0; b < B; b++) chebyshev_dx[B + b] = 2.0;
+  }
   for (CeedInt i = 2; i < n; i++) {
-    chebyshev_x[0]  = chebyshev_x[1];
-    chebyshev_x[1]  = chebyshev_x[2];
-    chebyshev_x[2]  = 2 * x * chebyshev_x[1] - chebyshev_x[0];
-    chebyshev_dx[i] = 2 * x * chebyshev_dx[i - 1] + 2 * chebyshev_x[1] - chebyshev_dx[i - 2];
+    CeedPragmaSIMD for (CeedInt b = 0; b < B; b++) {
+      chebyshev_dx[i * B + b] = 2 * x[b] * chebyshev_dx[(i - 1) * B + b] + 2 * chebyshev_x[(i - 1) * B + b] - chebyshev_dx[(i - 2) * B + b];
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Contract the fastest index of a tensor with Chebyshev values for a batch of `CEED_AT_POINTS_BATCH_SIZE` points
+
+  Computes `v[a][b] = sum_k chebyshev_x[k][b] u[a][k][b]`, where `u[a][k]` is shared by all points if `is_u_shared`.
+
+  @param[in]  A           Number of rows of `u` and `v`
+  @param[in]  Q           Number of Chebyshev polynomials
+  @param[in]  chebyshev_x Chebyshev values for the batch, point fastest
+  @param[in]  is_u_shared Whether `u` is the same for all points, such as the Chebyshev coefficients
+  @param[in]  u           Input tensor
+  @param[out] v           Output tensor, point fastest
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static inline int CeedChebyshevContractBatch(CeedInt A, CeedInt Q, const CeedScalar *restrict chebyshev_x, bool is_u_shared,
+                                             const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt B = CEED_AT_POINTS_BATCH_SIZE;
+
+  for (CeedInt a = 0; a < A; a++) {
+    CeedScalar *restrict v_a = &v[a * B];
+
+    for (CeedInt b = 0; b < B; b++) v_a[b] = 0.0;
+    for (CeedInt k = 0; k < Q; k++) {
+      const CeedScalar *restrict chebyshev_k = &chebyshev_x[k * B];
+
+      if (is_u_shared) {
+        const CeedScalar u_ak = u[a * Q + k];
+
+        CeedPragmaSIMD for (CeedInt b = 0; b < B; b++) v_a[b] += u_ak * chebyshev_k[b];
+      } else {
+        const CeedScalar *restrict u_ak = &u[(a * Q + k) * B];
+
+        CeedPragmaSIMD for (CeedInt b = 0; b < B; b++) v_a[b] += u_ak[b] * chebyshev_k[b];
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply the transpose of @ref CeedChebyshevContractBatch() for a batch of `CEED_AT_POINTS_BATCH_SIZE` points
+
+  Computes `v[c][j][r][b] = chebyshev_x[j][b] u[c][r][b]`, or sums over the points into `v[c][j][r]` if `is_v_shared`.
+
+  @param[in]     num_comp    Number of components
+  @param[in]     R           Size of the trailing dimensions already expanded
+  @param[in]     Q           Number of Chebyshev polynomials
+  @param[in]     chebyshev_x Chebyshev values for the batch, point fastest
+  @param[in]     is_v_shared Whether to sum over points into `v`, such as the Chebyshev coefficients
+  @param[in]     u           Input tensor, point fastest
+  @param[in,out] v           Output tensor
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static inline int CeedChebyshevContractTransposeBatch(CeedInt num_comp, CeedInt R, CeedInt Q, const CeedScalar *restrict chebyshev_x,
+                                                      bool is_v_shared, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt B = CEED_AT_POINTS_BATCH_SIZE;
+
+  for (CeedInt c = 0; c < num_comp; c++) {
+    for (CeedInt j = 0; j < Q; j++) {
+      const CeedScalar *restrict chebyshev_j = &chebyshev_x[j * B];
+
+      for (CeedInt r = 0; r < R; r++) {
+        const CeedScalar *restrict u_cr = &u[(c * R + r) * B];
+
+        if (is_v_shared) {
+          CeedScalar sum = 0.0;
+
+          for (CeedInt b = 0; b < B; b++) sum += u_cr[b] * chebyshev_j[b];
+          v[(c * Q + j) * R + r] += sum;
+        } else {
+          CeedScalar *restrict v_cjr = &v[((c * Q + j) * R + r) * B];
+
+          CeedPragmaSIMD for (CeedInt b = 0; b < B; b++) v_cjr[b] = u_cr[b] * chebyshev_j[b];
+        }
+      }
+    }
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -206,13 +305,16 @@ static int CeedBasisCreateProjectionMatrices(CeedBasis basis_from, CeedBasis bas
             Q_from, Q_to);
   Q = Q_to;
 
-  // Check for matching tensor or non-tensor
+  // Check for matching tensor or non-tensor, tensor-product H(div) and H(curl) bases use their dense matrices
   {
-    bool is_tensor_to, is_tensor_from;
+    bool        is_tensor_to, is_tensor_from;
+    CeedFESpace fe_space_to, fe_space_from;
 
     CeedCall(CeedBasisIsTensor(basis_to, &is_tensor_to));
     CeedCall(CeedBasisIsTensor(basis_from, &is_tensor_from));
-    are_both_tensor = is_tensor_to && is_tensor_from;
+    CeedCall(CeedBasisGetFESpace(basis_to, &fe_space_to));
+    CeedCall(CeedBasisGetFESpace(basis_from, &fe_space_from));
+    are_both_tensor = is_tensor_to && is_tensor_from && fe_space_to == CEED_FE_SPACE_H1 && fe_space_from == CEED_FE_SPACE_H1;
   }
   if (are_both_tensor) {
     CeedCall(CeedBasisGetNumNodes1D(basis_to, &P_to));
@@ -445,7 +547,8 @@ static int CeedBasisApplyAtPointsCheckDims(CeedBasis basis, CeedInt num_elem, co
 **/
 static int CeedBasisApplyAtPoints_Core(CeedBasis basis, bool apply_add, CeedInt num_elem, const CeedInt *num_points, CeedTransposeMode t_mode,
                                        CeedEvalMode eval_mode, CeedVector x_ref, CeedVector u, CeedVector v) {
-  CeedInt dim, num_comp, P_1d = 1, Q_1d = 1, total_num_points = num_points[0];
+  CeedInt   dim, num_comp, P_1d = 1, Q_1d = 1;
+  CeedBasis basis_chebyshev;
 
   CeedCall(CeedBasisGetDimension(basis, &dim));
   // Inserting check because clang-tidy doesn't understand this cannot occur
@@ -456,22 +559,28 @@ static int CeedBasisApplyAtPoints_Core(CeedBasis basis, bool apply_add, CeedInt
 
   // Default implementation
   {
-    bool is_tensor_basis;
+    bool        is_tensor_basis;
+    CeedFESpace fe_space;
 
     CeedCall(CeedBasisIsTensor(basis, &is_tensor_basis));
     CeedCheck(is_tensor_basis, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED,
               "Evaluation at arbitrary points only supported for tensor product bases");
+    CeedCall(CeedBasisGetFESpace(basis, &fe_space));
+    CeedCheck(fe_space == CEED_FE_SPACE_H1, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED,
+              "Evaluation at arbitrary points only supported for H^1 bases");
   }
-  CeedCheck(num_elem == 1, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED,
-            "Evaluation at arbitrary  points only supported for a single element at a time");
   if (eval_mode == CEED_EVAL_WEIGHT) {
     CeedCall(CeedVectorSetValue(v, 1.0));
     return CEED_ERROR_SUCCESS;
   }
-  if (!basis->basis_chebyshev) {
+  pthread_mutex_lock(&basis->ceed->mutex);
+  basis_chebyshev = basis->basis_chebyshev;
+  pthread_mutex_unlock(&basis->ceed->mutex);
+  if (!basis_chebyshev) {
     // Build basis mapping from nodes to Chebyshev coefficients
     CeedScalar       *chebyshev_interp_1d, *chebyshev_grad_1d, *chebyshev_q_weight_1d;
     const CeedScalar *q_ref_1d;
+    CeedBasis         basis_unused = NULL;
     Ceed              ceed;
 
     CeedCall(CeedCalloc(P_1d * Q_1d, &chebyshev_interp_1d));
@@ -481,171 +590,599 @@ static int CeedBasisApplyAtPoints_Core(CeedBasis basis, bool apply_add, CeedInt
     CeedCall(CeedBasisGetChebyshevInterp1D(basis, chebyshev_interp_1d));
 
     CeedCall(CeedBasisGetCeed(basis, &ceed));
-    CeedCall(CeedVectorCreate(ceed, num_comp * CeedIntPow(Q_1d, dim), &basis->vec_chebyshev));
     CeedCall(CeedBasisCreateTensorH1(ceed, dim, num_comp, P_1d, Q_1d, chebyshev_interp_1d, chebyshev_grad_1d, q_ref_1d, chebyshev_q_weight_1d,
-                                     &basis->basis_chebyshev));
+                                     &basis_chebyshev));
+
+    // Keep the first basis built if another thread raced to build it
+    pthread_mutex_lock(&basis->ceed->mutex);
+    if (basis->basis_chebyshev) {
+      basis_unused    = basis_chebyshev;
+      basis_chebyshev = basis->basis_chebyshev;
+    } else {
+      basis->basis_chebyshev = basis_chebyshev;
+    }
+    pthread_mutex_unlock(&basis->ceed->mutex);
 
     // Cleanup
+    CeedCall(CeedBasisDestroy(&basis_unused));
     CeedCall(CeedFree(&chebyshev_interp_1d));
     CeedCall(CeedFree(&chebyshev_grad_1d));
     CeedCall(CeedFree(&chebyshev_q_weight_1d));
     CeedCall(CeedDestroy(&ceed));
   }
 
-  // Create TensorContract object if needed, such as a basis from the GPU backends
-  if (!basis->contract) {
-    Ceed      ceed_ref;
-    CeedBasis basis_ref = NULL;
-
-    CeedCall(CeedInit("/cpu/self", &ceed_ref));
-    // Only need matching tensor contraction dimensions, any type of basis will work
-    CeedCall(CeedBasisCreateTensorH1Lagrange(ceed_ref, dim, num_comp, P_1d, Q_1d, CEED_GAUSS, &basis_ref));
-    // Note - clang-tidy doesn't know basis_ref->contract must be valid here
-    CeedCheck(basis_ref && basis_ref->contract, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED,
-              "Reference CPU ceed failed to create a tensor contraction object");
-    CeedCall(CeedTensorContractReferenceCopy(basis_ref->contract, &basis->contract));
-    CeedCall(CeedBasisDestroy(&basis_ref));
-    CeedCall(CeedDestroy(&ceed_ref));
-  }
-
-  // Basis evaluation
-  switch (t_mode) {
-    case CEED_NOTRANSPOSE: {
-      // Nodes to arbitrary points
-      CeedScalar       *v_array;
-      const CeedScalar *chebyshev_coeffs, *x_array_read;
-
-      // -- Interpolate to Chebyshev coefficients
-      CeedCall(CeedBasisApply(basis->basis_chebyshev, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u, basis->vec_chebyshev));
-
-      // -- Evaluate Chebyshev polynomials at arbitrary points
-      CeedCall(CeedVectorGetArrayRead(basis->vec_chebyshev, CEED_MEM_HOST, &chebyshev_coeffs));
-      CeedCall(CeedVectorGetArrayRead(x_ref, CEED_MEM_HOST, &x_array_read));
-      CeedCall(CeedVectorGetArrayWrite(v, CEED_MEM_HOST, &v_array));
-      switch (eval_mode) {
-        case CEED_EVAL_INTERP: {
-          CeedScalar tmp[2][num_comp * CeedIntPow(Q_1d, dim)], chebyshev_x[Q_1d];
+  // Basis evaluation, batched across the points of each element
+  //   Elements are interleaved as for CeedBasisApply, with each element padded to the largest number of points
+  {
+    const CeedInt B            = CEED_AT_POINTS_BATCH_SIZE;
+    const CeedInt num_pass     = eval_mode == CEED_EVAL_GRAD ? dim : 1;
+    const CeedInt num_coeffs   = num_comp * CeedIntPow(Q_1d, dim);
+    const CeedInt tmp_size     = num_comp * CeedIntPow(Q_1d, dim - 1) * B;
+    CeedInt       max_num_points = num_points[0];
+    CeedScalar   *chebyshev_x, *chebyshev_dx = NULL, *chebyshev_coeffs_elem, *tmp[2], x_batch[CEED_AT_POINTS_BATCH_SIZE];
+    CeedVector    vec_chebyshev;
+    Ceed          ceed;
+
+    for (CeedInt e = 1; e < num_elem; e++) max_num_points = CeedIntMax(max_num_points, num_points[e]);
+    CeedCall(CeedBasisGetCeed(basis, &ceed));
+    CeedCall(CeedGetWorkVector(ceed, (CeedSize)num_coeffs * num_elem, &vec_chebyshev));
+    CeedCall(CeedMalloc(dim * Q_1d * B, &chebyshev_x));
+    if (eval_mode == CEED_EVAL_GRAD) CeedCall(CeedMalloc(dim * Q_1d * B, &chebyshev_dx));
+    CeedCall(CeedMalloc(num_coeffs, &chebyshev_coeffs_elem));
+    CeedCall(CeedMalloc(tmp_size, &tmp[0]));
+    CeedCall(CeedMalloc(tmp_size, &tmp[1]));
+
+    switch (t_mode) {
+      case CEED_NOTRANSPOSE: {
+        // Nodes to arbitrary points
+        CeedScalar       *v_array;
+        const CeedScalar *chebyshev_coeffs, *x_array_read;
+
+        // -- Interpolate to Chebyshev coefficients
+        CeedCall(CeedBasisApply(basis_chebyshev, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u, vec_chebyshev));
+
+        // -- Evaluate Chebyshev polynomials at arbitrary points
+        CeedCall(CeedVectorGetArrayRead(vec_chebyshev, CEED_MEM_HOST, &chebyshev_coeffs));
+        CeedCall(CeedVectorGetArrayRead(x_ref, CEED_MEM_HOST, &x_array_read));
+        CeedCall(CeedVectorGetArrayWrite(v, CEED_MEM_HOST, &v_array));
+        for (CeedInt e = 0; e < num_elem; e++) {
+          for (CeedInt i = 0; i < num_coeffs; i++) chebyshev_coeffs_elem[i] = chebyshev_coeffs[i * num_elem + e];
+          for (CeedInt p = 0; p < num_points[e]; p += B) {
+            const CeedInt num_batch = CeedIntMin(B, num_points[e] - p);
+
+            // ---- Chebyshev values for batch, padding with the origin
+            for (CeedInt d = 0; d < dim; d++) {
+              for (CeedInt b = 0; b < B; b++) x_batch[b] = b < num_batch ? x_array_read[(d * max_num_points + p + b) * num_elem + e] : 0.0;
+              CeedCall(CeedChebyshevAtPointsBatch(x_batch, Q_1d, &chebyshev_x[d * Q_1d * B], chebyshev_dx ? &chebyshev_dx[d * Q_1d * B] : NULL));
+            }
+            // ---- Values at points; dim**2 contractions for gradient, derivative when pass == d
+            for (CeedInt pass = 0; pass < num_pass; pass++) {
+              CeedInt pre = num_comp * CeedIntPow(Q_1d, dim - 1);
 
-          // ---- Values at point
-          for (CeedInt p = 0; p < total_num_points; p++) {
-            CeedInt pre = num_comp * CeedIntPow(Q_1d, dim - 1), post = 1;
+              for (CeedInt d = 0; d < dim; d++) {
+                const CeedScalar *chebyshev_d = &(eval_mode == CEED_EVAL_GRAD && pass == d ? chebyshev_dx : chebyshev_x)[d * Q_1d * B];
 
-            for (CeedInt d = 0; d < dim; d++) {
-              // ------ Tensor contract with current Chebyshev polynomial values
-              CeedCall(CeedChebyshevPolynomialsAtPoint(x_array_read[d * total_num_points + p], Q_1d, chebyshev_x));
-              CeedCall(CeedTensorContractApply(basis->contract, pre, Q_1d, post, 1, chebyshev_x, t_mode, false,
-                                               d == 0 ? chebyshev_coeffs : tmp[d % 2], tmp[(d + 1) % 2]));
-              pre /= Q_1d;
-              post *= 1;
+                CeedCall(CeedChebyshevContractBatch(pre, Q_1d, chebyshev_d, d == 0, d == 0 ? chebyshev_coeffs_elem : tmp[d % 2], tmp[(d + 1) % 2]));
+                pre /= Q_1d;
+              }
+              for (CeedInt c = 0; c < num_comp; c++) {
+                for (CeedInt b = 0; b < num_batch; b++) {
+                  v_array[(((CeedSize)pass * num_comp + c) * max_num_points + p + b) * num_elem + e] = tmp[dim % 2][c * B + b];
+                }
+              }
             }
-            for (CeedInt c = 0; c < num_comp; c++) v_array[c * total_num_points + p] = tmp[dim % 2][c];
           }
-          break;
         }
-        case CEED_EVAL_GRAD: {
-          CeedScalar tmp[2][num_comp * CeedIntPow(Q_1d, dim)], chebyshev_x[Q_1d];
-
-          // ---- Values at point
-          for (CeedInt p = 0; p < total_num_points; p++) {
-            // Dim**2 contractions, apply grad when pass == dim
-            for (CeedInt pass = 0; pass < dim; pass++) {
-              CeedInt pre = num_comp * CeedIntPow(Q_1d, dim - 1), post = 1;
-
+        CeedCall(CeedVectorRestoreArrayRead(vec_chebyshev, &chebyshev_coeffs));
+        CeedCall(CeedVectorRestoreArrayRead(x_ref, &x_array_read));
+        CeedCall(CeedVectorRestoreArray(v, &v_array));
+        break;
+      }
+      case CEED_TRANSPOSE: {
+        // Arbitrary points to nodes
+        CeedScalar       *chebyshev_coeffs;
+        const CeedScalar *u_array, *x_array_read;
+
+        // -- Transpose of evaluation of Chebyshev polynomials at arbitrary points
+        CeedCall(CeedVectorGetArrayWrite(vec_chebyshev, CEED_MEM_HOST, &chebyshev_coeffs));
+        CeedCall(CeedVectorGetArrayRead(x_ref, CEED_MEM_HOST, &x_array_read));
+        CeedCall(CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array));
+        for (CeedInt e = 0; e < num_elem; e++) {
+          for (CeedInt i = 0; i < num_coeffs; i++) chebyshev_coeffs_elem[i] = 0.0;
+          for (CeedInt p = 0; p < num_points[e]; p += B) {
+            const CeedInt num_batch = CeedIntMin(B, num_points[e] - p);
+
+            // ---- Chebyshev values for batch, padding with the origin
+            for (CeedInt d = 0; d < dim; d++) {
+              for (CeedInt b = 0; b < B; b++) x_batch[b] = b < num_batch ? x_array_read[(d * max_num_points + p + b) * num_elem + e] : 0.0;
+              CeedCall(CeedChebyshevAtPointsBatch(x_batch, Q_1d, &chebyshev_x[d * Q_1d * B], chebyshev_dx ? &chebyshev_dx[d * Q_1d * B] : NULL));
+            }
+            // ---- Values at points; padded points contribute zero
+            for (CeedInt pass = 0; pass < num_pass; pass++) {
+              CeedInt post = 1;
+
+              for (CeedInt c = 0; c < num_comp; c++) {
+                for (CeedInt b = 0; b < B; b++) {
+                  tmp[0][c * B + b] = b < num_batch ? u_array[(((CeedSize)pass * num_comp + c) * max_num_points + p + b) * num_elem + e] : 0.0;
+                }
+              }
               for (CeedInt d = 0; d < dim; d++) {
-                // ------ Tensor contract with current Chebyshev polynomial values
-                if (pass == d) CeedCall(CeedChebyshevDerivativeAtPoint(x_array_read[d * total_num_points + p], Q_1d, chebyshev_x));
-                else CeedCall(CeedChebyshevPolynomialsAtPoint(x_array_read[d * total_num_points + p], Q_1d, chebyshev_x));
-                CeedCall(CeedTensorContractApply(basis->contract, pre, Q_1d, post, 1, chebyshev_x, t_mode, false,
-                                                 d == 0 ? chebyshev_coeffs : tmp[d % 2], tmp[(d + 1) % 2]));
-                pre /= Q_1d;
-                post *= 1;
+                const CeedScalar *chebyshev_d = &(eval_mode == CEED_EVAL_GRAD && pass == d ? chebyshev_dx : chebyshev_x)[d * Q_1d * B];
+
+                CeedCall(CeedChebyshevContractTransposeBatch(num_comp, post, Q_1d, chebyshev_d, d == dim - 1, tmp[d % 2],
+                                                             d == dim - 1 ? chebyshev_coeffs_elem : tmp[(d + 1) % 2]));
+                post *= Q_1d;
               }
-              for (CeedInt c = 0; c < num_comp; c++) v_array[(pass * num_comp + c) * total_num_points + p] = tmp[dim % 2][c];
             }
           }
-          break;
+          for (CeedInt i = 0; i < num_coeffs; i++) chebyshev_coeffs[i * num_elem + e] = chebyshev_coeffs_elem[i];
         }
-        default:
-          // Nothing to do, excluded above
-          break;
+        CeedCall(CeedVectorRestoreArray(vec_chebyshev, &chebyshev_coeffs));
+        CeedCall(CeedVectorRestoreArrayRead(x_ref, &x_array_read));
+        CeedCall(CeedVectorRestoreArrayRead(u, &u_array));
+
+        // -- Interpolate transpose from Chebyshev coefficients
+        if (apply_add) CeedCall(CeedBasisApplyAdd(basis_chebyshev, num_elem, CEED_TRANSPOSE, CEED_EVAL_INTERP, vec_chebyshev, v));
+        else CeedCall(CeedBasisApply(basis_chebyshev, num_elem, CEED_TRANSPOSE, CEED_EVAL_INTERP, vec_chebyshev, v));
+        break;
       }
-      CeedCall(CeedVectorRestoreArrayRead(basis->vec_chebyshev, &chebyshev_coeffs));
-      CeedCall(CeedVectorRestoreArrayRead(x_ref, &x_array_read));
-      CeedCall(CeedVectorRestoreArray(v, &v_array));
-      break;
     }
-    case CEED_TRANSPOSE: {
-      // Note: No switch on e_mode here because only CEED_EVAL_INTERP is supported at this time
-      // Arbitrary points to nodes
-      CeedScalar       *chebyshev_coeffs;
-      const CeedScalar *u_array, *x_array_read;
+    CeedCall(CeedRestoreWorkVector(ceed, &vec_chebyshev));
+    CeedCall(CeedDestroy(&ceed));
+    CeedCall(CeedFree(&chebyshev_x));
+    CeedCall(CeedFree(&chebyshev_dx));
+    CeedCall(CeedFree(&chebyshev_coeffs_elem));
+    CeedCall(CeedFree(&tmp[0]));
+    CeedCall(CeedFree(&tmp[1]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
 
-      // -- Transpose of evaluation of Chebyshev polynomials at arbitrary points
-      CeedCall(CeedVectorGetArrayWrite(basis->vec_chebyshev, CEED_MEM_HOST, &chebyshev_coeffs));
-      CeedCall(CeedVectorGetArrayRead(x_ref, CEED_MEM_HOST, &x_array_read));
-      CeedCall(CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array));
+/**
+  @brief Build 1D Lagrange interpolation and derivative matrices, using the algorithm of Fornberg, 1998
 
-      switch (eval_mode) {
-        case CEED_EVAL_INTERP: {
-          CeedScalar tmp[2][num_comp * CeedIntPow(Q_1d, dim)], chebyshev_x[Q_1d];
+  @param[in]  nodes     Array of length `P` holding the nodes of the Lagrange polynomials on `[-1, 1]`
+  @param[in]  P         Number of nodes
+  @param[in]  q_ref_1d  Array of length `Q` holding the points to evaluate the Lagrange polynomials at
+  @param[in]  Q         Number of points
+  @param[out] interp_1d Zero initialized row-major (`Q * P`) matrix to hold the values of the Lagrange polynomials
+  @param[out] grad_1d   Zero initialized row-major (`Q * P`) matrix to hold the derivatives of the Lagrange polynomials
+
+  @return An error code: 0 - success, otherwise - failure
 
-          // ---- Values at point
-          for (CeedInt p = 0; p < total_num_points; p++) {
-            CeedInt pre = num_comp * 1, post = 1;
+  @ref Developer
+**/
+static int CeedLagrangeInterp1D(const CeedScalar *nodes, CeedInt P, const CeedScalar *q_ref_1d, CeedInt Q, CeedScalar *interp_1d,
+                                CeedScalar *grad_1d) {
+  CeedScalar c1, c2, c3, c4, dx;
 
-            for (CeedInt c = 0; c < num_comp; c++) tmp[0][c] = u_array[c * total_num_points + p];
-            for (CeedInt d = 0; d < dim; d++) {
-              // ------ Tensor contract with current Chebyshev polynomial values
-              CeedCall(CeedChebyshevPolynomialsAtPoint(x_array_read[d * total_num_points + p], Q_1d, chebyshev_x));
-              CeedCall(CeedTensorContractApply(basis->contract, pre, 1, post, Q_1d, chebyshev_x, t_mode, p > 0 && d == (dim - 1), tmp[d % 2],
-                                               d == (dim - 1) ? chebyshev_coeffs : tmp[(d + 1) % 2]));
-              pre /= 1;
-              post *= Q_1d;
-            }
-          }
-          break;
+  for (CeedInt i = 0; i < Q; i++) {
+    c1                   = 1.0;
+    c3                   = nodes[0] - q_ref_1d[i];
+    interp_1d[i * P + 0] = 1.0;
+    for (CeedInt j = 1; j < P; j++) {
+      c2 = 1.0;
+      c4 = c3;
+      c3 = nodes[j] - q_ref_1d[i];
+      for (CeedInt k = 0; k < j; k++) {
+        dx = nodes[j] - nodes[k];
+        c2 *= dx;
+        if (k == j - 1) {
+          grad_1d[i * P + j]   = c1 * (interp_1d[i * P + k] - c4 * grad_1d[i * P + k]) / c2;
+          interp_1d[i * P + j] = -c1 * c4 * interp_1d[i * P + k] / c2;
         }
-        case CEED_EVAL_GRAD: {
-          CeedScalar tmp[2][num_comp * CeedIntPow(Q_1d, dim)], chebyshev_x[Q_1d];
+        grad_1d[i * P + k]   = (c3 * grad_1d[i * P + k] - interp_1d[i * P + k]) / dx;
+        interp_1d[i * P + k] = c3 * interp_1d[i * P + k] / dx;
+      }
+      c1 = c2;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Build the dense interpolation and divergence or curl matrices of a tensor-product \f$H(\mathrm{div})\f$ or \f$H(\mathrm{curl})\f$ basis.
 
-          // ---- Values at point
-          for (CeedInt p = 0; p < total_num_points; p++) {
-            // Dim**2 contractions, apply grad when pass == dim
-            for (CeedInt pass = 0; pass < dim; pass++) {
-              CeedInt pre = num_comp * 1, post = 1;
+  Vector component `b` uses the closed 1D basis in direction `b` and the open 1D basis in the other directions for \f$H(\mathrm{div})\f$, and the reverse for \f$H(\mathrm{curl})\f$.
+  The nodes of component `b` form block `b` of the nodes, ordered lexicographically with the first direction fastest.
 
-              for (CeedInt c = 0; c < num_comp; c++) tmp[0][c] = u_array[(pass * num_comp + c) * total_num_points + p];
-              for (CeedInt d = 0; d < dim; d++) {
-                // ------ Tensor contract with current Chebyshev polynomial values
-                if (pass == d) CeedCall(CeedChebyshevDerivativeAtPoint(x_array_read[d * total_num_points + p], Q_1d, chebyshev_x));
-                else CeedCall(CeedChebyshevPolynomialsAtPoint(x_array_read[d * total_num_points + p], Q_1d, chebyshev_x));
-                CeedCall(CeedTensorContractApply(basis->contract, pre, 1, post, Q_1d, chebyshev_x, t_mode,
-                                                 (p > 0 || (p == 0 && pass > 0)) && d == (dim - 1), tmp[d % 2],
-                                                 d == (dim - 1) ? chebyshev_coeffs : tmp[(d + 1) % 2]));
-                pre /= 1;
-                post *= Q_1d;
-              }
-            }
+  @param[in]  fe_space       @ref CEED_FE_SPACE_HDIV or @ref CEED_FE_SPACE_HCURL
+  @param[in]  dim            Topological dimension, 2 or 3
+  @param[in]  P_1d           Number of nodes of the closed 1D basis
+  @param[in]  Q_1d           Number of quadrature points in one dimension
+  @param[in]  interp_1d      Row-major (`Q_1d * P_1d`) matrix of the closed 1D basis values
+  @param[in]  grad_1d        Row-major (`Q_1d * P_1d`) matrix of the closed 1D basis derivatives
+  @param[in]  interp_1d_open Row-major (`Q_1d * (P_1d - 1)`) matrix of the open 1D basis values
+  @param[out] interp         Zero initialized row-major (`dim * Q * P`) matrix of basis function values
+  @param[out] deriv          Zero initialized row-major (`q_comp * Q * P`) matrix of basis function divergence or curl
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisBuildTensorVectorMatrices(CeedFESpace fe_space, CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d,
+                                              const CeedScalar *grad_1d, const CeedScalar *interp_1d_open, CeedScalar *interp, CeedScalar *deriv) {
+  const bool    is_hdiv = fe_space == CEED_FE_SPACE_HDIV;
+  const CeedInt Q = CeedIntPow(Q_1d, dim), N = is_hdiv ? P_1d * CeedIntPow(P_1d - 1, dim - 1) : (P_1d - 1) * CeedIntPow(P_1d, dim - 1), P = dim * N;
+
+  for (CeedInt b = 0; b < dim; b++) {
+    for (CeedInt node = 0; node < N; node++) {
+      for (CeedInt q = 0; q < Q; q++) {
+        CeedInt    p_j[3], q_j[3], stride = 1;
+        CeedScalar value = 1.0;
+
+        // -- Decompose node and quadrature point indices by direction
+        for (CeedInt j = 0; j < dim; j++) {
+          const CeedInt n_j = ((j == b) == is_hdiv) ? P_1d : P_1d - 1;
+
+          p_j[j] = (node / stride) % n_j;
+          q_j[j] = (q / CeedIntPow(Q_1d, j)) % Q_1d;
+          stride *= n_j;
+        }
+        // -- Values
+        for (CeedInt j = 0; j < dim; j++) {
+          value *= ((j == b) == is_hdiv) ? interp_1d[q_j[j] * P_1d + p_j[j]] : interp_1d_open[q_j[j] * (P_1d - 1) + p_j[j]];
+        }
+        interp[(b * Q + q) * P + b * N + node] = value;
+        // -- Divergence, d_b u_b, or curl, sign * d_g u_b for g != b
+        for (CeedInt g = 0; g < dim; g++) {
+          CeedInt    k    = 0;
+          CeedScalar sign = 1.0;
+
+          if (is_hdiv ? g != b : g == b) continue;
+          if (!is_hdiv) {
+            k    = dim == 3 ? 3 - g - b : 0;
+            sign = (dim == 3 ? g == (k + 1) % 3 : g == 0) ? 1.0 : -1.0;
           }
-          break;
+          value = sign;
+          for (CeedInt j = 0; j < dim; j++) {
+            if (j == g) value *= grad_1d[q_j[j] * P_1d + p_j[j]];
+            else value *= ((j == b) == is_hdiv) ? interp_1d[q_j[j] * P_1d + p_j[j]] : interp_1d_open[q_j[j] * (P_1d - 1) + p_j[j]];
+          }
+          deriv[(k * Q + q) * P + b * N + node] += value;
         }
-        default:
-          // Nothing to do, excluded above
-          break;
       }
-      CeedCall(CeedVectorRestoreArray(basis->vec_chebyshev, &chebyshev_coeffs));
-      CeedCall(CeedVectorRestoreArrayRead(x_ref, &x_array_read));
-      CeedCall(CeedVectorRestoreArrayRead(u, &u_array));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
 
-      // -- Interpolate transpose from Chebyshev coefficients
-      if (apply_add) CeedCall(CeedBasisApplyAdd(basis->basis_chebyshev, 1, CEED_TRANSPOSE, CEED_EVAL_INTERP, basis->vec_chebyshev, v));
-      else CeedCall(CeedBasisApply(basis->basis_chebyshev, 1, CEED_TRANSPOSE, CEED_EVAL_INTERP, basis->vec_chebyshev, v));
-      break;
+/**
+  @brief Create a tensor-product basis for \f$H(\mathrm{div})\f$ or \f$H(\mathrm{curl})\f$ discretizations.
+
+  Falls back to a non tensor-product basis with the dense matrices if the backend does not implement tensor-product vector bases.
+
+  @param[in]  ceed           `Ceed` object used to create the `CeedBasis`
+  @param[in]  fe_space       @ref CEED_FE_SPACE_HDIV or @ref CEED_FE_SPACE_HCURL
+  @param[in]  dim            Topological dimension, 2 or 3
+  @param[in]  num_comp       Number of components (usually 1 for vectors in \f$H(\mathrm{div})\f$ and \f$H(\mathrm{curl})\f$ bases)
+  @param[in]  P_1d           Number of nodes of the closed 1D basis
+  @param[in]  Q_1d           Number of quadrature points in one dimension
+  @param[in]  interp_1d      Row-major (`Q_1d * P_1d`) matrix of the closed 1D basis values
+  @param[in]  grad_1d        Row-major (`Q_1d * P_1d`) matrix of the closed 1D basis derivatives
+  @param[in]  interp_1d_open Row-major (`Q_1d * (P_1d - 1)`) matrix of the open 1D basis values
+  @param[in]  q_ref_1d       Array of length `Q_1d` holding the locations of quadrature points on the 1D reference element `[-1, 1]`
+  @param[in]  q_weight_1d    Array of length `Q_1d` holding the quadrature weights on the reference element
+  @param[out] basis          Address of the variable where the newly created `CeedBasis` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisCreateTensorVector(Ceed ceed, CeedFESpace fe_space, CeedInt dim, CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d,
+                                       const CeedScalar *interp_1d, const CeedScalar *grad_1d, const CeedScalar *interp_1d_open,
+                                       const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d, CeedBasis *basis) {
+  const bool  is_hdiv = fe_space == CEED_FE_SPACE_HDIV;
+  CeedInt     P, Q, q_comp;
+  CeedScalar *interp, *deriv;
+  int (*BasisCreateTensor)(CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *,
+                           const CeedScalar *, CeedBasis) = is_hdiv ? ceed->BasisCreateTensorHdiv : ceed->BasisCreateTensorHcurl;
+
+  if (!BasisCreateTensor) {
+    Ceed delegate;
+
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "Basis"));
+    if (delegate) {
+      CeedCall(CeedBasisCreateTensorVector(delegate, fe_space, dim, num_comp, P_1d, Q_1d, interp_1d, grad_1d, interp_1d_open, q_ref_1d, q_weight_1d,
+                                           basis));
+      CeedCall(CeedDestroy(&delegate));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  CeedCheck(dim == 2 || dim == 3, ceed, CEED_ERROR_DIMENSION, "Tensor-product %s CeedBasis must have dimension 2 or 3", CeedFESpaces[fe_space]);
+  CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedBasis must have at least 1 component");
+  CeedCheck(P_1d > 1, ceed, CEED_ERROR_DIMENSION, "Tensor-product %s CeedBasis must have at least 2 nodes in the closed 1D basis",
+            CeedFESpaces[fe_space]);
+  CeedCheck(Q_1d > 0, ceed, CEED_ERROR_DIMENSION, "CeedBasis must have at least 1 quadrature point");
+
+  // Dense matrices
+  P      = dim * (is_hdiv ? P_1d * CeedIntPow(P_1d - 1, dim - 1) : (P_1d - 1) * CeedIntPow(P_1d, dim - 1));
+  Q      = CeedIntPow(Q_1d, dim);
+  q_comp = (is_hdiv || dim < 3) ? 1 : dim;
+  CeedCall(CeedCalloc(dim * Q * P, &interp));
+  CeedCall(CeedCalloc(q_comp * Q * P, &deriv));
+  CeedCall(CeedBasisBuildTensorVectorMatrices(fe_space, dim, P_1d, Q_1d, interp_1d, grad_1d, interp_1d_open, interp, deriv));
+
+  // Non tensor-product fallback
+  if (!BasisCreateTensor) {
+    const CeedElemTopology topo = dim == 2 ? CEED_TOPOLOGY_QUAD : CEED_TOPOLOGY_HEX;
+    CeedScalar            *q_ref, *q_weight;
+
+    CeedCall(CeedCalloc(dim * Q, &q_ref));
+    CeedCall(CeedCalloc(Q, &q_weight));
+    for (CeedInt q = 0; q < Q; q++) {
+      q_weight[q] = 1.0;
+      for (CeedInt d = 0; d < dim; d++) {
+        const CeedInt q_d = (q / CeedIntPow(Q_1d, d)) % Q_1d;
+
+        if (q_ref_1d) q_ref[d * Q + q] = q_ref_1d[q_d];
+        if (q_weight_1d) q_weight[q] *= q_weight_1d[q_d];
+      }
     }
+    if (is_hdiv) CeedCall(CeedBasisCreateHdiv(ceed, topo, num_comp, P, Q, interp, deriv, q_ref, q_weight, basis));
+    else CeedCall(CeedBasisCreateHcurl(ceed, topo, num_comp, P, Q, interp, deriv, q_ref, q_weight, basis));
+    CeedCall(CeedFree(&q_ref));
+    CeedCall(CeedFree(&q_weight));
+    CeedCall(CeedFree(&interp));
+    CeedCall(CeedFree(&deriv));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCall(CeedCalloc(1, basis));
+  CeedCall(CeedReferenceCopy(ceed, &(*basis)->ceed));
+  (*basis)->ref_count       = 1;
+  (*basis)->is_tensor_basis = true;
+  (*basis)->dim             = dim;
+  (*basis)->topo            = dim == 2 ? CEED_TOPOLOGY_QUAD : CEED_TOPOLOGY_HEX;
+  (*basis)->num_comp        = num_comp;
+  (*basis)->P_1d            = P_1d;
+  (*basis)->Q_1d            = Q_1d;
+  (*basis)->P               = P;
+  (*basis)->Q               = Q;
+  (*basis)->fe_space        = fe_space;
+  CeedCall(CeedCalloc(Q_1d, &(*basis)->q_ref_1d));
+  CeedCall(CeedCalloc(Q_1d, &(*basis)->q_weight_1d));
+  if (q_ref_1d) memcpy((*basis)->q_ref_1d, q_ref_1d, Q_1d * sizeof(q_ref_1d[0]));
+  if (q_weight_1d) memcpy((*basis)->q_weight_1d, q_weight_1d, Q_1d * sizeof(q_weight_1d[0]));
+  CeedCall(CeedCalloc(Q_1d * P_1d, &(*basis)->interp_1d));
+  CeedCall(CeedCalloc(Q_1d * P_1d, &(*basis)->grad_1d));
+  CeedCall(CeedCalloc(Q_1d * (P_1d - 1), &(*basis)->interp_1d_open));
+  if (interp_1d) memcpy((*basis)->interp_1d, interp_1d, Q_1d * P_1d * sizeof(interp_1d[0]));
+  if (grad_1d) memcpy((*basis)->grad_1d, grad_1d, Q_1d * P_1d * sizeof(grad_1d[0]));
+  if (interp_1d_open) memcpy((*basis)->interp_1d_open, interp_1d_open, Q_1d * (P_1d - 1) * sizeof(interp_1d_open[0]));
+  (*basis)->interp = interp;
+  if (is_hdiv) (*basis)->div = deriv;
+  else (*basis)->curl = deriv;
+  CeedCall(BasisCreateTensor(dim, P_1d, Q_1d, interp_1d, grad_1d, interp_1d_open, q_ref_1d, q_weight_1d, *basis));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create a tensor-product \f$H(\mathrm{div})\f$ or \f$H(\mathrm{curl})\f$ Lagrange basis
+
+  @param[in]  ceed      `Ceed` object used to create the `CeedBasis`
+  @param[in]  fe_space  @ref CEED_FE_SPACE_HDIV or @ref CEED_FE_SPACE_HCURL
+  @param[in]  dim       Topological dimension, 2 or 3
+  @param[in]  num_comp  Number of components
+  @param[in]  P         Number of Gauss-Lobatto nodes of the closed 1D basis; the open 1D basis uses `P - 1` Gauss nodes
+  @param[in]  Q         Number of quadrature points in one dimension
+  @param[in]  quad_mode Distribution of the `Q` quadrature points
+  @param[out] basis     Address of the variable where the newly created `CeedBasis` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisCreateTensorVectorLagrange(Ceed ceed, CeedFESpace fe_space, CeedInt dim, CeedInt num_comp, CeedInt P, CeedInt Q,
+                                               CeedQuadMode quad_mode, CeedBasis *basis) {
+  CeedScalar *nodes, *nodes_open, *weights_open, *interp_1d, *grad_1d, *interp_1d_open, *grad_1d_open, *q_ref_1d, *q_weight_1d;
+
+  CeedCheck(P > 1, ceed, CEED_ERROR_DIMENSION, "Tensor-product %s CeedBasis must have at least 2 nodes in the closed 1D basis",
+            CeedFESpaces[fe_space]);
+  CeedCheck(Q > 0, ceed, CEED_ERROR_DIMENSION, "CeedBasis must have at least 1 quadrature point");
+
+  // Get nodes and weights
+  CeedCall(CeedCalloc(P, &nodes));
+  CeedCall(CeedCalloc(P - 1, &nodes_open));
+  CeedCall(CeedCalloc(P - 1, &weights_open));
+  CeedCall(CeedCalloc(P * Q, &interp_1d));
+  CeedCall(CeedCalloc(P * Q, &grad_1d));
+  CeedCall(CeedCalloc((P - 1) * Q, &interp_1d_open));
+  CeedCall(CeedCalloc((P - 1) * Q, &grad_1d_open));
+  CeedCall(CeedCalloc(Q, &q_ref_1d));
+  CeedCall(CeedCalloc(Q, &q_weight_1d));
+  CeedCall(CeedLobattoQuadrature(P, nodes, NULL));
+  CeedCall(CeedGaussQuadrature(P - 1, nodes_open, weights_open));
+  switch (quad_mode) {
+    case CEED_GAUSS:
+      CeedCall(CeedGaussQuadrature(Q, q_ref_1d, q_weight_1d));
+      break;
+    case CEED_GAUSS_LOBATTO:
+      CeedCall(CeedLobattoQuadrature(Q, q_ref_1d, q_weight_1d));
+      break;
   }
+
+  // Build closed and open 1D bases
+  CeedCall(CeedLagrangeInterp1D(nodes, P, q_ref_1d, Q, interp_1d, grad_1d));
+  CeedCall(CeedLagrangeInterp1D(nodes_open, P - 1, q_ref_1d, Q, interp_1d_open, grad_1d_open));
+  CeedCall(CeedBasisCreateTensorVector(ceed, fe_space, dim, num_comp, P, Q, interp_1d, grad_1d, interp_1d_open, q_ref_1d, q_weight_1d, basis));
+
+  CeedCall(CeedFree(&nodes));
+  CeedCall(CeedFree(&nodes_open));
+  CeedCall(CeedFree(&weights_open));
+  CeedCall(CeedFree(&interp_1d));
+  CeedCall(CeedFree(&grad_1d));
+  CeedCall(CeedFree(&interp_1d_open));
+  CeedCall(CeedFree(&grad_1d_open));
+  CeedCall(CeedFree(&q_ref_1d));
+  CeedCall(CeedFree(&q_weight_1d));
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Evaluate an orthonormal Jacobi polynomial \f$P_n^{(\alpha, \beta)}\f$ on `[-1, 1]`
+
+  @param[in] x     Point to evaluate at
+  @param[in] alpha Jacobi parameter \f$\alpha\f$
+  @param[in] beta  Jacobi parameter \f$\beta\f$
+  @param[in] n     Polynomial degree
+
+  @return Value of the orthonormal Jacobi polynomial
+
+  @ref Developer
+**/
+static CeedScalar CeedJacobiPolynomial(CeedScalar x, CeedInt alpha, CeedInt beta, CeedInt n) {
+  const CeedScalar gamma_0 = pow(2.0, alpha + beta + 1) / (alpha + beta + 1) * tgamma(alpha + 1) * tgamma(beta + 1) / tgamma(alpha + beta + 1);
+  const CeedScalar gamma_1 = (alpha + 1.0) * (beta + 1.0) / (alpha + beta + 3.0) * gamma_0;
+  CeedScalar       p_0 = 1.0 / sqrt(gamma_0), p_1, a_old;
+
+  if (n == 0) return p_0;
+  p_1   = ((alpha + beta + 2.0) * x / 2.0 + (alpha - beta) / 2.0) / sqrt(gamma_1);
+  a_old = 2.0 / (2.0 + alpha + beta) * sqrt((alpha + 1.0) * (beta + 1.0) / (alpha + beta + 3.0));
+  for (CeedInt i = 1; i < n; i++) {
+    const CeedScalar h_1   = 2.0 * i + alpha + beta;
+    const CeedScalar a_new = 2.0 / (h_1 + 2.0) * sqrt((i + 1.0) * (i + 1.0 + alpha + beta) * (i + 1.0 + alpha) * (i + 1.0 + beta) / (h_1 + 1.0) / (h_1 + 3.0));
+    const CeedScalar b_new = -(alpha * alpha - beta * beta) / h_1 / (h_1 + 2.0);
+    const CeedScalar p_2   = (-a_old * p_0 + (x - b_new) * p_1) / a_new;
+
+    p_0   = p_1;
+    p_1   = p_2;
+    a_old = a_new;
+  }
+  return p_1;
+}
+
+/**
+  @brief Evaluate a 1D factor \f$(1 - x)^m P_n^{(\alpha, 0)}(x)\f$ of a collapsed-coordinate simplex mode and its derivative
+
+  @param[in]  x     Collapsed coordinate on `[-1, 1]`
+  @param[in]  alpha Jacobi parameter \f$\alpha\f$
+  @param[in]  m     Power of \f$(1 - x)\f$
+  @param[in]  n     Polynomial degree
+  @param[out] value Value of the factor
+  @param[out] deriv Derivative of the factor
+
+  @ref Developer
+**/
+static void CeedCollapsedFactor1D(CeedScalar x, CeedInt alpha, CeedInt m, CeedInt n, CeedScalar *value, CeedScalar *deriv) {
+  const CeedScalar p  = CeedJacobiPolynomial(x, alpha, 0, n);
+  const CeedScalar dp = n == 0 ? 0.0 : sqrt(n * (n + alpha + 1.0)) * CeedJacobiPolynomial(x, alpha + 1, 1, n - 1);
+
+  *value = pow(1.0 - x, m) * p;
+  *deriv = pow(1.0 - x, m) * dp - (m > 0 ? m * pow(1.0 - x, m - 1) * p : 0.0);
+}
+
+/**
+  @brief Build the collapsed-coordinate factors of the orthonormal Dubiner basis on a triangle or tetrahedron.
+
+  The mode `(i, j[, k])` is \f$\phi_{ijk}(a, b, c) = A_i(a) B_{ij}(b) C_{ijk}(c)\f$ in the collapsed coordinates, with modes ordered with `i` slowest and `k` fastest.
+  The output arrays hold the row-major (`Q_1d * P_1d`) matrix of \f$A_i\f$, followed by the (`Q_1d * P_1d (P_1d + 1) / 2`) matrix of \f$B_{ij}\f$ and, for tetrahedra, the (`Q_1d * num_nodes`) matrix of \f$C_{ijk}\f$.
+
+  @param[in]  dim         Dimension of the simplex, 2 or 3
+  @param[in]  P_1d        Number of nodes along an edge, polynomial degree plus one
+  @param[in]  Q_1d        Number of points in each collapsed coordinate
+  @param[in]  q_ref_1d    Array of length `Q_1d` holding the points in each collapsed coordinate
+  @param[out] interp_1d   Array to hold the collapsed-coordinate factors
+  @param[out] grad_1d     Array to hold the derivatives of the collapsed-coordinate factors
+
+  @ref Developer
+**/
+static void CeedBasisBuildCollapsedFactors(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *q_ref_1d, CeedScalar *interp_1d, CeedScalar *grad_1d) {
+  const CeedInt    p = P_1d - 1, num_pairs = P_1d * (P_1d + 1) / 2, num_modes = dim == 2 ? num_pairs : num_pairs * (P_1d + 2) / 3;
+  const CeedScalar scale   = dim == 2 ? sqrt(2.0) : 2.0 * sqrt(2.0);
+  CeedScalar      *A = interp_1d, *B = &interp_1d[Q_1d * P_1d], *C = &interp_1d[Q_1d * (P_1d + num_pairs)];
+  CeedScalar      *dA = grad_1d, *dB = &grad_1d[Q_1d * P_1d], *dC = &grad_1d[Q_1d * (P_1d + num_pairs)];
+
+  for (CeedInt q = 0; q < Q_1d; q++) {
+    const CeedScalar x = q_ref_1d[q];
+    CeedInt          ij = 0, ijk = 0;
+
+    for (CeedInt i = 0; i <= p; i++) {
+      CeedCollapsedFactor1D(x, 0, 0, i, &A[q * P_1d + i], &dA[q * P_1d + i]);
+      A[q * P_1d + i] *= scale;
+      dA[q * P_1d + i] *= scale;
+      for (CeedInt j = 0; j <= p - i; j++, ij++) {
+        CeedCollapsedFactor1D(x, 2 * i + 1, i, j, &B[q * num_pairs + ij], &dB[q * num_pairs + ij]);
+        if (dim == 2) continue;
+        for (CeedInt k = 0; k <= p - i - j; k++, ijk++) {
+          CeedCollapsedFactor1D(x, 2 * (i + j) + 2, i + j, k, &C[q * num_modes + ijk], &dC[q * num_modes + ijk]);
+        }
+      }
+    }
+  }
+}
+
+/**
+  @brief Evaluate the orthonormal Dubiner modes and their collapsed-coordinate derivatives at a point
+
+  @param[in]  dim   Dimension of the simplex, 2 or 3
+  @param[in]  P_1d  Number of nodes along an edge, polynomial degree plus one
+  @param[in]  x     Collapsed coordinates of the point
+  @param[out] phi   Array of length `num_modes` to hold the mode values
+  @param[out] dphi  Array of length `dim * num_modes` to hold the mode derivatives with respect to each collapsed coordinate
+
+  @ref Developer
+**/
+static void CeedBasisEvalCollapsedModes(CeedInt dim, CeedInt P_1d, const CeedScalar *x, CeedScalar *phi, CeedScalar *dphi) {
+  const CeedInt num_pairs = P_1d * (P_1d + 1) / 2, num_modes = dim == 2 ? num_pairs : num_pairs * (P_1d + 2) / 3;
+  const CeedInt offsets[3] = {0, P_1d, P_1d + num_pairs};
+  CeedScalar    interp_1d[3][P_1d + num_pairs + num_modes], grad_1d[3][P_1d + num_pairs + num_modes];
+  CeedInt       ij = 0, m = 0;
+
+  for (CeedInt d = 0; d < dim; d++) CeedBasisBuildCollapsedFactors(dim, P_1d, 1, &x[d], interp_1d[d], grad_1d[d]);
+  for (CeedInt i = 0; i < P_1d; i++) {
+    for (CeedInt j = 0; j < P_1d - i; j++, ij++) {
+      for (CeedInt k = 0; k < (dim == 2 ? 1 : P_1d - i - j); k++, m++) {
+        const CeedInt index[3] = {i, ij, m};
+
+        phi[m] = 1.0;
+        for (CeedInt d = 0; d < dim; d++) phi[m] *= interp_1d[d][offsets[d] + index[d]];
+        for (CeedInt g = 0; g < dim; g++) {
+          dphi[g * num_modes + m] = 1.0;
+          for (CeedInt d = 0; d < dim; d++) dphi[g * num_modes + m] *= (d == g ? grad_1d : interp_1d)[d][offsets[d] + index[d]];
+        }
+      }
+    }
+  }
+}
+
+/**
+  @brief Map collapsed coordinates on `[-1, 1]^dim` to the unit triangle or tetrahedron and compute the chain rule matrix
+
+  @param[in]  dim      Dimension of the simplex, 2 or 3
+  @param[in]  x        Collapsed coordinates of the point
+  @param[out] x_ref    Coordinates of the point on the unit simplex
+  @param[out] jacobian Row-major (`dim * dim`) matrix mapping derivatives with respect to the collapsed coordinates to derivatives with respect to the unit simplex coordinates
+
+  @ref Developer
+**/
+static void CeedCollapsedToReference(CeedInt dim, const CeedScalar *x, CeedScalar *x_ref, CeedScalar *jacobian) {
+  const CeedScalar a = x[0], b = x[1], c = dim == 3 ? x[2] : -1.0;
+
+  if (dim == 2) {
+    x_ref[0]    = (1 + a) * (1 - b) / 4;
+    x_ref[1]    = (1 + b) / 2;
+    jacobian[0] = 4 / (1 - b);
+    jacobian[1] = 0;
+    jacobian[2] = 2 * (1 + a) / (1 - b);
+    jacobian[3] = 2;
+  } else {
+    x_ref[0]    = (1 + a) * (1 - b) * (1 - c) / 8;
+    x_ref[1]    = (1 + b) * (1 - c) / 4;
+    x_ref[2]    = (1 + c) / 2;
+    jacobian[0] = 8 / ((1 - b) * (1 - c));
+    jacobian[1] = 0;
+    jacobian[2] = 0;
+    jacobian[3] = 4 * (1 + a) / ((1 - b) * (1 - c));
+    jacobian[4] = 4 / (1 - c);
+    jacobian[5] = 0;
+    jacobian[6] = 4 * (1 + a) / ((1 - b) * (1 - c));
+    jacobian[7] = 2 * (1 + b) / (1 - c);
+    jacobian[8] = 2;
+  }
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -820,7 +1357,7 @@ int CeedBasisSetData(CeedBasis basis, void *data) {
   @ref Backend
 **/
 int CeedBasisReference(CeedBasis basis) {
-  basis->ref_count++;
+  CeedAtomicIncrement(basis->ref_count);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -902,6 +1439,15 @@ int CeedBasisGetFlopsEstimate(CeedBasis basis, CeedTransposeMode t_mode, CeedEva
       pre /= P_1d;
       post *= Q_1d;
     }
+    if (basis->fe_space != CEED_FE_SPACE_H1 && eval_mode != CEED_EVAL_WEIGHT && eval_mode != CEED_EVAL_NONE) {
+      // Tensor-product H(div) and H(curl), one sum-factorized pass per vector component and derivative term, bounded by the closed basis size
+      const CeedInt num_terms = eval_mode == CEED_EVAL_INTERP ? dim : (basis->fe_space == CEED_FE_SPACE_HDIV ? dim : dim * (dim - 1));
+
+      CeedCheck(eval_mode != CEED_EVAL_GRAD, CeedBasisReturnCeed(basis), CEED_ERROR_INCOMPATIBLE, "Tensor basis evaluation for %s not supported",
+                CeedEvalModes[eval_mode]);
+      *flops = num_terms * tensor_flops;
+      return CEED_ERROR_SUCCESS;
+    }
     if (is_at_points) {
       CeedInt chebyshev_flops = (Q_1d - 2) * 3 + 1, d_chebyshev_flops = (Q_1d - 2) * 8 + 1;
       CeedInt point_tensor_flops = 0, pre = CeedIntPow(Q_1d, dim - 1), post = 1;
@@ -1514,8 +2060,8 @@ int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_
 **/
 int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P, CeedInt Q, CeedQuadMode quad_mode, CeedBasis *basis) {
   // Allocate
-  int        ierr = CEED_ERROR_SUCCESS;
-  CeedScalar c1, c2, c3, c4, dx, *nodes, *interp_1d, *grad_1d, *q_ref_1d, *q_weight_1d;
+  int         ierr = CEED_ERROR_SUCCESS;
+  CeedScalar *nodes, *interp_1d, *grad_1d, *q_ref_1d, *q_weight_1d;
 
   CeedCheck(dim > 0, ceed, CEED_ERROR_DIMENSION, "CeedBasis dimension must be a positive value");
   CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedBasis must have at least 1 component");
@@ -1540,28 +2086,7 @@ int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim, CeedInt num_comp, Ce
   if (ierr != CEED_ERROR_SUCCESS) goto cleanup;
 
   // Build B, D matrix
-  // Fornberg, 1998
-  for (CeedInt i = 0; i < Q; i++) {
-    c1                   = 1.0;
-    c3                   = nodes[0] - q_ref_1d[i];
-    interp_1d[i * P + 0] = 1.0;
-    for (CeedInt j = 1; j < P; j++) {
-      c2 = 1.0;
-      c4 = c3;
-      c3 = nodes[j] - q_ref_1d[i];
-      for (CeedInt k = 0; k < j; k++) {
-        dx = nodes[j] - nodes[k];
-        c2 *= dx;
-        if (k == j - 1) {
-          grad_1d[i * P + j]   = c1 * (interp_1d[i * P + k] - c4 * grad_1d[i * P + k]) / c2;
-          interp_1d[i * P + j] = -c1 * c4 * interp_1d[i * P + k] / c2;
-        }
-        grad_1d[i * P + k]   = (c3 * grad_1d[i * P + k] - interp_1d[i * P + k]) / dx;
-        interp_1d[i * P + k] = c3 * interp_1d[i * P + k] / dx;
-      }
-      c1 = c2;
-    }
-  }
+  CeedCall(CeedLagrangeInterp1D(nodes, P, q_ref_1d, Q, interp_1d, grad_1d));
   // Pass to CeedBasisCreateTensorH1
   CeedCall(CeedBasisCreateTensorH1(ceed, dim, num_comp, P, Q, interp_1d, grad_1d, q_ref_1d, q_weight_1d, basis));
 cleanup:
@@ -1573,6 +2098,106 @@ cleanup:
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a tensor-product basis for \f$H(\mathrm{div})\f$ discretizations on quadrilaterals or hexahedra, such as Raviart-Thomas elements.
+
+  Vector component `d` uses the closed 1D basis, with `P_1d` nodes, in direction `d` and the open 1D basis, with `P_1d - 1` nodes, in the other directions.
+  The nodes of each vector component form a contiguous block, ordered lexicographically with the first direction fastest.
+  Backends apply the basis with sum factorization.
+
+  @param[in]  ceed           `Ceed` object used to create the `CeedBasis`
+  @param[in]  dim            Topological dimension, 2 or 3
+  @param[in]  num_comp       Number of components (usually 1 for vectors in \f$H(\mathrm{div})\f$ bases)
+  @param[in]  P_1d           Number of nodes of the closed 1D basis
+  @param[in]  Q_1d           Number of quadrature points in one dimension
+  @param[in]  interp_1d      Row-major (`Q_1d * P_1d`) matrix expressing the values of the closed 1D basis functions at quadrature points
+  @param[in]  grad_1d        Row-major (`Q_1d * P_1d`) matrix expressing derivatives of the closed 1D basis functions at quadrature points
+  @param[in]  interp_1d_open Row-major (`Q_1d * (P_1d - 1)`) matrix expressing the values of the open 1D basis functions at quadrature points
+  @param[in]  q_ref_1d       Array of length `Q_1d` holding the locations of quadrature points on the 1D reference element `[-1, 1]`
+  @param[in]  q_weight_1d    Array of length `Q_1d` holding the quadrature weights on the reference element
+  @param[out] basis          Address of the variable where the newly created `CeedBasis` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateTensorHdiv(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d,
+                              const CeedScalar *grad_1d, const CeedScalar *interp_1d_open, const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d,
+                              CeedBasis *basis) {
+  return CeedBasisCreateTensorVector(ceed, CEED_FE_SPACE_HDIV, dim, num_comp, P_1d, Q_1d, interp_1d, grad_1d, interp_1d_open, q_ref_1d, q_weight_1d,
+                                     basis);
+}
+
+/**
+  @brief Create a tensor-product basis for \f$H(\mathrm{curl})\f$ discretizations on quadrilaterals or hexahedra, such as Nedelec elements of the first kind.
+
+  Vector component `d` uses the open 1D basis, with `P_1d - 1` nodes, in direction `d` and the closed 1D basis, with `P_1d` nodes, in the other directions.
+  The nodes of each vector component form a contiguous block, ordered lexicographically with the first direction fastest.
+  Backends apply the basis with sum factorization.
+
+  @param[in]  ceed           `Ceed` object used to create the `CeedBasis`
+  @param[in]  dim            Topological dimension, 2 or 3
+  @param[in]  num_comp       Number of components (usually 1 for vectors in \f$H(\mathrm{curl})\f$ bases)
+  @param[in]  P_1d           Number of nodes of the closed 1D basis
+  @param[in]  Q_1d           Number of quadrature points in one dimension
+  @param[in]  interp_1d      Row-major (`Q_1d * P_1d`) matrix expressing the values of the closed 1D basis functions at quadrature points
+  @param[in]  grad_1d        Row-major (`Q_1d * P_1d`) matrix expressing derivatives of the closed 1D basis functions at quadrature points
+  @param[in]  interp_1d_open Row-major (`Q_1d * (P_1d - 1)`) matrix expressing the values of the open 1D basis functions at quadrature points
+  @param[in]  q_ref_1d       Array of length `Q_1d` holding the locations of quadrature points on the 1D reference element `[-1, 1]`
+  @param[in]  q_weight_1d    Array of length `Q_1d` holding the quadrature weights on the reference element
+  @param[out] basis          Address of the variable where the newly created `CeedBasis` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateTensorHcurl(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d,
+                               const CeedScalar *grad_1d, const CeedScalar *interp_1d_open, const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d,
+                               CeedBasis *basis) {
+  return CeedBasisCreateTensorVector(ceed, CEED_FE_SPACE_HCURL, dim, num_comp, P_1d, Q_1d, interp_1d, grad_1d, interp_1d_open, q_ref_1d, q_weight_1d,
+                                     basis);
+}
+
+/**
+  @brief Create a tensor-product \f$H(\mathrm{div})\f$ Lagrange basis
+
+  @param[in]  ceed      `Ceed` object used to create the `CeedBasis`
+  @param[in]  dim       Topological dimension of element, 2 or 3
+  @param[in]  num_comp  Number of components (usually 1 for vectors in \f$H(\mathrm{div})\f$ bases)
+  @param[in]  P         Number of Gauss-Lobatto nodes of the closed 1D basis; the open 1D basis uses `P - 1` Gauss nodes.
+                          The resulting element is the Raviart-Thomas element `RT_k` with `k = P - 2`.
+  @param[in]  Q         Number of quadrature points in one dimension
+  @param[in]  quad_mode Distribution of the `Q` quadrature points (affects order of accuracy for the quadrature)
+  @param[out] basis     Address of the variable where the newly created `CeedBasis` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateTensorHdivLagrange(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P, CeedInt Q, CeedQuadMode quad_mode, CeedBasis *basis) {
+  return CeedBasisCreateTensorVectorLagrange(ceed, CEED_FE_SPACE_HDIV, dim, num_comp, P, Q, quad_mode, basis);
+}
+
+/**
+  @brief Create a tensor-product \f$H(\mathrm{curl})\f$ Lagrange basis
+
+  @param[in]  ceed      `Ceed` object used to create the `CeedBasis`
+  @param[in]  dim       Topological dimension of element, 2 or 3
+  @param[in]  num_comp  Number of components (usually 1 for vectors in \f$H(\mathrm{curl})\f$ bases)
+  @param[in]  P         Number of Gauss-Lobatto nodes of the closed 1D basis; the open 1D basis uses `P - 1` Gauss nodes.
+                          The resulting element is the Nedelec element of the first kind `N_k` with `k = P - 2`.
+  @param[in]  Q         Number of quadrature points in one dimension
+  @param[in]  quad_mode Distribution of the `Q` quadrature points (affects order of accuracy for the quadrature)
+  @param[out] basis     Address of the variable where the newly created `CeedBasis` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateTensorHcurlLagrange(Ceed ceed, CeedInt dim, CeedInt num_comp, CeedInt P, CeedInt Q, CeedQuadMode quad_mode, CeedBasis *basis) {
+  return CeedBasisCreateTensorVectorLagrange(ceed, CEED_FE_SPACE_HCURL, dim, num_comp, P, Q, quad_mode, basis);
+}
+
 /**
   @brief Create a non tensor-product basis for \f$H^1\f$ discretizations
 
@@ -1633,6 +2258,167 @@ int CeedBasisCreateH1(Ceed ceed, CeedElemTopology topo, CeedInt num_comp, CeedIn
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a Lagrange basis on a triangle or tetrahedron, applied with sum factorization in collapsed coordinates.
+
+  The nodes form the equispaced lattice on the unit simplex, ordered lexicographically with the first coordinate fastest.
+  The quadrature points are the tensor product of `Q` Gauss points in each collapsed coordinate, mapped to the unit simplex.
+  Internally, nodal values are mapped to coefficients of the orthonormal Dubiner basis, which factor as products of 1D functions of the collapsed coordinates (Karniadakis and Sherwin).
+  Backends that support collapsed-coordinate bases apply the dense nodal to modal matrix and then evaluate the modal basis with sum factorization; other backends use the dense matrices.
+  The dense nodal to modal map remains `O(P^(2 dim))` per element, so this does not reduce the asymptotic cost below that of the dense interpolation and gradient matrices.
+
+  @param[in]  ceed     `Ceed` object used to create the `CeedBasis`
+  @param[in]  topo     Topology of element, @ref CEED_TOPOLOGY_TRIANGLE or @ref CEED_TOPOLOGY_TET
+  @param[in]  num_comp Number of field components (1 for scalar fields)
+  @param[in]  P        Number of nodes along an edge, polynomial degree plus one
+  @param[in]  Q        Number of quadrature points in each collapsed coordinate
+  @param[out] basis    Address of the variable where the newly created `CeedBasis` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateSimplexH1(Ceed ceed, CeedElemTopology topo, CeedInt num_comp, CeedInt P, CeedInt Q, CeedBasis *basis) {
+  CeedInt     dim = 0, num_pairs, num_nodes, num_qpts, num_factors;
+  CeedScalar *q_ref_1d, *q_weight_1d, *interp_1d, *grad_1d, *v_inv, *jacobian, *q_ref, *q_weight, *interp, *grad;
+
+  if (!ceed->BasisCreateSimplexH1) {
+    Ceed delegate;
+
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "Basis"));
+    if (delegate) {
+      CeedCall(CeedBasisCreateSimplexH1(delegate, topo, num_comp, P, Q, basis));
+      CeedCall(CeedDestroy(&delegate));
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  CeedCheck(topo == CEED_TOPOLOGY_TRIANGLE || topo == CEED_TOPOLOGY_TET, ceed, CEED_ERROR_UNSUPPORTED,
+            "Collapsed-coordinate CeedBasis only supported for triangles and tetrahedra");
+  CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedBasis must have at least 1 component");
+  CeedCheck(P > 1, ceed, CEED_ERROR_DIMENSION, "Simplex CeedBasis must have at least 2 nodes along an edge");
+  CeedCheck(Q > 0, ceed, CEED_ERROR_DIMENSION, "CeedBasis must have at least 1 quadrature point");
+
+  CeedCall(CeedBasisGetTopologyDimension(topo, &dim));
+  num_pairs   = P * (P + 1) / 2;
+  num_nodes   = dim == 2 ? num_pairs : num_pairs * (P + 2) / 3;
+  num_qpts    = CeedIntPow(Q, dim);
+  num_factors = Q * (P + num_pairs + (dim == 3 ? num_nodes : 0));
+
+  // Collapsed-coordinate quadrature and factors of the Dubiner modes
+  CeedCall(CeedCalloc(Q, &q_ref_1d));
+  CeedCall(CeedCalloc(Q, &q_weight_1d));
+  CeedCall(CeedCalloc(num_factors, &interp_1d));
+  CeedCall(CeedCalloc(num_factors, &grad_1d));
+  CeedCall(CeedGaussQuadrature(Q, q_ref_1d, q_weight_1d));
+  CeedBasisBuildCollapsedFactors(dim, P, Q, q_ref_1d, interp_1d, grad_1d);
+
+  // Inverse Vandermonde matrix, mapping values at the nodes to modal coefficients
+  CeedCall(CeedCalloc(num_nodes * num_nodes, &v_inv));
+  {
+    CeedInt     n = 0;
+    CeedScalar *vandermonde, dphi[dim * num_nodes];
+
+    CeedCall(CeedCalloc(num_nodes * num_nodes, &vandermonde));
+    for (CeedInt k = 0; k < (dim == 3 ? P : 1); k++) {
+      for (CeedInt j = 0; j < P - k; j++) {
+        for (CeedInt i = 0; i < P - j - k; i++, n++) {
+          const CeedScalar r = 2.0 * i / (P - 1) - 1, s = 2.0 * j / (P - 1) - 1, t = 2.0 * k / (P - 1) - 1;
+          CeedScalar       x[3];
+
+          // Collapsed coordinates, the collapsed vertices use any value
+          if (dim == 2) {
+            x[0] = fabs(1 - s) > CEED_EPSILON ? 2 * (1 + r) / (1 - s) - 1 : -1;
+            x[1] = s;
+          } else {
+            x[0] = fabs(s + t) > CEED_EPSILON ? 2 * (1 + r) / (-s - t) - 1 : -1;
+            x[1] = fabs(1 - t) > CEED_EPSILON ? 2 * (1 + s) / (1 - t) - 1 : -1;
+            x[2] = t;
+          }
+          CeedBasisEvalCollapsedModes(dim, P, x, &vandermonde[n * num_nodes], dphi);
+        }
+      }
+    }
+    CeedCall(CeedMatrixPseudoinverse(ceed, vandermonde, num_nodes, num_nodes, v_inv));
+    CeedCall(CeedFree(&vandermonde));
+  }
+
+  // Quadrature points and dense matrices
+  CeedCall(CeedCalloc(dim * num_qpts, &q_ref));
+  CeedCall(CeedCalloc(num_qpts, &q_weight));
+  CeedCall(CeedCalloc(dim * dim * num_qpts, &jacobian));
+  CeedCall(CeedCalloc(num_qpts * num_nodes, &interp));
+  CeedCall(CeedCalloc(dim * num_qpts * num_nodes, &grad));
+  {
+    CeedScalar *phi, *grad_phi;
+
+    CeedCall(CeedCalloc(num_qpts * num_nodes, &phi));
+    CeedCall(CeedCalloc(dim * num_qpts * num_nodes, &grad_phi));
+    for (CeedInt q = 0; q < num_qpts; q++) {
+      CeedScalar x[3], x_ref[3], dphi[dim * num_nodes];
+
+      // Weights include the Jacobian of the collapse, (1 - b) / 8 on triangles and (1 - b) (1 - c)^2 / 64 on tetrahedra
+      q_weight[q] = 1.0 / CeedIntPow(2, 3 * dim - 3);
+      for (CeedInt d = 0; d < dim; d++) {
+        const CeedInt q_d = (q / CeedIntPow(Q, d)) % Q;
+
+        x[d] = q_ref_1d[q_d];
+        q_weight[q] *= q_weight_1d[q_d] * pow(1 - x[d], d);
+      }
+      CeedCollapsedToReference(dim, x, x_ref, &jacobian[q * dim * dim]);
+      for (CeedInt d = 0; d < dim; d++) q_ref[d * num_qpts + q] = x_ref[d];
+      CeedBasisEvalCollapsedModes(dim, P, x, &phi[q * num_nodes], dphi);
+      for (CeedInt d = 0; d < dim; d++) {
+        for (CeedInt m = 0; m < num_nodes; m++) {
+          CeedScalar sum = 0.0;
+
+          for (CeedInt g = 0; g < dim; g++) sum += jacobian[(q * dim + d) * dim + g] * dphi[g * num_nodes + m];
+          grad_phi[(d * num_qpts + q) * num_nodes + m] = sum;
+        }
+      }
+    }
+    CeedCall(CeedMatrixMatrixMultiply(ceed, phi, v_inv, interp, num_qpts, num_nodes, num_nodes));
+    for (CeedInt d = 0; d < dim; d++) {
+      CeedCall(CeedMatrixMatrixMultiply(ceed, &grad_phi[d * num_qpts * num_nodes], v_inv, &grad[d * num_qpts * num_nodes], num_qpts, num_nodes,
+                                        num_nodes));
+    }
+    CeedCall(CeedFree(&phi));
+    CeedCall(CeedFree(&grad_phi));
+  }
+
+  if (!ceed->BasisCreateSimplexH1) {
+    // Dense fallback
+    CeedCall(CeedBasisCreateH1(ceed, topo, num_comp, num_nodes, num_qpts, interp, grad, q_ref, q_weight, basis));
+    CeedCall(CeedFree(&q_ref));
+    CeedCall(CeedFree(&q_weight));
+    CeedCall(CeedFree(&interp));
+    CeedCall(CeedFree(&grad));
+  } else {
+    CeedCall(CeedCalloc(1, basis));
+    CeedCall(CeedReferenceCopy(ceed, &(*basis)->ceed));
+    (*basis)->ref_count       = 1;
+    (*basis)->is_tensor_basis = false;
+    (*basis)->dim             = dim;
+    (*basis)->topo            = topo;
+    (*basis)->num_comp        = num_comp;
+    (*basis)->P               = num_nodes;
+    (*basis)->Q               = num_qpts;
+    (*basis)->fe_space        = CEED_FE_SPACE_H1;
+    (*basis)->q_ref_1d        = q_ref;
+    (*basis)->q_weight_1d     = q_weight;
+    (*basis)->interp          = interp;
+    (*basis)->grad            = grad;
+    CeedCall(ceed->BasisCreateSimplexH1(topo, dim, P, Q, v_inv, interp_1d, grad_1d, jacobian, *basis));
+  }
+  CeedCall(CeedFree(&q_ref_1d));
+  CeedCall(CeedFree(&q_weight_1d));
+  CeedCall(CeedFree(&interp_1d));
+  CeedCall(CeedFree(&grad_1d));
+  CeedCall(CeedFree(&v_inv));
+  CeedCall(CeedFree(&jacobian));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Create a non tensor-product basis for \f$H(\mathrm{div})\f$ discretizations
 
@@ -1790,11 +2576,14 @@ int CeedBasisCreateProjection(CeedBasis basis_from, CeedBasis basis_to, CeedBasi
 
   // Build basis
   {
-    bool is_tensor_to, is_tensor_from;
+    bool        is_tensor_to, is_tensor_from;
+    CeedFESpace fe_space_to, fe_space_from;
 
     CeedCall(CeedBasisIsTensor(basis_to, &is_tensor_to));
     CeedCall(CeedBasisIsTensor(basis_from, &is_tensor_from));
-    create_tensor = is_tensor_from && is_tensor_to;
+    CeedCall(CeedBasisGetFESpace(basis_to, &fe_space_to));
+    CeedCall(CeedBasisGetFESpace(basis_from, &fe_space_from));
+    create_tensor = is_tensor_from && is_tensor_to && fe_space_to == CEED_FE_SPACE_H1 && fe_space_from == CEED_FE_SPACE_H1;
   }
   CeedCall(CeedBasisGetDimension(basis_to, &dim));
   CeedCall(CeedBasisGetNumComponents(basis_from, &num_comp));
@@ -1886,6 +2675,7 @@ int CeedBasisView(CeedBasis basis, FILE *stream) {
     CeedCall(CeedScalarView("qweight1d", "\t% 12.8f", 1, Q_1d, q_weight_1d, stream));
     CeedCall(CeedScalarView("interp1d", "\t% 12.8f", Q_1d, P_1d, interp_1d, stream));
     CeedCall(CeedScalarView("grad1d", "\t% 12.8f", Q_1d, P_1d, grad_1d, stream));
+    if (fe_space != CEED_FE_SPACE_H1) CeedCall(CeedScalarView("interp1dopen", "\t% 12.8f", Q_1d, P_1d - 1, basis->interp_1d_open, stream));
   } else {  // non-tensor basis
     CeedInt           P, Q, dim, q_comp;
     const CeedScalar *q_ref, *q_weight, *interp, *grad, *div, *curl;
@@ -1977,6 +2767,35 @@ int CeedBasisApplyAdd(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mod
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Apply basis interpolation and gradient evaluation from nodes to quadrature points together
+
+  Backends may reuse the interpolation passes of the gradient evaluation, which is cheaper than two calls to @ref CeedBasisApply() when a field is
+    needed with both @ref CEED_EVAL_INTERP and @ref CEED_EVAL_GRAD.
+
+  @param[in]  basis    `CeedBasis` to evaluate
+  @param[in]  num_elem The number of elements to apply the basis evaluation to;
+                         the backend will specify the ordering in @ref CeedElemRestrictionCreate()
+  @param[in]  u        Input `CeedVector`
+  @param[out] v_interp Output `CeedVector` for interpolated values
+  @param[out] v_grad   Output `CeedVector` for gradients
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisApplyInterpAndGrad(CeedBasis basis, CeedInt num_elem, CeedVector u, CeedVector v_interp, CeedVector v_grad) {
+  CeedCall(CeedBasisApplyCheckDims(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u, v_interp));
+  CeedCall(CeedBasisApplyCheckDims(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, u, v_grad));
+  if (basis->ApplyInterpAndGrad) {
+    CeedCall(basis->ApplyInterpAndGrad(basis, num_elem, u, v_interp, v_grad));
+  } else {
+    CeedCall(CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u, v_interp));
+    CeedCall(CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, u, v_grad));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Apply basis evaluation from nodes to arbitrary points
 
@@ -2268,7 +3087,7 @@ int CeedBasisGetInterp1D(CeedBasis basis, const CeedScalar **interp_1d) {
   @ref Advanced
 **/
 int CeedBasisGetGrad(CeedBasis basis, const CeedScalar **grad) {
-  if (!basis->grad && basis->is_tensor_basis) {
+  if (!basis->grad && basis->is_tensor_basis && basis->fe_space == CEED_FE_SPACE_H1) {
     // Allocate
     CeedCall(CeedMalloc(basis->dim * basis->Q * basis->P, &basis->grad));
 
@@ -2353,7 +3172,7 @@ int CeedBasisGetCurl(CeedBasis basis, const CeedScalar **curl) {
   @ref User
 **/
 int CeedBasisDestroy(CeedBasis *basis) {
-  if (!*basis || *basis == CEED_BASIS_NONE || --(*basis)->ref_count > 0) {
+  if (!*basis || *basis == CEED_BASIS_NONE || CeedAtomicDecrement((*basis)->ref_count) > 0) {
     *basis = NULL;
     return CEED_ERROR_SUCCESS;
   }
@@ -2363,11 +3182,11 @@ int CeedBasisDestroy(CeedBasis *basis) {
   CeedCall(CeedFree(&(*basis)->q_weight_1d));
   CeedCall(CeedFree(&(*basis)->interp));
   CeedCall(CeedFree(&(*basis)->interp_1d));
+  CeedCall(CeedFree(&(*basis)->interp_1d_open));
   CeedCall(CeedFree(&(*basis)->grad));
   CeedCall(CeedFree(&(*basis)->grad_1d));
   CeedCall(CeedFree(&(*basis)->div));
   CeedCall(CeedFree(&(*basis)->curl));
-  CeedCall(CeedVectorDestroy(&(*basis)->vec_chebyshev));
   CeedCall(CeedBasisDestroy(&(*basis)->basis_chebyshev));
   CeedCall(CeedDestroy(&(*basis)->ceed));
   CeedCall(CeedFree(basis));
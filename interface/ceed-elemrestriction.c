@@ -8,6 +8,7 @@
 #include <ceed-impl.h>
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
@@ -98,6 +99,292 @@ int CeedPermutePadCurlOrients(const CeedInt8 *curl_orients, CeedInt8 *block_curl
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute the level structure of the connected component of an element in the element adjacency graph
+
+  Elements are reached with a breadth first search from `start`, two elements are adjacent if they share a node.
+
+  @param[in]     elem_size        Size of each element
+  @param[in]     offsets          Array of shape `[num_elem, elem_size]` with the node of each element node
+  @param[in]     node_elem_start  Array of length `l_size + 1` with the start of the elements of each node in `node_elems`
+  @param[in]     node_elems       Elements containing each node
+  @param[in]     start            Root element of the level structure
+  @param[in]     stamp            Value marking elements reached by this search, different from all values in `level_mark` before the call
+  @param[in,out] level_mark       Array of length `num_elem`, set to `stamp` for the elements reached
+  @param[out]    queue            Array of length `num_elem` to store the elements reached, ordered by level
+  @param[out]    num_levels       Number of levels, the eccentricity of `start` plus one
+  @param[out]    last_level_start Position in `queue` of the first element of the last level
+  @param[out]    num_queued       Number of elements reached
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+static int CeedElemRestrictionLevelStructure(CeedInt elem_size, const CeedInt *offsets, const CeedInt *node_elem_start, const CeedInt *node_elems,
+                                             CeedInt start, CeedInt stamp, CeedInt *level_mark, CeedInt *queue, CeedInt *num_levels,
+                                             CeedInt *last_level_start, CeedInt *num_queued) {
+  CeedInt level_start = 0;
+
+  level_mark[start] = stamp;
+  queue[0]          = start;
+  *num_queued       = 1;
+  *num_levels       = 0;
+  while (level_start < *num_queued) {
+    const CeedInt level_end = *num_queued;
+
+    (*num_levels)++;
+    *last_level_start = level_start;
+    for (CeedInt q = level_start; q < level_end; q++) {
+      for (CeedInt n = 0; n < elem_size; n++) {
+        const CeedInt node = offsets[queue[q] * elem_size + n];
+
+        for (CeedInt k = node_elem_start[node]; k < node_elem_start[node + 1]; k++) {
+          const CeedInt f = node_elems[k];
+
+          if (level_mark[f] != stamp) {
+            level_mark[f]          = stamp;
+            queue[(*num_queued)++] = f;
+          }
+        }
+      }
+    }
+    level_start = level_end;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the offsets of a structured grid of tensor-product elements
+
+  Grid nodes are numbered lexicographically with the first direction fastest, elements and element nodes are ordered the same way.
+
+  @param[in]  dim         Dimension of the grid
+  @param[in]  num_elem_1d Array of length `dim` with the number of elements in each direction
+  @param[in]  P_1d        Number of nodes per element in each direction
+  @param[in]  is_periodic Array of length `dim` with the periodicity in each direction
+  @param[in]  node_stride Stride between consecutive grid nodes in the L-vector
+  @param[out] offsets     Array of shape `[num_elem, elem_size]`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+static int CeedStructuredOffsets(CeedInt dim, const CeedInt num_elem_1d[3], CeedInt P_1d, const bool is_periodic[3], CeedInt node_stride,
+                                 CeedInt *offsets) {
+  CeedInt num_nodes_1d[3] = {1, 1, 1}, n_e[3] = {1, 1, 1}, p[3] = {1, 1, 1}, num_elem = 1, elem_size = 1;
+
+  for (CeedInt d = 0; d < dim; d++) {
+    n_e[d]          = num_elem_1d[d];
+    p[d]            = P_1d;
+    num_nodes_1d[d] = num_elem_1d[d] * (P_1d - 1) + !is_periodic[d];
+    num_elem *= num_elem_1d[d];
+    elem_size *= P_1d;
+  }
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_x = e % n_e[0], e_y = (e / n_e[0]) % n_e[1], e_z = e / (n_e[0] * n_e[1]);
+
+    for (CeedInt k = 0; k < p[2]; k++) {
+      for (CeedInt j = 0; j < p[1]; j++) {
+        for (CeedInt i = 0; i < p[0]; i++) {
+          const CeedInt x = (e_x * (P_1d - 1) + i) % num_nodes_1d[0], y = (e_y * (P_1d - 1) + j) % num_nodes_1d[1],
+                        z = (e_z * (P_1d - 1) + k) % num_nodes_1d[2];
+
+          offsets[e * elem_size + (k * p[1] + j) * p[0] + i] = ((z * num_nodes_1d[1] + y) * num_nodes_1d[0] + x) * node_stride;
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Check the structure of a structured `CeedElemRestriction` and compute the implied sizes
+
+  @param[in]  ceed        `Ceed` context for error handling
+  @param[in]  dim         Dimension of the grid, at most 3
+  @param[in]  num_elem_1d Array of length `dim` with the number of elements in each direction
+  @param[in]  P_1d        Number of nodes per element in each direction
+  @param[in]  is_periodic Array of length `dim` with the periodicity in each direction, or `NULL` for no periodic directions
+  @param[in]  num_comp    Number of field components per grid node
+  @param[in]  node_stride Stride between consecutive grid nodes in the L-vector
+  @param[in]  comp_stride Stride between components for the same grid node
+  @param[in]  l_size      The size of the L-vector
+  @param[out] periodic    Array of length 3 to store the periodicity in each direction
+  @param[out] num_elem    Variable to store the total number of elements
+  @param[out] elem_size   Variable to store the number of nodes per element
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedStructuredCheck(Ceed ceed, CeedInt dim, const CeedInt num_elem_1d[], CeedInt P_1d, const bool is_periodic[], CeedInt num_comp,
+                               CeedInt node_stride, CeedInt comp_stride, CeedSize l_size, bool periodic[3], CeedInt *num_elem, CeedInt *elem_size) {
+  CeedSize max_index = 0, num_nodes = 1;
+
+  CeedCheck(dim >= 1 && dim <= 3, ceed, CEED_ERROR_DIMENSION, "Structured CeedElemRestriction dimension must be 1, 2, or 3");
+  CeedCheck(P_1d >= 2, ceed, CEED_ERROR_DIMENSION, "Structured CeedElemRestriction must have at least 2 nodes per direction");
+  CeedCheck(num_comp > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction must have at least 1 component");
+  CeedCheck(node_stride > 0, ceed, CEED_ERROR_DIMENSION, "Structured CeedElemRestriction node stride must be at least 1");
+  CeedCheck(num_comp == 1 || comp_stride > 0, ceed, CEED_ERROR_DIMENSION, "CeedElemRestriction component stride must be at least 1");
+  *num_elem  = 1;
+  *elem_size = 1;
+  for (CeedInt d = 0; d < 3; d++) periodic[d] = false;
+  for (CeedInt d = 0; d < dim; d++) {
+    CeedCheck(num_elem_1d[d] >= 0, ceed, CEED_ERROR_DIMENSION, "Number of elements must be non-negative");
+    periodic[d] = is_periodic ? is_periodic[d] : false;
+    num_nodes *= (CeedSize)num_elem_1d[d] * (P_1d - 1) + !periodic[d];
+    *num_elem *= num_elem_1d[d];
+    *elem_size *= P_1d;
+  }
+  if (*num_elem > 0) max_index = (num_nodes - 1) * node_stride + (CeedSize)(num_comp - 1) * comp_stride;
+  CeedCheck(*num_elem == 0 || max_index < l_size, ceed, CEED_ERROR_DIMENSION,
+            "L-vector size must be greater than the largest structured grid offset. Expected: > %" CeedSize_FMT " Found: %" CeedSize_FMT,
+            max_index, l_size);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Solve a small dense system with the Jacobian of the map from reference to physical coordinates
+
+  @param[in]  dim   Dimension of the system, at most 3
+  @param[in]  J     Jacobian, `J[i][j]` is the derivative of physical coordinate `i` with respect to reference coordinate `j`
+  @param[in]  r     Right hand side
+  @param[out] delta Solution of `J delta = r`
+
+  @return Determinant of `J`; `delta` is not set if it is zero
+
+  @ref Developer
+**/
+static CeedScalar CeedPointsSolveJacobian(CeedInt dim, const CeedScalar J[3][3], const CeedScalar r[3], CeedScalar delta[3]) {
+  CeedScalar det = 0.0, adj[3][3];
+
+  switch (dim) {
+    case 1:
+      det       = J[0][0];
+      adj[0][0] = 1.0;
+      break;
+    case 2:
+      det       = J[0][0] * J[1][1] - J[0][1] * J[1][0];
+      adj[0][0] = J[1][1];
+      adj[0][1] = -J[0][1];
+      adj[1][0] = -J[1][0];
+      adj[1][1] = J[0][0];
+      break;
+    case 3:
+      for (CeedInt i = 0; i < 3; i++) {
+        for (CeedInt j = 0; j < 3; j++) {
+          // Cofactor of J[j][i], with cyclic indices giving the sign
+          adj[i][j] = J[(j + 1) % 3][(i + 1) % 3] * J[(j + 2) % 3][(i + 2) % 3] - J[(j + 1) % 3][(i + 2) % 3] * J[(j + 2) % 3][(i + 1) % 3];
+        }
+      }
+      det = J[0][0] * adj[0][0] + J[0][1] * adj[1][0] + J[0][2] * adj[2][0];
+      break;
+  }
+  if (det == 0.0) return det;
+  for (CeedInt i = 0; i < dim; i++) {
+    delta[i] = 0.0;
+    for (CeedInt j = 0; j < dim; j++) delta[i] += adj[i][j] * r[j];
+    delta[i] /= det;
+  }
+  return det;
+}
+
+/**
+  @brief Compute reference coordinates of a batch of points in one element with Newton iteration.
+
+  All points in the batch share each evaluation of the element map and its gradient.
+
+  @param[in]  basis_x   Tensor-product H^1 `CeedBasis` for the mesh coordinates
+  @param[in]  x_elem    `CeedVector` of nodal coordinates of the element
+  @param[in]  num_points Number of points in the batch
+  @param[in]  x_target  Physical coordinates of the points, shape `[dim, num_points]`
+  @param[in]  tol       Tolerance on the physical coordinate residual
+  @param[out] x_ref     `CeedVector` of length at least `dim * num_points` to store reference coordinates, shape `[dim, num_points]`
+  @param[out] x_phys    Work `CeedVector` of length at least `dim * num_points`
+  @param[out] dx_phys   Work `CeedVector` of length at least `dim * dim * num_points`
+  @param[out] is_active Work array of length `num_points`
+  @param[out] is_inside Array of length `num_points`, set to true for points that converged inside the reference element
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedPointsNewtonInElement(CeedBasis basis_x, CeedVector x_elem, CeedInt num_points, const CeedScalar *x_target, CeedScalar tol,
+                                     CeedVector x_ref, CeedVector x_phys, CeedVector dx_phys, bool *is_active, bool *is_inside) {
+  const CeedInt    max_its = 50;
+  const CeedScalar max_ref = 4.0, tol_ref = 1e3 * CEED_EPSILON;
+  CeedInt          dim, num_active = num_points;
+  CeedScalar      *x_ref_array;
+
+  CeedCall(CeedBasisGetDimension(basis_x, &dim));
+
+  // Start from the element center
+  CeedCall(CeedVectorGetArray(x_ref, CEED_MEM_HOST, &x_ref_array));
+  for (CeedInt i = 0; i < dim * num_points; i++) x_ref_array[i] = 0.0;
+  CeedCall(CeedVectorRestoreArray(x_ref, &x_ref_array));
+  for (CeedInt p = 0; p < num_points; p++) {
+    is_active[p] = true;
+    is_inside[p] = false;
+  }
+
+  for (CeedInt it = 0; it < max_its && num_active > 0; it++) {
+    const CeedScalar *x_phys_array, *dx_phys_array;
+
+    CeedCall(CeedBasisApplyAtPoints(basis_x, 1, &num_points, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, x_ref, x_elem, x_phys));
+    CeedCall(CeedBasisApplyAtPoints(basis_x, 1, &num_points, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, x_ref, x_elem, dx_phys));
+    CeedCall(CeedVectorGetArrayRead(x_phys, CEED_MEM_HOST, &x_phys_array));
+    CeedCall(CeedVectorGetArrayRead(dx_phys, CEED_MEM_HOST, &dx_phys_array));
+    CeedCall(CeedVectorGetArray(x_ref, CEED_MEM_HOST, &x_ref_array));
+    num_active = 0;
+    for (CeedInt p = 0; p < num_points; p++) {
+      CeedScalar r[3], delta[3], J[3][3], res = 0.0;
+
+      if (!is_active[p]) continue;
+      for (CeedInt i = 0; i < dim; i++) {
+        r[i] = x_phys_array[i * num_points + p] - x_target[i * num_points + p];
+        if (fabs(r[i]) > res) res = fabs(r[i]);
+      }
+      if (res <= tol) {
+        // Converged, check that the point is in the reference element
+        is_active[p] = false;
+        is_inside[p] = true;
+        for (CeedInt i = 0; i < dim; i++) is_inside[p] = is_inside[p] && fabs(x_ref_array[i * num_points + p]) <= 1.0 + tol_ref;
+        continue;
+      }
+      for (CeedInt i = 0; i < dim; i++) {
+        for (CeedInt j = 0; j < dim; j++) J[i][j] = dx_phys_array[(j * dim + i) * num_points + p];
+      }
+      if (CeedPointsSolveJacobian(dim, J, r, delta) == 0.0) {
+        is_active[p] = false;
+        continue;
+      }
+      for (CeedInt i = 0; i < dim; i++) {
+        x_ref_array[i * num_points + p] -= delta[i];
+        // Diverging iterates are far outside of the element
+        if (fabs(x_ref_array[i * num_points + p]) > max_ref) is_active[p] = false;
+      }
+      num_active += is_active[p];
+    }
+    CeedCall(CeedVectorRestoreArray(x_ref, &x_ref_array));
+    CeedCall(CeedVectorRestoreArrayRead(x_phys, &x_phys_array));
+    CeedCall(CeedVectorRestoreArrayRead(dx_phys, &dx_phys_array));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Run a queued `CeedElemRestriction` application on the worker thread
+
+  @param[in] req @ref CeedRequest describing the application
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionApplyRequestRun(CeedRequest req) {
+  return CeedElemRestrictionApply(req->rstr, req->t_mode, req->in, req->out, CEED_REQUEST_IMMEDIATE);
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -151,6 +438,80 @@ int CeedElemRestrictionIsAtPoints(CeedElemRestriction rstr, bool *is_points) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the structured status of a `CeedElemRestriction`
+
+  @param[in]  rstr          `CeedElemRestriction`
+  @param[out] is_structured Variable to store structured status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionIsStructured(CeedElemRestriction rstr, bool *is_structured) {
+  *is_structured = (rstr->rstr_type == CEED_RESTRICTION_STRUCTURED);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the grid description of a structured `CeedElemRestriction`
+
+  Unused directions, beyond `dim`, are reported with one element and no periodicity.
+
+  @param[in]  rstr        `CeedElemRestriction`
+  @param[out] dim         Variable to store the dimension of the grid, or `NULL`
+  @param[out] num_elem_1d Array of length 3 to store the number of elements in each direction, or `NULL`
+  @param[out] P_1d        Variable to store the number of nodes per element in each direction, or `NULL`
+  @param[out] is_periodic Array of length 3 to store the periodicity in each direction, or `NULL`
+  @param[out] node_stride Variable to store the stride between consecutive grid nodes in the L-vector, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetStructure(CeedElemRestriction rstr, CeedInt *dim, CeedInt num_elem_1d[3], CeedInt *P_1d, bool is_periodic[3],
+                                    CeedInt *node_stride) {
+  CeedCheck(rstr->rstr_type == CEED_RESTRICTION_STRUCTURED, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_MINOR,
+            "CeedElemRestriction has no structured grid description");
+  if (dim) *dim = rstr->dim;
+  for (CeedInt d = 0; d < 3; d++) {
+    if (num_elem_1d) num_elem_1d[d] = rstr->num_elem_1d[d];
+    if (is_periodic) is_periodic[d] = rstr->is_periodic[d];
+  }
+  if (P_1d) *P_1d = rstr->P_1d;
+  if (node_stride) *node_stride = rstr->node_stride;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the explicit offsets of a structured `CeedElemRestriction`.
+
+  The offsets are permuted and padded to the blocked ordering of the `CeedElemRestriction`, matching the offsets of an equivalent @ref CeedElemRestrictionCreateBlocked().
+  This is intended for backends that need explicit offsets for setup or assembly and should not be used in the apply path.
+
+  @param[in]  rstr    Structured `CeedElemRestriction`
+  @param[out] offsets Array of shape `[num_block, elem_size, block_size]`, allocated by the caller
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetStructuredOffsets(CeedElemRestriction rstr, CeedInt *offsets) {
+  CeedCheck(rstr->rstr_type == CEED_RESTRICTION_STRUCTURED, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_MINOR,
+            "CeedElemRestriction has no structured grid description");
+  if (rstr->block_size == 1) {
+    CeedCall(CeedStructuredOffsets(rstr->dim, rstr->num_elem_1d, rstr->P_1d, rstr->is_periodic, rstr->node_stride, offsets));
+  } else {
+    CeedInt *elem_offsets;
+
+    CeedCall(CeedMalloc(rstr->num_elem * rstr->elem_size, &elem_offsets));
+    CeedCall(CeedStructuredOffsets(rstr->dim, rstr->num_elem_1d, rstr->P_1d, rstr->is_periodic, rstr->node_stride, elem_offsets));
+    CeedCall(CeedPermutePadOffsets(elem_offsets, offsets, rstr->num_block, rstr->num_elem, rstr->block_size, rstr->elem_size));
+    CeedCall(CeedFree(&elem_offsets));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Check if two `CeedElemRestriction` created with @ref CeedElemRestrictionCreateAtPoints() and use the same points per element
 
@@ -244,7 +605,7 @@ int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mem_type
     CeedCheck(rstr->GetOffsets, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_UNSUPPORTED,
               "Backend does not implement CeedElemRestrictionGetOffsets");
     CeedCall(rstr->GetOffsets(rstr, mem_type, offsets));
-    rstr->num_readers++;
+    CeedAtomicIncrement(rstr->num_readers);
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -263,12 +624,29 @@ int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr, const CeedInt **
   if (rstr->rstr_base) {
     CeedCall(CeedElemRestrictionRestoreOffsets(rstr->rstr_base, offsets));
   } else {
+    // Backends may release offsets built only for the caller
+    if (rstr->RestoreOffsets) CeedCall(rstr->RestoreOffsets(rstr, offsets));
     *offsets = NULL;
-    rstr->num_readers--;
+    CeedAtomicDecrement(rstr->num_readers);
   }
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the compressed offsets preference of a `CeedElemRestriction`
+
+  @param[in]  rstr           `CeedElemRestriction`
+  @param[out] use_compressed Variable to store compressed offsets preference
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetUseCompressedOffsets(CeedElemRestriction rstr, bool *use_compressed) {
+  *use_compressed = rstr->use_compressed_offsets;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get read-only access to a `CeedElemRestriction` orientations array by @ref CeedMemType
 
@@ -285,7 +663,7 @@ int CeedElemRestrictionGetOrientations(CeedElemRestriction rstr, CeedMemType mem
   CeedCheck(rstr->GetOrientations, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_UNSUPPORTED,
             "Backend does not implement CeedElemRestrictionGetOrientations");
   CeedCall(rstr->GetOrientations(rstr, mem_type, orients));
-  rstr->num_readers++;
+  CeedAtomicIncrement(rstr->num_readers);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -301,7 +679,7 @@ int CeedElemRestrictionGetOrientations(CeedElemRestriction rstr, CeedMemType mem
 **/
 int CeedElemRestrictionRestoreOrientations(CeedElemRestriction rstr, const bool **orients) {
   *orients = NULL;
-  rstr->num_readers--;
+  CeedAtomicDecrement(rstr->num_readers);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -321,7 +699,7 @@ int CeedElemRestrictionGetCurlOrientations(CeedElemRestriction rstr, CeedMemType
   CeedCheck(rstr->GetCurlOrientations, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_UNSUPPORTED,
             "Backend does not implement CeedElemRestrictionGetCurlOrientations");
   CeedCall(rstr->GetCurlOrientations(rstr, mem_type, curl_orients));
-  rstr->num_readers++;
+  CeedAtomicIncrement(rstr->num_readers);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -337,7 +715,7 @@ int CeedElemRestrictionGetCurlOrientations(CeedElemRestriction rstr, CeedMemType
 **/
 int CeedElemRestrictionRestoreCurlOrientations(CeedElemRestriction rstr, const CeedInt8 **curl_orients) {
   *curl_orients = NULL;
-  rstr->num_readers--;
+  CeedAtomicDecrement(rstr->num_readers);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -491,6 +869,28 @@ int CeedElemRestrictionSetAtPointsEVectorSize(CeedElemRestriction rstr, CeedSize
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the state counter of the points of a `CeedElemRestriction` at points.
+
+  The state is incremented each time the points are changed with @ref CeedElemRestrictionSetAtPointsOffsets(), so backends can detect stale data derived from the points.
+
+  @param[in]  rstr  `CeedElemRestriction`
+  @param[out] state Variable to store the points state
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetAtPointsState(CeedElemRestriction rstr, uint64_t *state) {
+  CeedRestrictionType rstr_type;
+
+  CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+  CeedCheck(rstr_type == CEED_RESTRICTION_POINTS, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_INCOMPATIBLE,
+            "Points state only defined for a points CeedElemRestriction");
+  *state = rstr->points_state;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the backend data of a `CeedElemRestriction`
 
@@ -531,7 +931,7 @@ int CeedElemRestrictionSetData(CeedElemRestriction rstr, void *data) {
   @ref Backend
 **/
 int CeedElemRestrictionReference(CeedElemRestriction rstr) {
-  rstr->ref_count++;
+  CeedAtomicIncrement(rstr->ref_count);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -557,6 +957,7 @@ int CeedElemRestrictionGetFlopsEstimate(CeedElemRestriction rstr, CeedTransposeM
         break;
       case CEED_RESTRICTION_STRIDED:
       case CEED_RESTRICTION_STANDARD:
+      case CEED_RESTRICTION_STRUCTURED:
         scale = 1;
         break;
       case CEED_RESTRICTION_ORIENTED:
@@ -570,6 +971,7 @@ int CeedElemRestrictionGetFlopsEstimate(CeedElemRestriction rstr, CeedTransposeM
     switch (rstr_type) {
       case CEED_RESTRICTION_STRIDED:
       case CEED_RESTRICTION_STANDARD:
+      case CEED_RESTRICTION_STRUCTURED:
       case CEED_RESTRICTION_POINTS:
         scale = 0;
         break;
@@ -831,6 +1233,83 @@ int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_s
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a structured `CeedElemRestriction` for a box of tensor-product elements.
+
+  Offsets are never stored; backends compute them from the grid description during the restriction.
+  Grid nodes and elements are numbered lexicographically with the first direction fastest.
+  In direction `d` the grid has `num_elem_1d[d] * (P_1d - 1) + 1` nodes, or `num_elem_1d[d] * (P_1d - 1)` nodes if the direction is periodic.
+  Element nodes are ordered lexicographically to match @ref CeedBasisCreateTensorH1().
+
+  @param[in]  ceed        `Ceed` context used to create the `CeedElemRestriction`
+  @param[in]  dim         Dimension of the grid, at most 3
+  @param[in]  num_elem_1d Array of length `dim` with the number of elements in each direction
+  @param[in]  P_1d        Number of nodes per element in each direction
+  @param[in]  is_periodic Array of length `dim` with the periodicity in each direction, or `NULL` for no periodic directions
+  @param[in]  num_comp    Number of field components per grid node (1 for scalar fields)
+  @param[in]  node_stride Stride between consecutive grid nodes in the L-vector.
+                            Data for grid node `n`, component `j` can be found in the L-vector at index `n*node_stride + j*comp_stride`.
+  @param[in]  comp_stride Stride between components for the same grid node
+  @param[in]  l_size      The size of the L-vector.
+                            This vector may be larger than the grid and fields given by this restriction.
+  @param[out] rstr        Address of the variable where the newly created `CeedElemRestriction` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateStructured(Ceed ceed, CeedInt dim, const CeedInt num_elem_1d[], CeedInt P_1d, const bool is_periodic[],
+                                        CeedInt num_comp, CeedInt node_stride, CeedInt comp_stride, CeedSize l_size, CeedElemRestriction *rstr) {
+  bool    periodic[3];
+  CeedInt num_elem, elem_size;
+
+  if (!ceed->ElemRestrictionCreateStructured && !ceed->ElemRestrictionCreate) {
+    Ceed delegate;
+
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction"));
+    CeedCheck(delegate, ceed, CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedElemRestrictionCreateStructured");
+    CeedCall(CeedElemRestrictionCreateStructured(delegate, dim, num_elem_1d, P_1d, is_periodic, num_comp, node_stride, comp_stride, l_size, rstr));
+    CeedCall(CeedDestroy(&delegate));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCall(
+      CeedStructuredCheck(ceed, dim, num_elem_1d, P_1d, is_periodic, num_comp, node_stride, comp_stride, l_size, periodic, &num_elem, &elem_size));
+
+  if (!ceed->ElemRestrictionCreateStructured) {
+    // Backend without native support, fall back to explicit offsets
+    CeedInt *offsets, n_e[3] = {1, 1, 1};
+
+    for (CeedInt d = 0; d < dim; d++) n_e[d] = num_elem_1d[d];
+    CeedCall(CeedMalloc(num_elem * elem_size, &offsets));
+    CeedCall(CeedStructuredOffsets(dim, n_e, P_1d, periodic, node_stride, offsets));
+    CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER, offsets, rstr));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCall(CeedCalloc(1, rstr));
+  CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
+  (*rstr)->ref_count   = 1;
+  (*rstr)->num_elem    = num_elem;
+  (*rstr)->elem_size   = elem_size;
+  (*rstr)->num_comp    = num_comp;
+  (*rstr)->comp_stride = comp_stride;
+  (*rstr)->l_size      = l_size;
+  (*rstr)->e_size      = (CeedSize)num_elem * (CeedSize)elem_size * (CeedSize)num_comp;
+  (*rstr)->num_block   = num_elem;
+  (*rstr)->block_size  = 1;
+  (*rstr)->rstr_type   = CEED_RESTRICTION_STRUCTURED;
+  (*rstr)->dim         = dim;
+  (*rstr)->P_1d        = P_1d;
+  (*rstr)->node_stride = node_stride;
+  for (CeedInt d = 0; d < 3; d++) {
+    (*rstr)->num_elem_1d[d] = d < dim ? num_elem_1d[d] : 1;
+    (*rstr)->is_periodic[d] = periodic[d];
+  }
+  CeedCall(ceed->ElemRestrictionCreateStructured(CEED_MEM_HOST, CEED_OWN_POINTER, NULL, NULL, NULL, *rstr));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Create a points `CeedElemRestriction`, for restricting for restricting from a all local points to the current element in which they are located.
 
@@ -1169,6 +1648,615 @@ int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt num_elem, CeedInt
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a blocked structured `CeedElemRestriction`, typically only used by backends
+
+  @param[in]  ceed        `Ceed` context used to create the `CeedElemRestriction`
+  @param[in]  dim         Dimension of the grid, at most 3
+  @param[in]  num_elem_1d Array of length `dim` with the number of elements in each direction
+  @param[in]  P_1d        Number of nodes per element in each direction
+  @param[in]  block_size  Number of elements in a block
+  @param[in]  is_periodic Array of length `dim` with the periodicity in each direction, or `NULL` for no periodic directions
+  @param[in]  num_comp    Number of field components per grid node (1 for scalar fields)
+  @param[in]  node_stride Stride between consecutive grid nodes in the L-vector.
+                            Data for grid node `n`, component `j` can be found in the L-vector at index `n*node_stride + j*comp_stride`.
+  @param[in]  comp_stride Stride between components for the same grid node
+  @param[in]  l_size      The size of the L-vector.
+                            This vector may be larger than the grid and fields given by this restriction.
+  @param[out] rstr        Address of the variable where the newly created `CeedElemRestriction` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCreateBlockedStructured(Ceed ceed, CeedInt dim, const CeedInt num_elem_1d[], CeedInt P_1d, CeedInt block_size,
+                                               const bool is_periodic[], CeedInt num_comp, CeedInt node_stride, CeedInt comp_stride, CeedSize l_size,
+                                               CeedElemRestriction *rstr) {
+  bool    periodic[3];
+  CeedInt num_elem, elem_size, num_block;
+
+  if (!ceed->ElemRestrictionCreateStructured && !ceed->ElemRestrictionCreateBlocked) {
+    Ceed delegate;
+
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction"));
+    CeedCheck(delegate, ceed, CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedElemRestrictionCreateBlockedStructured");
+    CeedCall(CeedElemRestrictionCreateBlockedStructured(delegate, dim, num_elem_1d, P_1d, block_size, is_periodic, num_comp, node_stride,
+                                                        comp_stride, l_size, rstr));
+    CeedCall(CeedDestroy(&delegate));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCheck(block_size > 0, ceed, CEED_ERROR_DIMENSION, "Block size must be at least 1");
+  CeedCall(
+      CeedStructuredCheck(ceed, dim, num_elem_1d, P_1d, is_periodic, num_comp, node_stride, comp_stride, l_size, periodic, &num_elem, &elem_size));
+  num_block = (num_elem / block_size) + !!(num_elem % block_size);
+
+  if (!ceed->ElemRestrictionCreateStructured) {
+    // Backend without native support, fall back to explicit offsets
+    CeedInt *offsets, n_e[3] = {1, 1, 1};
+
+    for (CeedInt d = 0; d < dim; d++) n_e[d] = num_elem_1d[d];
+    CeedCall(CeedMalloc(num_elem * elem_size, &offsets));
+    CeedCall(CeedStructuredOffsets(dim, n_e, P_1d, periodic, node_stride, offsets));
+    CeedCall(CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, block_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                              offsets, rstr));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCall(CeedCalloc(1, rstr));
+  CeedCall(CeedReferenceCopy(ceed, &(*rstr)->ceed));
+  (*rstr)->ref_count   = 1;
+  (*rstr)->num_elem    = num_elem;
+  (*rstr)->elem_size   = elem_size;
+  (*rstr)->num_comp    = num_comp;
+  (*rstr)->comp_stride = comp_stride;
+  (*rstr)->l_size      = l_size;
+  (*rstr)->e_size      = (CeedSize)num_block * (CeedSize)block_size * (CeedSize)elem_size * (CeedSize)num_comp;
+  (*rstr)->num_block   = num_block;
+  (*rstr)->block_size  = block_size;
+  (*rstr)->rstr_type   = CEED_RESTRICTION_STRUCTURED;
+  (*rstr)->dim         = dim;
+  (*rstr)->P_1d        = P_1d;
+  (*rstr)->node_stride = node_stride;
+  for (CeedInt d = 0; d < 3; d++) {
+    (*rstr)->num_elem_1d[d] = d < dim ? num_elem_1d[d] : 1;
+    (*rstr)->is_periodic[d] = periodic[d];
+  }
+  CeedCall(ceed->ElemRestrictionCreateStructured(CEED_MEM_HOST, CEED_OWN_POINTER, NULL, NULL, NULL, *rstr));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create a copy of a `CeedElemRestriction` with elements, and optionally nodes, reordered to improve memory locality.
+
+  Elements are ordered with the reverse Cuthill-McKee algorithm on the element adjacency graph, where two elements are adjacent if they share a node.
+  Each connected component is ordered from a pseudo-peripheral element found with the George-Liu algorithm.
+  If `renumber_nodes` is true, the nodes (offset values) are then renumbered in order of first use by the reordered elements.
+  Node renumbering only permutes the set of offset values used by `rstr`, so `comp_stride` and `l_size` remain valid.
+
+  Element `e` of `rstr_reordered` is element `elem_perm[e]` of `rstr`.
+  Entry `i` of an L-vector for `rstr` is entry `l_perm[i]` of an L-vector for `rstr_reordered`.
+
+  Only non-blocked `CeedElemRestriction` with offsets are supported.
+
+  @param[in]  rstr           `CeedElemRestriction` to reorder
+  @param[in]  renumber_nodes Boolean flag to also renumber the nodes
+  @param[out] elem_perm      Array of length `num_elem` to store the element permutation, or `NULL`
+  @param[out] l_perm         Array of length `l_size` to store the L-vector permutation, or `NULL`
+  @param[out] rstr_reordered Address of the variable where the newly created `CeedElemRestriction` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateReordered(CeedElemRestriction rstr, bool renumber_nodes, CeedInt *elem_perm, CeedInt *l_perm,
+                                       CeedElemRestriction *rstr_reordered) {
+  Ceed                ceed;
+  CeedInt             num_elem, elem_size, num_comp, comp_stride, block_size, num_visited = 0;
+  CeedInt            *node_elem_start, *node_elems, *degree, *by_degree, *mark, *level_mark, *queue, *order, *neighbors, *new_offsets, *node_map;
+  CeedSize            l_size;
+  CeedRestrictionType rstr_type;
+  const CeedInt      *offsets;
+
+  CeedCall(CeedElemRestrictionGetCeed(rstr, &ceed));
+  CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+  CeedCall(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCheck(rstr_type == CEED_RESTRICTION_STANDARD || rstr_type == CEED_RESTRICTION_ORIENTED || rstr_type == CEED_RESTRICTION_CURL_ORIENTED, ceed,
+            CEED_ERROR_UNSUPPORTED, "Reordering only supported for CeedElemRestriction with offsets");
+  CeedCheck(block_size == 1, ceed, CEED_ERROR_UNSUPPORTED, "Reordering not supported for blocked CeedElemRestriction");
+  CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCall(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+  CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  CeedCall(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+  CeedCall(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+  CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+
+  // Node to element adjacency, indexed by offset value
+  CeedCall(CeedCalloc(l_size + 1, &node_elem_start));
+  CeedCall(CeedCalloc(num_elem * elem_size, &node_elems));
+  for (CeedInt i = 0; i < num_elem * elem_size; i++) node_elem_start[offsets[i] + 1]++;
+  for (CeedSize i = 0; i < l_size; i++) node_elem_start[i + 1] += node_elem_start[i];
+  {
+    CeedInt *fill;
+
+    CeedCall(CeedCalloc(l_size, &fill));
+    for (CeedInt i = 0; i < num_elem * elem_size; i++) node_elems[node_elem_start[offsets[i]] + fill[offsets[i]]++] = i / elem_size;
+    CeedCall(CeedFree(&fill));
+  }
+
+  // Element degree, number of distinct neighboring elements
+  CeedCall(CeedCalloc(num_elem, &degree));
+  CeedCall(CeedMalloc(num_elem, &mark));
+  for (CeedInt e = 0; e < num_elem; e++) mark[e] = -1;
+  for (CeedInt e = 0; e < num_elem; e++) {
+    mark[e] = e;
+    for (CeedInt n = 0; n < elem_size; n++) {
+      const CeedInt node = offsets[e * elem_size + n];
+
+      for (CeedInt k = node_elem_start[node]; k < node_elem_start[node + 1]; k++) {
+        if (mark[node_elems[k]] != e) {
+          mark[node_elems[k]] = e;
+          degree[e]++;
+        }
+      }
+    }
+  }
+
+  // Elements sorted by increasing degree, so a cursor finds the minimum degree unvisited element
+  {
+    CeedInt *degree_start;
+
+    CeedCall(CeedCalloc(num_elem + 1, &degree_start));
+    CeedCall(CeedMalloc(num_elem, &by_degree));
+    for (CeedInt e = 0; e < num_elem; e++) degree_start[degree[e]]++;
+    for (CeedInt d = 0, sum = 0; d <= num_elem; d++) {
+      const CeedInt count = degree_start[d];
+
+      degree_start[d] = sum;
+      sum += count;
+    }
+    for (CeedInt e = 0; e < num_elem; e++) by_degree[degree_start[degree[e]]++] = e;
+    CeedCall(CeedFree(&degree_start));
+  }
+
+  // Cuthill-McKee ordering, breadth first search from a pseudo-peripheral element of each connected component
+  CeedCall(CeedMalloc(num_elem, &order));
+  CeedCall(CeedMalloc(num_elem, &neighbors));
+  CeedCall(CeedMalloc(num_elem, &queue));
+  CeedCall(CeedCalloc(num_elem, &level_mark));
+  for (CeedInt e = 0; e < num_elem; e++) mark[e] = 0;
+  for (CeedInt cursor = 0, stamp = 0; num_visited < num_elem;) {
+    CeedInt start, num_levels, last_level_start, num_queued;
+
+    while (mark[by_degree[cursor]]) cursor++;
+    start = by_degree[cursor];
+    // George-Liu: move to a minimum degree element of the last level while the number of levels grows
+    CeedCall(CeedElemRestrictionLevelStructure(elem_size, offsets, node_elem_start, node_elems, start, ++stamp, level_mark, queue, &num_levels,
+                                               &last_level_start, &num_queued));
+    while (true) {
+      CeedInt candidate = queue[last_level_start], candidate_num_levels;
+
+      for (CeedInt q = last_level_start + 1; q < num_queued; q++) {
+        if (degree[queue[q]] < degree[candidate]) candidate = queue[q];
+      }
+      CeedCall(CeedElemRestrictionLevelStructure(elem_size, offsets, node_elem_start, node_elems, candidate, ++stamp, level_mark, queue,
+                                                 &candidate_num_levels, &last_level_start, &num_queued));
+      if (candidate_num_levels <= num_levels) break;
+      start      = candidate;
+      num_levels = candidate_num_levels;
+    }
+    mark[start]          = 1;
+    order[num_visited++] = start;
+    for (CeedInt q = num_visited - 1; q < num_visited; q++) {
+      const CeedInt e             = order[q];
+      CeedInt       num_neighbors = 0;
+
+      for (CeedInt n = 0; n < elem_size; n++) {
+        const CeedInt node = offsets[e * elem_size + n];
+
+        for (CeedInt k = node_elem_start[node]; k < node_elem_start[node + 1]; k++) {
+          const CeedInt f = node_elems[k];
+
+          if (!mark[f]) {
+            CeedInt j = num_neighbors++;
+
+            mark[f] = 1;
+            // Insertion sort by increasing degree
+            for (; j > 0 && degree[neighbors[j - 1]] > degree[f]; j--) neighbors[j] = neighbors[j - 1];
+            neighbors[j] = f;
+          }
+        }
+      }
+      for (CeedInt j = 0; j < num_neighbors; j++) order[num_visited++] = neighbors[j];
+    }
+  }
+  // Reverse
+  for (CeedInt e = 0; e < num_elem / 2; e++) {
+    const CeedInt tmp = order[e];
+
+    order[e]                = order[num_elem - 1 - e];
+    order[num_elem - 1 - e] = tmp;
+  }
+
+  // Node renumbering, in order of first use by the reordered elements
+  CeedCall(CeedMalloc(l_size, &node_map));
+  if (renumber_nodes) {
+    CeedInt  num_used = 0, num_touched = 0;
+    CeedInt *used;
+
+    CeedCall(CeedMalloc(l_size, &used));
+    for (CeedSize i = 0; i < l_size; i++) {
+      if (node_elem_start[i + 1] > node_elem_start[i]) used[num_used++] = i;
+      node_map[i] = -1;
+    }
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt n = 0; n < elem_size; n++) {
+        const CeedInt node = offsets[order[e] * elem_size + n];
+
+        if (node_map[node] < 0) node_map[node] = used[num_touched++];
+      }
+    }
+    CeedCall(CeedFree(&used));
+  }
+  for (CeedSize i = 0; i < l_size; i++) {
+    if (!renumber_nodes || node_map[i] < 0) node_map[i] = i;
+  }
+
+  // Reordered offsets
+  CeedCall(CeedMalloc(num_elem * elem_size, &new_offsets));
+  for (CeedInt e = 0; e < num_elem; e++) {
+    for (CeedInt n = 0; n < elem_size; n++) new_offsets[e * elem_size + n] = node_map[offsets[order[e] * elem_size + n]];
+  }
+  CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+  switch (rstr_type) {
+    case CEED_RESTRICTION_ORIENTED: {
+      bool       *new_orients;
+      const bool *orients;
+
+      CeedCall(CeedElemRestrictionGetOrientations(rstr, CEED_MEM_HOST, &orients));
+      CeedCall(CeedMalloc(num_elem * elem_size, &new_orients));
+      for (CeedInt e = 0; e < num_elem; e++) {
+        for (CeedInt n = 0; n < elem_size; n++) new_orients[e * elem_size + n] = orients[order[e] * elem_size + n];
+      }
+      CeedCall(CeedElemRestrictionRestoreOrientations(rstr, &orients));
+      CeedCall(CeedElemRestrictionCreateOriented(ceed, num_elem, elem_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                                 new_offsets, new_orients, rstr_reordered));
+    } break;
+    case CEED_RESTRICTION_CURL_ORIENTED: {
+      CeedInt8       *new_curl_orients;
+      const CeedInt8 *curl_orients;
+
+      CeedCall(CeedElemRestrictionGetCurlOrientations(rstr, CEED_MEM_HOST, &curl_orients));
+      CeedCall(CeedMalloc(3 * num_elem * elem_size, &new_curl_orients));
+      for (CeedInt e = 0; e < num_elem; e++) {
+        for (CeedInt n = 0; n < 3 * elem_size; n++) new_curl_orients[3 * e * elem_size + n] = curl_orients[3 * order[e] * elem_size + n];
+      }
+      CeedCall(CeedElemRestrictionRestoreCurlOrientations(rstr, &curl_orients));
+      CeedCall(CeedElemRestrictionCreateCurlOriented(ceed, num_elem, elem_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                                     new_offsets, new_curl_orients, rstr_reordered));
+    } break;
+    default:
+      CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER, new_offsets,
+                                         rstr_reordered));
+      break;
+  }
+  CeedCall(CeedElemRestrictionSetUseCompressedOffsets(*rstr_reordered, rstr->use_compressed_offsets));
+
+  // Permutations
+  if (elem_perm) {
+    for (CeedInt e = 0; e < num_elem; e++) elem_perm[e] = order[e];
+  }
+  if (l_perm) {
+    for (CeedSize i = 0; i < l_size; i++) l_perm[i] = i;
+    for (CeedSize i = 0; i < l_size; i++) {
+      if (node_map[i] != i) {
+        for (CeedInt j = 0; j < num_comp; j++) l_perm[i + j * comp_stride] = node_map[i] + j * comp_stride;
+      }
+    }
+  }
+
+  // Cleanup
+  CeedCall(CeedFree(&node_elem_start));
+  CeedCall(CeedFree(&node_elems));
+  CeedCall(CeedFree(&degree));
+  CeedCall(CeedFree(&by_degree));
+  CeedCall(CeedFree(&mark));
+  CeedCall(CeedFree(&level_mark));
+  CeedCall(CeedFree(&queue));
+  CeedCall(CeedFree(&order));
+  CeedCall(CeedFree(&neighbors));
+  CeedCall(CeedFree(&node_map));
+  CeedCall(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Locate physical points in the elements of a mesh and create the points `CeedElemRestriction` and reference coordinates for them.
+
+  Elements are binned in a uniform grid of cells using the bounding boxes of their nodal coordinates.
+  Each point is first tried in the element given by `point_elem`, if any, and then in the other elements overlapping its cell.
+  Reference coordinates are found with Newton iteration, batched over all points being tried in the same element.
+  When points only move a little between calls, passing the previous `point_elem` means most points are located with a single Newton solve.
+
+  Physical coordinates in `x_points` and reference coordinates in `x_ref_points` have components contiguous by point, as expected by `rstr_points`.
+  Points that are not found in any element are left out of `rstr_points` and have zero reference coordinates.
+
+  @param[in]     rstr_x       `CeedElemRestriction` for the mesh coordinates
+  @param[in]     basis_x      Tensor-product H^1 `CeedBasis` for the mesh coordinates, with as many components as dimensions
+  @param[in]     x_coords     `CeedVector` of mesh coordinates
+  @param[in]     x_points     `CeedVector` of physical coordinates of the points, of length `num_points * dim`
+  @param[in,out] point_elem   Array of length `num_points` with the element containing each point, or -1 if unknown.
+                                On output, the element containing each point, or -1 if the point was not found.
+                                May be `NULL` if no guesses are available and the elements are not needed.
+  @param[out]    rstr_points  Address of the variable where the newly created points `CeedElemRestriction` will be stored
+  @param[out]    x_ref_points Address of the variable where the newly created `CeedVector` of reference coordinates will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateAtPointsByLocation(CeedElemRestriction rstr_x, CeedBasis basis_x, CeedVector x_coords, CeedVector x_points,
+                                                CeedInt *point_elem, CeedElemRestriction *rstr_points, CeedVector *x_ref_points) {
+  bool              is_tensor, *is_active, *is_inside;
+  Ceed              ceed;
+  CeedInt           dim, num_comp, num_comp_rstr, num_elem, elem_size, num_points, num_pending, num_located = 0, num_cells = 1;
+  CeedInt           num_cells_1d[3] = {1, 1, 1}, e_layout[3];
+  CeedInt          *elem_guess, *elem_found, *point_cell, *point_attempt, *pending, *candidate, *cell_start, *cell_elems, *batch_start, *batch_points;
+  CeedInt          *offsets;
+  CeedSize          x_points_length;
+  CeedScalar        lower[3], upper[3], cell_width[3], *elem_bounds, *x_target, *x_ref_array;
+  const CeedScalar *x_e_array, *x_points_array;
+  CeedVector        x_e, x_elem, x_ref, x_phys, dx_phys;
+
+  CeedCall(CeedElemRestrictionGetCeed(rstr_x, &ceed));
+  CeedCall(CeedBasisIsTensor(basis_x, &is_tensor));
+  CeedCheck(is_tensor, ceed, CEED_ERROR_UNSUPPORTED, "Point location only supported for tensor-product CeedBasis");
+  CeedCall(CeedBasisGetDimension(basis_x, &dim));
+  CeedCall(CeedBasisGetNumComponents(basis_x, &num_comp));
+  CeedCall(CeedElemRestrictionGetNumComponents(rstr_x, &num_comp_rstr));
+  CeedCheck(num_comp == dim && num_comp_rstr == dim, ceed, CEED_ERROR_DIMENSION,
+            "Mesh coordinate CeedBasis and CeedElemRestriction must have one component per dimension");
+  CeedCall(CeedElemRestrictionGetNumElements(rstr_x, &num_elem));
+  CeedCall(CeedElemRestrictionGetElementSize(rstr_x, &elem_size));
+  CeedCall(CeedVectorGetLength(x_points, &x_points_length));
+  CeedCheck(x_points_length % dim == 0, ceed, CEED_ERROR_DIMENSION, "Length of point coordinate vector must be a multiple of the dimension");
+  num_points = x_points_length / dim;
+
+  // Element nodal coordinates
+  CeedCall(CeedElemRestrictionCreateVector(rstr_x, NULL, &x_e));
+  CeedCall(CeedElemRestrictionApply(rstr_x, CEED_NOTRANSPOSE, x_coords, x_e, CEED_REQUEST_IMMEDIATE));
+  CeedCall(CeedElemRestrictionGetELayout(rstr_x, e_layout));
+  CeedCall(CeedVectorGetArrayRead(x_e, CEED_MEM_HOST, &x_e_array));
+
+  // Element bounding boxes, padded to allow for curved elements
+  CeedCall(CeedCalloc(num_elem * 2 * dim, &elem_bounds));
+  for (CeedInt d = 0; d < dim; d++) {
+    lower[d] = INFINITY;
+    upper[d] = -INFINITY;
+  }
+  for (CeedInt e = 0; e < num_elem; e++) {
+    CeedScalar *elem_lower = &elem_bounds[e * 2 * dim], *elem_upper = &elem_bounds[e * 2 * dim + dim];
+
+    for (CeedInt d = 0; d < dim; d++) {
+      elem_lower[d] = INFINITY;
+      elem_upper[d] = -INFINITY;
+      for (CeedInt n = 0; n < elem_size; n++) {
+        const CeedScalar x = x_e_array[n * e_layout[0] + d * e_layout[1] + e * e_layout[2]];
+
+        elem_lower[d] = x < elem_lower[d] ? x : elem_lower[d];
+        elem_upper[d] = x > elem_upper[d] ? x : elem_upper[d];
+      }
+    }
+    for (CeedInt d = 0; d < dim; d++) {
+      const CeedScalar pad = 0.1 * (elem_upper[d] - elem_lower[d]);
+
+      elem_lower[d] -= pad;
+      elem_upper[d] += pad;
+      lower[d] = elem_lower[d] < lower[d] ? elem_lower[d] : lower[d];
+      upper[d] = elem_upper[d] > upper[d] ? elem_upper[d] : upper[d];
+    }
+  }
+
+  // Uniform grid of cells with about one element per cell
+  for (CeedInt d = 0; d < dim; d++) {
+    num_cells_1d[d] = CeedIntMax(1, (CeedInt)ceil(pow((double)num_elem, 1.0 / dim)));
+    cell_width[d]   = upper[d] > lower[d] ? (upper[d] - lower[d]) / num_cells_1d[d] : 1.0;
+    num_cells *= num_cells_1d[d];
+  }
+  CeedCall(CeedCalloc(num_cells + 1, &cell_start));
+  for (CeedInt pass = 0; pass < 2; pass++) {
+    // First pass counts elements per cell, second pass fills cells
+    if (pass == 1) {
+      for (CeedInt c = 0; c < num_cells; c++) cell_start[c + 1] += cell_start[c];
+      CeedCall(CeedCalloc(cell_start[num_cells], &cell_elems));
+    }
+    for (CeedInt e = 0; e < num_elem; e++) {
+      CeedInt cell_lower[3] = {0, 0, 0}, cell_upper[3] = {0, 0, 0};
+
+      for (CeedInt d = 0; d < dim; d++) {
+        cell_lower[d] = CeedIntMin(num_cells_1d[d] - 1, (CeedInt)((elem_bounds[e * 2 * dim + d] - lower[d]) / cell_width[d]));
+        cell_upper[d] = CeedIntMin(num_cells_1d[d] - 1, (CeedInt)((elem_bounds[e * 2 * dim + dim + d] - lower[d]) / cell_width[d]));
+      }
+      for (CeedInt k = cell_lower[2]; k <= cell_upper[2]; k++) {
+        for (CeedInt j = cell_lower[1]; j <= cell_upper[1]; j++) {
+          for (CeedInt i = cell_lower[0]; i <= cell_upper[0]; i++) {
+            const CeedInt c = (k * num_cells_1d[1] + j) * num_cells_1d[0] + i;
+
+            if (pass == 0) cell_start[c + 1]++;
+            else cell_elems[cell_start[c]++] = e;
+          }
+        }
+      }
+    }
+  }
+  for (CeedInt c = num_cells; c > 0; c--) cell_start[c] = cell_start[c - 1];
+  cell_start[0] = 0;
+
+  // Cell of each point, or -1 outside of the mesh bounding box
+  CeedCall(CeedVectorGetArrayRead(x_points, CEED_MEM_HOST, &x_points_array));
+  CeedCall(CeedCalloc(num_points, &point_cell));
+  for (CeedInt p = 0; p < num_points; p++) {
+    CeedInt cell = 0;
+
+    for (CeedInt d = dim - 1; d >= 0; d--) {
+      const CeedScalar x = x_points_array[p * dim + d];
+
+      if (cell < 0 || x < lower[d] || x > upper[d]) {
+        cell = -1;
+      } else {
+        cell = cell * num_cells_1d[d] + CeedIntMin(num_cells_1d[d] - 1, (CeedInt)((x - lower[d]) / cell_width[d]));
+      }
+    }
+    point_cell[p] = cell;
+  }
+
+  // Try candidate elements in rounds, batching the points tried in each element
+  CeedCall(CeedCalloc(num_points, &elem_guess));
+  CeedCall(CeedCalloc(num_points, &elem_found));
+  CeedCall(CeedCalloc(num_points, &point_attempt));
+  CeedCall(CeedCalloc(num_points, &pending));
+  CeedCall(CeedCalloc(num_points, &candidate));
+  CeedCall(CeedCalloc(num_elem + 1, &batch_start));
+  CeedCall(CeedCalloc(num_points, &batch_points));
+  CeedCall(CeedCalloc(num_points * dim, &x_target));
+  CeedCall(CeedCalloc(num_points, &is_active));
+  CeedCall(CeedCalloc(num_points, &is_inside));
+  CeedCall(CeedCalloc(num_points * dim, &x_ref_array));
+  CeedCall(CeedVectorCreate(ceed, elem_size * dim, &x_elem));
+  CeedCall(CeedVectorCreate(ceed, num_points * dim, &x_ref));
+  CeedCall(CeedVectorSetValue(x_ref, 0.0));
+  CeedCall(CeedVectorCreate(ceed, num_points * dim, &x_phys));
+  CeedCall(CeedVectorCreate(ceed, num_points * dim * dim, &dx_phys));
+  for (CeedInt p = 0; p < num_points; p++) {
+    elem_guess[p] = point_elem && point_elem[p] >= 0 && point_elem[p] < num_elem ? point_elem[p] : -1;
+    elem_found[p] = -1;
+    pending[p]    = p;
+  }
+  num_pending = num_points;
+  while (num_pending > 0) {
+    CeedInt num_remaining = 0;
+
+    // Next candidate element; the guess first, then the elements overlapping the cell
+    for (CeedInt i = 0; i < num_pending; i++) {
+      const CeedInt p = pending[i], cell = point_cell[p];
+
+      candidate[p] = -1;
+      if (point_attempt[p] == 0) {
+        point_attempt[p] = 1;
+        candidate[p]     = elem_guess[p];
+      }
+      while (candidate[p] < 0 && cell >= 0 && point_attempt[p] - 1 < cell_start[cell + 1] - cell_start[cell]) {
+        const CeedInt e = cell_elems[cell_start[cell] + point_attempt[p] - 1];
+
+        point_attempt[p]++;
+        if (e != elem_guess[p]) candidate[p] = e;
+      }
+      if (candidate[p] >= 0) pending[num_remaining++] = p;
+    }
+    num_pending = num_remaining;
+
+    // Group points by candidate element
+    for (CeedInt e = 0; e <= num_elem; e++) batch_start[e] = 0;
+    for (CeedInt i = 0; i < num_pending; i++) batch_start[candidate[pending[i]] + 1]++;
+    for (CeedInt e = 0; e < num_elem; e++) batch_start[e + 1] += batch_start[e];
+    for (CeedInt i = 0; i < num_pending; i++) batch_points[batch_start[candidate[pending[i]]]++] = pending[i];
+    for (CeedInt e = num_elem; e > 0; e--) batch_start[e] = batch_start[e - 1];
+    batch_start[0] = 0;
+
+    // Newton iteration for each batch
+    num_remaining = 0;
+    for (CeedInt e = 0; e < num_elem; e++) {
+      const CeedInt num_batch = batch_start[e + 1] - batch_start[e], *points = &batch_points[batch_start[e]];
+      CeedScalar    scale     = 0.0;
+
+      if (num_batch == 0) continue;
+      {
+        CeedScalar *x_elem_array;
+
+        CeedCall(CeedVectorGetArrayWrite(x_elem, CEED_MEM_HOST, &x_elem_array));
+        for (CeedInt d = 0; d < dim; d++) {
+          for (CeedInt n = 0; n < elem_size; n++) x_elem_array[d * elem_size + n] = x_e_array[n * e_layout[0] + d * e_layout[1] + e * e_layout[2]];
+        }
+        CeedCall(CeedVectorRestoreArray(x_elem, &x_elem_array));
+      }
+      for (CeedInt d = 0; d < dim; d++) {
+        const CeedScalar elem_lower = elem_bounds[e * 2 * dim + d], elem_upper = elem_bounds[e * 2 * dim + dim + d];
+
+        // Residual tolerance relative to both the element size and the magnitude of the coordinates
+        scale = fabs(elem_lower) > scale ? fabs(elem_lower) : scale;
+        scale = fabs(elem_upper) > scale ? fabs(elem_upper) : scale;
+        scale = elem_upper - elem_lower > scale ? elem_upper - elem_lower : scale;
+        for (CeedInt i = 0; i < num_batch; i++) x_target[d * num_batch + i] = x_points_array[points[i] * dim + d];
+      }
+      CeedCall(CeedPointsNewtonInElement(basis_x, x_elem, num_batch, x_target, 1e2 * CEED_EPSILON * scale, x_ref, x_phys, dx_phys, is_active,
+                                         is_inside));
+      {
+        const CeedScalar *x_ref_batch;
+
+        CeedCall(CeedVectorGetArrayRead(x_ref, CEED_MEM_HOST, &x_ref_batch));
+        for (CeedInt i = 0; i < num_batch; i++) {
+          const CeedInt p = points[i];
+
+          if (is_inside[i]) {
+            elem_found[p] = e;
+            for (CeedInt d = 0; d < dim; d++) x_ref_array[p * dim + d] = x_ref_batch[d * num_batch + i];
+            num_located++;
+          } else {
+            pending[num_remaining++] = p;
+          }
+        }
+        CeedCall(CeedVectorRestoreArrayRead(x_ref, &x_ref_batch));
+      }
+    }
+    num_pending = num_remaining;
+  }
+  CeedCall(CeedVectorRestoreArrayRead(x_points, &x_points_array));
+  CeedCall(CeedVectorRestoreArrayRead(x_e, &x_e_array));
+
+  // Points restriction, with points in each element in their original order
+  CeedCall(CeedCalloc(num_elem + 1 + num_located, &offsets));
+  for (CeedInt p = 0; p < num_points; p++) {
+    if (elem_found[p] >= 0) offsets[elem_found[p] + 1]++;
+  }
+  offsets[0] = num_elem + 1;
+  for (CeedInt e = 0; e < num_elem; e++) offsets[e + 1] += offsets[e];
+  for (CeedInt p = 0; p < num_points; p++) {
+    if (elem_found[p] >= 0) offsets[offsets[elem_found[p]]++] = p;
+  }
+  for (CeedInt e = num_elem; e > 0; e--) offsets[e] = offsets[e - 1];
+  offsets[0] = num_elem + 1;
+  CeedCall(CeedElemRestrictionCreateAtPoints(ceed, num_elem, num_located, dim, (CeedSize)num_points * dim, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                             offsets, rstr_points));
+  CeedCall(CeedVectorCreate(ceed, (CeedSize)num_points * dim, x_ref_points));
+  CeedCall(CeedVectorSetArray(*x_ref_points, CEED_MEM_HOST, CEED_OWN_POINTER, x_ref_array));
+  if (point_elem) {
+    for (CeedInt p = 0; p < num_points; p++) point_elem[p] = elem_found[p];
+  }
+
+  // Cleanup
+  CeedCall(CeedFree(&elem_bounds));
+  CeedCall(CeedFree(&cell_start));
+  CeedCall(CeedFree(&cell_elems));
+  CeedCall(CeedFree(&point_cell));
+  CeedCall(CeedFree(&elem_guess));
+  CeedCall(CeedFree(&elem_found));
+  CeedCall(CeedFree(&point_attempt));
+  CeedCall(CeedFree(&pending));
+  CeedCall(CeedFree(&candidate));
+  CeedCall(CeedFree(&batch_start));
+  CeedCall(CeedFree(&batch_points));
+  CeedCall(CeedFree(&x_target));
+  CeedCall(CeedFree(&is_active));
+  CeedCall(CeedFree(&is_inside));
+  CeedCall(CeedVectorDestroy(&x_e));
+  CeedCall(CeedVectorDestroy(&x_elem));
+  CeedCall(CeedVectorDestroy(&x_ref));
+  CeedCall(CeedVectorDestroy(&x_phys));
+  CeedCall(CeedVectorDestroy(&dx_phys));
+  CeedCall(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Copy the pointer to a `CeedElemRestriction` and set @ref CeedElemRestrictionApply() implementation to use the unsigned version.
 
@@ -1287,13 +2375,15 @@ int CeedElemRestrictionCreateVector(CeedElemRestriction rstr, CeedVector *l_vec,
   @param[in]  u       Input vector (of size `l_size` when `t_mode` = @ref CEED_NOTRANSPOSE)
   @param[out] ru      Output vector (of shape `[num_elem * elem_size]` when `t_mode` = @ref CEED_NOTRANSPOSE).
                         Ordering of the e-vector is decided by the backend.
-  @param[in]  request Request or @ref CEED_REQUEST_IMMEDIATE
+  @param[in]  request Request or @ref CEED_REQUEST_IMMEDIATE.
+                        See @ref CeedRequestWait() for the restrictions while the request is pending.
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
 int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedVector u, CeedVector ru, CeedRequest *request) {
+  bool     is_async;
   CeedSize min_u_len, min_ru_len, len;
   CeedInt  num_elem;
 
@@ -1312,6 +2402,18 @@ int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode,
   CeedCheck(min_ru_len <= len, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_DIMENSION,
             "Output vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", len, min_u_len,
             min_ru_len);
+  CeedCall(CeedRequestIsAsync(CeedElemRestrictionReturnCeed(rstr), request, &is_async));
+  if (is_async) {
+    CeedRequest req;
+
+    CeedCall(CeedRequestCreate(CeedElemRestrictionReturnCeed(rstr), CeedElemRestrictionApplyRequestRun, &req));
+    req->t_mode = t_mode;
+    CeedCall(CeedElemRestrictionReferenceCopy(rstr, &req->rstr));
+    CeedCall(CeedVectorReferenceCopy(u, &req->in));
+    CeedCall(CeedVectorReferenceCopy(ru, &req->out));
+    CeedCall(CeedRequestSubmit(req, request));
+    return CEED_ERROR_SUCCESS;
+  }
   CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
   if (num_elem > 0) CeedCall(rstr->Apply(rstr, t_mode, u, ru, request));
   return CEED_ERROR_SUCCESS;
@@ -1694,6 +2796,72 @@ int CeedElemRestrictionGetBlockSize(CeedElemRestriction rstr, CeedInt *block_siz
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Request that a `CeedElemRestriction` use compressed offsets when applying the restriction.
+
+  When enabled, backends that support it store the offsets as a base index per element plus 16-bit offsets relative to that base and decode them in the restriction kernels, reducing the index bytes read on every apply.
+  Backends ignore this hint if the nodes of an element span too wide a range of the L-vector or if compressed offsets are not supported.
+  This setting is inherited by the blocked `CeedElemRestriction` created by `CeedOperator` backends.
+
+  @param[in,out] rstr           `CeedElemRestriction`
+  @param[in]     use_compressed Boolean flag to use compressed offsets
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionSetUseCompressedOffsets(CeedElemRestriction rstr, bool use_compressed) {
+  rstr->use_compressed_offsets = use_compressed;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Replace the points in each element of a `CeedElemRestriction` at points without creating a new `CeedElemRestriction`.
+
+  The `offsets` array has the same layout as in @ref CeedElemRestrictionCreateAtPoints().
+  The number of elements, number of components, and L-vector size are unchanged, so the total number of points may vary up to `l_size / num_comp`.
+  Backends keep storage for that many points, so repeated updates do not allocate.
+
+  @param[in,out] rstr       `CeedElemRestriction` at points
+  @param[in]     num_points New total number of points described in the `offsets` array
+  @param[in]     offsets    Host array of size `num_elem + 1 + num_points`, copied by the backend
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionSetAtPointsOffsets(CeedElemRestriction rstr, CeedInt num_points, const CeedInt *offsets) {
+  Ceed                ceed;
+  CeedRestrictionType rstr_type;
+
+  CeedCall(CeedElemRestrictionGetCeed(rstr, &ceed));
+  CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+  CeedCheck(rstr_type == CEED_RESTRICTION_POINTS, ceed, CEED_ERROR_INCOMPATIBLE, "Can only set points for a points CeedElemRestriction");
+  CeedCheck(rstr->SetAtPointsOffsets, ceed, CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedElemRestrictionSetAtPointsOffsets");
+  CeedCheck(rstr->num_readers == 0, ceed, CEED_ERROR_ACCESS, "Cannot set points, a process has read access to the offsets");
+  CeedCheck(num_points >= 0 && (CeedSize)num_points * rstr->num_comp <= rstr->l_size, ceed, CEED_ERROR_DIMENSION,
+            "Number of points must be non-negative and fit in the L-vector. Found: %" CeedInt_FMT " points with L-vector size %" CeedSize_FMT,
+            num_points, rstr->l_size);
+  CeedCheck(offsets[0] == rstr->num_elem + 1 && offsets[rstr->num_elem] == rstr->num_elem + 1 + num_points, ceed, CEED_ERROR_DIMENSION,
+            "Element ranges in offsets must cover the %" CeedInt_FMT " points", num_points);
+  for (CeedInt e = 0; e < rstr->num_elem; e++) {
+    CeedCheck(offsets[e] <= offsets[e + 1], ceed, CEED_ERROR_DIMENSION, "Element ranges in offsets must be non-decreasing");
+  }
+  for (CeedInt i = 0; i < num_points; i++) {
+    const CeedInt point = offsets[rstr->num_elem + 1 + i];
+
+    CeedCheck(point >= 0 && (CeedSize)point * rstr->num_comp < rstr->l_size, ceed, CEED_ERROR_DIMENSION,
+              "Point index %" CeedInt_FMT " out of range of the L-vector", point);
+  }
+
+  rstr->num_points = num_points;
+  rstr->e_size     = (CeedSize)num_points * rstr->num_comp;
+  CeedCall(rstr->SetAtPointsOffsets(rstr, offsets));
+  rstr->points_state++;
+  CeedCall(CeedDestroy(&ceed));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the multiplicity of nodes in a `CeedElemRestriction`
 
@@ -1743,6 +2911,13 @@ int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream) {
             "CeedElemRestriction at points from (%" CeedSize_FMT ", %" CeedInt_FMT ") to %" CeedInt_FMT " elements with a maximum of %" CeedInt_FMT
             " points on an element\n",
             rstr->l_size, rstr->num_comp, rstr->num_elem, max_points);
+  } else if (rstr_type == CEED_RESTRICTION_STRUCTURED) {
+    fprintf(stream,
+            "%sCeedElemRestriction from (%" CeedSize_FMT ", %" CeedInt_FMT ") to %" CeedInt_FMT " elements on a structured %" CeedInt_FMT
+            "D grid [%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT "] with %" CeedInt_FMT " nodes each and node stride %" CeedInt_FMT
+            " and component stride %" CeedInt_FMT "\n",
+            rstr->block_size > 1 ? "Blocked " : "", rstr->l_size, rstr->num_comp, rstr->num_elem, rstr->dim, rstr->num_elem_1d[0],
+            rstr->num_elem_1d[1], rstr->num_elem_1d[2], rstr->elem_size, rstr->node_stride, rstr->comp_stride);
   } else {
     char strides_str[500];
 
@@ -1770,7 +2945,7 @@ int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream) {
   @ref User
 **/
 int CeedElemRestrictionDestroy(CeedElemRestriction *rstr) {
-  if (!*rstr || *rstr == CEED_ELEMRESTRICTION_NONE || --(*rstr)->ref_count > 0) {
+  if (!*rstr || *rstr == CEED_ELEMRESTRICTION_NONE || CeedAtomicDecrement((*rstr)->ref_count) > 0) {
     *rstr = NULL;
     return CEED_ERROR_SUCCESS;
   }
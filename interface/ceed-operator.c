@@ -534,6 +534,80 @@ static int CeedOperatorContextRestoreGenericRead(CeedOperator op, CeedContextFie
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Zero the passive output `CeedVector` of a `CeedOperator` and, for a composite `CeedOperator`, of all sub-operators
+
+  @param[in,out] op `CeedOperator`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSetPassiveOutputsZero(CeedOperator op) {
+  bool               is_composite;
+  CeedInt            num_output_fields;
+  CeedOperatorField *output_fields;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) CeedCall(CeedOperatorSetPassiveOutputsZero(op->sub_operators[i]));
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCall(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &output_fields));
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedVector vec;
+
+    CeedCall(CeedOperatorFieldGetVector(output_fields[i], &vec));
+    if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) CeedCall(CeedVectorSetValue(vec, 0.0));
+    CeedCall(CeedVectorDestroy(&vec));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Run a queued `CeedOperator` application on the worker thread
+
+  @param[in] req @ref CeedRequest describing the application
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyRequestRun(CeedRequest req) {
+  if (req->is_add) return CeedOperatorApplyAdd(req->op, req->in, req->out, CEED_REQUEST_IMMEDIATE);
+  return CeedOperatorApply(req->op, req->in, req->out, CEED_REQUEST_IMMEDIATE);
+}
+
+/**
+  @brief Queue a `CeedOperator` application on the worker thread of its `Ceed` context
+
+  @param[in]  op      `CeedOperator` to apply
+  @param[in]  is_add  Boolean flag to add the result to `out` instead of overwriting it
+  @param[in]  in      `CeedVector` containing input state or @ref CEED_VECTOR_NONE
+  @param[out] out     `CeedVector` to store result or @ref CEED_VECTOR_NONE
+  @param[out] request Address of @ref CeedRequest to complete
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyEnqueue(CeedOperator op, bool is_add, CeedVector in, CeedVector out, CeedRequest *request) {
+  CeedRequest req;
+
+  // Interface setup takes references, so it cannot overlap queued work
+  if (!op->is_interface_setup) {
+    CeedCall(CeedRequestQueueWait(CeedOperatorReturnCeed(op)));
+    CeedCall(CeedOperatorCheckReady(op));
+  }
+  CeedCall(CeedRequestCreate(CeedOperatorReturnCeed(op), CeedOperatorApplyRequestRun, &req));
+  req->is_add = is_add;
+  CeedCall(CeedOperatorReferenceCopy(op, &req->op));
+  CeedCall(CeedVectorReferenceCopy(in, &req->in));
+  CeedCall(CeedVectorReferenceCopy(out, &req->out));
+  CeedCall(CeedRequestSubmit(req, request));
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -634,6 +708,78 @@ int CeedOperatorIsSetupDone(CeedOperator op, bool *is_setup_done) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the element block size requested for a `CeedOperator`
+
+  @param[in]  op         `CeedOperator`
+  @param[out] block_size Variable to store requested block size; 0 if the backend default should be used or @ref CEED_BLOCK_SIZE_AUTO if the backend should select the block size
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetBlockSize(CeedOperator op, CeedInt *block_size) {
+  *block_size = op->block_size;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the number of threads requested for applying the sub-operators of a composite `CeedOperator` concurrently
+
+  @param[in]  op          Composite `CeedOperator`
+  @param[out] num_threads Variable to store requested number of threads; 0 if the backend default should be used
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedCompositeOperatorGetNumThreads(CeedOperator op, CeedInt *num_threads) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Only defined for a composite operator");
+  *num_threads = op->num_threads;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the state of a `CeedOperator`
+
+  The state is incremented whenever the fields, points, or sub-operators of the `CeedOperator` change.
+
+  @param[in]  op    `CeedOperator`
+  @param[out] state Variable to store state
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetState(CeedOperator op, uint64_t *state) {
+  *state = op->state;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the list of elements a `CeedOperator` is applied on
+
+  @param[in]  op              `CeedOperator`
+  @param[out] num_active_elem Variable to store number of active elements
+  @param[out] active_elems    Variable to store sorted list of active elements; NULL if all elements are active
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetActiveElements(CeedOperator op, CeedInt *num_active_elem, const CeedInt **active_elems) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Not defined for composite operator");
+  *num_active_elem = op->active_elems ? op->num_active_elem : op->num_elem;
+  *active_elems    = op->active_elems;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the `CeedQFunction` associated with a `CeedOperator`
 
@@ -709,7 +855,7 @@ int CeedOperatorSetData(CeedOperator op, void *data) {
   @ref Backend
 **/
 int CeedOperatorReference(CeedOperator op) {
-  op->ref_count++;
+  CeedAtomicIncrement(op->ref_count);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -735,6 +881,9 @@ int CeedOperatorSetSetupDone(CeedOperator op) {
 /// @addtogroup CeedOperatorUser
 /// @{
 
+/// Indicate that the backend should select the element block size by timing candidate block sizes
+const CeedInt CEED_BLOCK_SIZE_AUTO = -1;
+
 /**
   @brief Create a `CeedOperator` and associate a `CeedQFunction`.
 
@@ -1003,6 +1152,74 @@ found:
   if (op->num_qpts == 0 && !is_at_points) op->num_qpts = num_qpts;  // no consistent number of qpts for OperatorAtPoints
   op->num_fields += 1;
   CeedCall(CeedStringAllocCopy(field_name, (char **)&(*op_field)->field_name));
+  (*op_field)->storage_precision = CEED_SCALAR_TYPE;
+  op->state++;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set the precision in which a passive input field of a `CeedOperator` may be stored.
+
+  Backends that cache the restricted data for a passive input, such as stored quadrature data, may keep that copy in `precision` and convert to `CeedScalar` as each element block is loaded for the `CeedQFunction`.
+  Computation is always performed in `CeedScalar`.
+  This is a performance hint; backends that do not support reduced precision storage ignore it.
+
+  @param[in,out] op         `CeedOperator`
+  @param[in]     field_name Name of the passive input field
+  @param[in]     precision  @ref CeedScalarType to store the field data in
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetFieldStoragePrecision(CeedOperator op, const char *field_name, CeedScalarType precision) {
+  bool              is_composite, is_immutable;
+  CeedOperatorField op_field = NULL;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE, "Cannot set field precision for composite operator");
+  CeedCall(CeedOperatorIsImmutable(op, &is_immutable));
+  CeedCheck(!is_immutable, CeedOperatorReturnCeed(op), CEED_ERROR_MAJOR, "Operator cannot be changed after set as immutable");
+  for (CeedInt i = 0; i < op->qf->num_input_fields; i++) {
+    if (op->input_fields[i] && !strcmp(op->input_fields[i]->field_name, field_name)) op_field = op->input_fields[i];
+  }
+  CeedCheck(op_field, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE, "No input field named %s has been set", field_name);
+  CeedCheck(op_field->vec != CEED_VECTOR_ACTIVE && op_field->vec != CEED_VECTOR_NONE, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE,
+            "Storage precision can only be set for passive input fields");
+  op_field->storage_precision = precision;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Allow a `CeedOperator` to cache the quadrature point values of a passive input field.
+
+  Backends that support caching store the basis evaluation of the field at all quadrature points, e.g. a frozen coefficient with @ref CEED_EVAL_INTERP, and reuse it on later applications until the state of the field `CeedVector` changes.
+  This trades memory for one quadrature point value per component per element for skipping the restriction and basis action of the field.
+  This is a performance hint; backends that do not cache quadrature point values ignore it.
+
+  @param[in,out] op         `CeedOperator`
+  @param[in]     field_name Name of the passive input field
+  @param[in]     cache      Boolean flag to allow caching
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetFieldCacheQuadratureValues(CeedOperator op, const char *field_name, bool cache) {
+  bool              is_composite, is_immutable;
+  CeedOperatorField op_field = NULL;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE, "Cannot set field caching for composite operator");
+  CeedCall(CeedOperatorIsImmutable(op, &is_immutable));
+  CeedCheck(!is_immutable, CeedOperatorReturnCeed(op), CEED_ERROR_MAJOR, "Operator cannot be changed after set as immutable");
+  for (CeedInt i = 0; i < op->qf->num_input_fields; i++) {
+    if (op->input_fields[i] && !strcmp(op->input_fields[i]->field_name, field_name)) op_field = op->input_fields[i];
+  }
+  CeedCheck(op_field, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE, "No input field named %s has been set", field_name);
+  CeedCheck(op_field->vec != CEED_VECTOR_ACTIVE && op_field->vec != CEED_VECTOR_NONE, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPATIBLE,
+            "Quadrature point values can only be cached for passive input fields");
+  op_field->cache_qpt_values = cache;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1071,6 +1288,58 @@ int CeedOperatorAtPointsSetPoints(CeedOperator op, CeedElemRestriction rstr_poin
 
   CeedCall(CeedElemRestrictionReferenceCopy(rstr_points, &op->rstr_points));
   CeedCall(CeedVectorReferenceCopy(point_coords, &op->point_coords));
+  op->state++;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Move the points in each element of a `CeedOperator` at points without rebuilding it.
+
+  All points `CeedElemRestriction` used by the `CeedOperator` are updated with @ref CeedElemRestrictionSetAtPointsOffsets().
+  Updated point coordinates are written into the `point_coords` `CeedVector` set with @ref CeedOperatorAtPointsSetPoints(), and passive point fields into their own `CeedVector`.
+  Backends reuse their work vectors while the maximum number of points in an element stays within their capacity.
+  This function may be called on an immutable `CeedOperator`.
+
+  @param[in,out] op         `CeedOperator` at points
+  @param[in]     num_points New total number of points
+  @param[in]     offsets    Host array of size `num_elem + 1 + num_points` with the layout of @ref CeedElemRestrictionCreateAtPoints()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorAtPointsUpdatePoints(CeedOperator op, CeedInt num_points, const CeedInt *offsets) {
+  bool                 is_at_points;
+  CeedInt              num_input_fields, num_output_fields, num_rstrs = 0;
+  CeedElemRestriction *rstrs;
+
+  CeedCall(CeedOperatorIsAtPoints(op, &is_at_points));
+  CeedCheck(is_at_points, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Only defined for operator at points");
+  CeedCheck(op->rstr_points, CeedOperatorReturnCeed(op), CEED_ERROR_INCOMPLETE, "Points must be set before they can be updated");
+
+  // Collect each distinct points restriction once
+  CeedCall(CeedQFunctionGetNumArgs(op->qf, &num_input_fields, &num_output_fields));
+  CeedCall(CeedCalloc(num_input_fields + num_output_fields + 2, &rstrs));
+  rstrs[num_rstrs++] = op->rstr_points;
+  if (op->first_points_rstr) rstrs[num_rstrs++] = op->first_points_rstr;
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    CeedOperatorField field = i < num_input_fields ? op->input_fields[i] : op->output_fields[i - num_input_fields];
+
+    if (field && field->elem_rstr && field->elem_rstr != CEED_ELEMRESTRICTION_NONE) rstrs[num_rstrs++] = field->elem_rstr;
+  }
+  for (CeedInt i = 0; i < num_rstrs; i++) {
+    bool                is_new = true;
+    CeedRestrictionType rstr_type;
+
+    for (CeedInt j = 0; j < i; j++) is_new = is_new && rstrs[j] != rstrs[i];
+    CeedCall(CeedElemRestrictionGetType(rstrs[i], &rstr_type));
+    if (is_new && rstr_type == CEED_RESTRICTION_POINTS) CeedCall(CeedElemRestrictionSetAtPointsOffsets(rstrs[i], num_points, offsets));
+  }
+  CeedCall(CeedFree(&rstrs));
+
+  // Assembled data depends upon the points
+  CeedCall(CeedOperatorAssemblyDataStrip(op));
+  op->state++;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1228,6 +1497,36 @@ int CeedOperatorFieldGetVector(CeedOperatorField op_field, CeedVector *vec) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the storage precision of a `CeedOperator` Field.
+
+  @param[in]  op_field  `CeedOperator` Field
+  @param[out] precision Variable to store @ref CeedScalarType the field data may be stored in
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorFieldGetStoragePrecision(CeedOperatorField op_field, CeedScalarType *precision) {
+  *precision = op_field->storage_precision;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get whether the quadrature point values of a `CeedOperator` Field may be cached.
+
+  @param[in]  op_field `CeedOperator` Field
+  @param[out] cache    Variable to store flag, true if backends may cache the quadrature point values of the field
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorFieldGetCacheQuadratureValues(CeedOperatorField op_field, bool *cache) {
+  *cache = op_field->cache_qpt_values;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the data of a `CeedOperator` Field.
 
@@ -1290,6 +1589,7 @@ int CeedCompositeOperatorAddSub(CeedOperator composite_op, CeedOperator sub_op)
   composite_op->sub_operators[composite_op->num_suboperators] = sub_op;
   CeedCall(CeedOperatorReference(sub_op));
   composite_op->num_suboperators++;
+  composite_op->state++;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1365,6 +1665,33 @@ int CeedCompositeOperatorGetSubByName(CeedOperator op, const char *op_name, Ceed
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set the number of threads used to apply the sub-operators of a composite `CeedOperator` concurrently.
+
+  This is a performance hint; backends that do not support concurrent sub-operators ignore it.
+  CPU backends group sub-operators that share no `CeedQFunction`, `CeedQFunctionContext`, `CeedBasis`, `CeedElemRestriction`, or written `CeedVector` and apply each group on a pool of threads.
+  Each thread accumulates the active output into a private `CeedVector`, and these are summed into the output after all groups complete.
+  A `num_threads` of 0 restores the backend default, which applies the sub-operators one after another.
+
+  @param[in,out] op          Composite `CeedOperator`
+  @param[in]     num_threads Number of threads, or 0 for backend default
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedCompositeOperatorSetNumThreads(CeedOperator op, CeedInt num_threads) {
+  bool is_composite, is_immutable;
+
+  CeedCall(CeedOperatorIsImmutable(op, &is_immutable));
+  CeedCheck(!is_immutable, CeedOperatorReturnCeed(op), CEED_ERROR_MAJOR, "Operator cannot be changed after set as immutable");
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Only defined for a composite operator");
+  CeedCheck(num_threads >= 0, CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION, "Invalid number of threads: %" CeedInt_FMT, num_threads);
+  op->num_threads = num_threads;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Check if a `CeedOperator` is ready to be used.
 
@@ -1553,6 +1880,93 @@ int CeedOperatorSetName(CeedOperator op, const char *name) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set the number of elements a `CeedOperator` interleaves and processes together.
+
+  This is a performance hint; backends that do not process elements in blocks ignore it.
+  A `block_size` of 0 restores the backend default, which may be set via the `Ceed` resource, e.g. `/cpu/self/opt/blocked:block_size=16`.
+  Use @ref CEED_BLOCK_SIZE_AUTO to have the backend time candidate block sizes on the first application of the operator and keep the fastest.
+
+  Note: Calling this function on a composite `CeedOperator` sets the block size for all sub-operators.
+
+  @param[in,out] op         `CeedOperator`
+  @param[in]     block_size Element block size, 0 for backend default, or @ref CEED_BLOCK_SIZE_AUTO
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetBlockSize(CeedOperator op, CeedInt block_size) {
+  bool is_composite, is_immutable;
+
+  CeedCall(CeedOperatorIsImmutable(op, &is_immutable));
+  CeedCheck(!is_immutable, CeedOperatorReturnCeed(op), CEED_ERROR_MAJOR, "Operator cannot be changed after set as immutable");
+  CeedCheck(block_size >= 0 || block_size == CEED_BLOCK_SIZE_AUTO, CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION,
+            "Invalid block size: %" CeedInt_FMT, block_size);
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) CeedCall(CeedOperatorSetBlockSize(op->sub_operators[i], block_size));
+  }
+  op->block_size = block_size;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Restrict the application of a `CeedOperator` to a subset of its elements.
+
+  Subsequent applications of the operator, including diagonal and point block diagonal assembly, only visit the listed elements.
+  Contributions from all other elements are omitted, as if their element matrices were zero.
+  This is useful when only part of the mesh changes between applications, e.g. for adaptive or localized updates.
+  Full assembly, @ref CeedOperatorLinearAssembleQFunction(), multigrid, and FDM element inverse creation still use all elements.
+
+  Passing `active_elems` as NULL restores application on all elements.
+  The element list is copied and must be strictly increasing.
+
+  Note: The fields of the operator must be set before calling this function.
+
+  @param[in,out] op              `CeedOperator`
+  @param[in]     num_active_elem Number of active elements
+  @param[in]     active_elems    Sorted list of active elements, or NULL for all elements
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetActiveElements(CeedOperator op, CeedInt num_active_elem, const CeedInt *active_elems) {
+  bool    is_composite, is_immutable;
+  CeedInt num_elem;
+
+  CeedCall(CeedOperatorIsImmutable(op, &is_immutable));
+  CeedCheck(!is_immutable, CeedOperatorReturnCeed(op), CEED_ERROR_MAJOR, "Operator cannot be changed after set as immutable");
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(!is_composite, CeedOperatorReturnCeed(op), CEED_ERROR_MINOR, "Active elements must be set on each sub-operator of a composite operator");
+  CeedCheck(op->SetActiveElements, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Backend does not support SetActiveElements");
+  CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+  if (active_elems) {
+    CeedCheck(num_active_elem >= 0 && num_active_elem <= num_elem, CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION,
+              "Invalid number of active elements: %" CeedInt_FMT " for operator with %" CeedInt_FMT " elements", num_active_elem, num_elem);
+    for (CeedInt i = 0; i < num_active_elem; i++) {
+      CeedCheck(active_elems[i] >= 0 && active_elems[i] < num_elem && (i == 0 || active_elems[i] > active_elems[i - 1]),
+                CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION, "Active elements must be strictly increasing and in [0, %" CeedInt_FMT ")",
+                num_elem);
+    }
+  }
+
+  // Copy list
+  CeedCall(CeedFree(&op->active_elems));
+  op->num_active_elem = 0;
+  if (active_elems) {
+    CeedCall(CeedCalloc(num_active_elem ? num_active_elem : 1, &op->active_elems));
+    memcpy(op->active_elems, active_elems, num_active_elem * sizeof(CeedInt));
+    op->num_active_elem = num_active_elem;
+  }
+
+  // Backend and fallback
+  CeedCall(op->SetActiveElements(op));
+  if (op->op_fallback) CeedCall(CeedOperatorSetActiveElements(op->op_fallback, num_active_elem, active_elems));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Core logic for viewing a `CeedOperator`
 
@@ -2121,15 +2535,18 @@ int CeedOperatorRestoreContextBooleanRead(CeedOperator op, CeedContextFieldLabel
   @param[in]  op      `CeedOperator` to apply
   @param[in]  in      `CeedVector` containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
   @param[out] out     `CeedVector` to store result of applying operator (must be distinct from `in`) or @ref CEED_VECTOR_NONE if there are no active outputs
-  @param[in]  request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+  @param[in]  request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE.
+                        See @ref CeedRequestWait() for the restrictions while the request is pending.
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
 int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
-  bool is_composite;
+  bool is_async, is_composite;
 
+  CeedCall(CeedRequestIsAsync(CeedOperatorReturnCeed(op), request, &is_async));
+  if (is_async) return CeedOperatorApplyEnqueue(op, false, in, out, request);
   CeedCall(CeedOperatorCheckReady(op));
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
@@ -2138,29 +2555,9 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
     if (op->ApplyComposite) {
       CeedCall(op->ApplyComposite(op, in, out, request));
     } else {
-      CeedInt       num_suboperators;
-      CeedOperator *sub_operators;
-
-      CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
-      CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
-
       // Zero all output vectors
       if (out != CEED_VECTOR_NONE) CeedCall(CeedVectorSetValue(out, 0.0));
-      for (CeedInt i = 0; i < num_suboperators; i++) {
-        CeedInt            num_output_fields;
-        CeedOperatorField *output_fields;
-
-        CeedCall(CeedOperatorGetFields(sub_operators[i], NULL, NULL, &num_output_fields, &output_fields));
-        for (CeedInt j = 0; j < num_output_fields; j++) {
-          CeedVector vec;
-
-          CeedCall(CeedOperatorFieldGetVector(output_fields[j], &vec));
-          if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
-            CeedCall(CeedVectorSetValue(vec, 0.0));
-          }
-          CeedCall(CeedVectorDestroy(&vec));
-        }
-      }
+      CeedCall(CeedOperatorSetPassiveOutputsZero(op));
       // ApplyAdd
       CeedCall(CeedOperatorApplyAdd(op, in, out, request));
     }
@@ -2169,21 +2566,9 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
     if (op->Apply) {
       CeedCall(op->Apply(op, in, out, request));
     } else {
-      CeedInt            num_output_fields;
-      CeedOperatorField *output_fields;
-
-      CeedCall(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &output_fields));
       // Zero all output vectors
-      for (CeedInt i = 0; i < num_output_fields; i++) {
-        bool       is_active;
-        CeedVector vec;
-
-        CeedCall(CeedOperatorFieldGetVector(output_fields[i], &vec));
-        is_active = vec == CEED_VECTOR_ACTIVE;
-        if (is_active) vec = out;
-        if (vec != CEED_VECTOR_NONE) CeedCall(CeedVectorSetValue(vec, 0.0));
-        if (!is_active) CeedCall(CeedVectorDestroy(&vec));
-      }
+      if (out != CEED_VECTOR_NONE) CeedCall(CeedVectorSetValue(out, 0.0));
+      CeedCall(CeedOperatorSetPassiveOutputsZero(op));
       // Apply
       if (op->num_elem > 0) CeedCall(op->ApplyAdd(op, in, out, request));
     }
@@ -2200,15 +2585,18 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
   @param[in]  op      `CeedOperator` to apply
   @param[in]  in      `CeedVector` containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
   @param[out] out     `CeedVector` to sum in result of applying operator (must be distinct from `in`) or @ref CEED_VECTOR_NONE if there are no active outputs
-  @param[in]  request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+  @param[in]  request Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE.
+                        See @ref CeedRequestWait() for the restrictions while the request is pending.
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
 int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
-  bool is_composite;
+  bool is_async, is_composite;
 
+  CeedCall(CeedRequestIsAsync(CeedOperatorReturnCeed(op), request, &is_async));
+  if (is_async) return CeedOperatorApplyEnqueue(op, true, in, out, request);
   CeedCall(CeedOperatorCheckReady(op));
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
@@ -2233,6 +2621,83 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedReq
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Apply `CeedOperator` to several `CeedVector` in a single pass.
+
+  This computes the action of the operator on each active input `in[i]`, yielding the active output `out[i]`, as @ref CeedOperatorApply() would for each pair.
+  Backends may process all vectors in one sweep over the elements, so restriction offsets and passive inputs, such as quadrature data, are read once for all vectors.
+  This is useful for block Krylov methods, ensembles, and probing with several vectors.
+
+  Note: Passive output `CeedVector` are zeroed once and accumulate the contributions from all `num_vecs` applications.
+
+  Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+  @param[in]  op       `CeedOperator` to apply
+  @param[in]  num_vecs Number of input and output `CeedVector`
+  @param[in]  in       Array of `num_vecs` `CeedVector` containing input states, or @ref CEED_VECTOR_NONE if there are no active inputs
+  @param[out] out      Array of `num_vecs` `CeedVector` to store results of applying operator (must be distinct from `in`), or @ref CEED_VECTOR_NONE if there are no active outputs
+  @param[in]  request  Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE.
+                         The application is complete when this function returns.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyMultiple(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out, CeedRequest *request) {
+  CeedCall(CeedRequestSetImmediate(&request));
+  CeedCall(CeedOperatorCheckReady(op));
+
+  // Zero all output vectors
+  for (CeedInt i = 0; i < num_vecs; i++) {
+    if (out[i] != CEED_VECTOR_NONE) CeedCall(CeedVectorSetValue(out[i], 0.0));
+  }
+  CeedCall(CeedOperatorSetPassiveOutputsZero(op));
+  // ApplyAdd
+  CeedCall(CeedOperatorApplyAddMultiple(op, num_vecs, in, out, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply `CeedOperator` to several `CeedVector` in a single pass and add results to output `CeedVector`.
+
+  This computes the action of the operator on each active input `in[i]`, adding to the active output `out[i]`, as @ref CeedOperatorApplyAdd() would for each pair.
+  See @ref CeedOperatorApplyMultiple() for details.
+
+  @param[in]  op       `CeedOperator` to apply
+  @param[in]  num_vecs Number of input and output `CeedVector`
+  @param[in]  in       Array of `num_vecs` `CeedVector` containing input states, or @ref CEED_VECTOR_NONE if there are no active inputs
+  @param[out] out      Array of `num_vecs` `CeedVector` to sum in results of applying operator (must be distinct from `in`), or @ref CEED_VECTOR_NONE if there are no active outputs
+  @param[in]  request  Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE.
+                         The application is complete when this function returns.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddMultiple(CeedOperator op, CeedInt num_vecs, CeedVector *in, CeedVector *out, CeedRequest *request) {
+  bool is_composite;
+
+  CeedCall(CeedRequestSetImmediate(&request));
+  CeedCheck(num_vecs >= 0, CeedOperatorReturnCeed(op), CEED_ERROR_DIMENSION, "Invalid number of vectors: %" CeedInt_FMT, num_vecs);
+  CeedCall(CeedOperatorCheckReady(op));
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    // Composite Operator
+    for (CeedInt i = 0; i < op->num_suboperators; i++) {
+      CeedCall(CeedOperatorApplyAddMultiple(op->sub_operators[i], num_vecs, in, out, request));
+    }
+  } else if (op->num_elem > 0 && num_vecs > 0) {
+    // Standard Operator
+    if (op->ApplyAddMultiple) {
+      CeedCall(op->ApplyAddMultiple(op, num_vecs, in, out, request));
+    } else {
+      for (CeedInt i = 0; i < num_vecs; i++) CeedCall(op->ApplyAdd(op, in[i], out[i], request));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Destroy temporary assembly data associated with a `CeedOperator`
 
@@ -2272,7 +2737,7 @@ int CeedOperatorAssemblyDataStrip(CeedOperator op) {
   @ref User
 **/
 int CeedOperatorDestroy(CeedOperator *op) {
-  if (!*op || --(*op)->ref_count > 0) {
+  if (!*op || CeedAtomicDecrement((*op)->ref_count) > 0) {
     *op = NULL;
     return CEED_ERROR_SUCCESS;
   }
@@ -2311,6 +2776,7 @@ int CeedOperatorDestroy(CeedOperator *op) {
   }
   CeedCall(CeedFree(&(*op)->input_fields));
   CeedCall(CeedFree(&(*op)->output_fields));
+  CeedCall(CeedFree(&(*op)->active_elems));
   // Destroy AtPoints data
   CeedCall(CeedVectorDestroy(&(*op)->point_coords));
   CeedCall(CeedElemRestrictionDestroy(&(*op)->rstr_points));
@@ -188,6 +188,7 @@ static int CeedOperatorCreateFallback(CeedOperator op) {
       CeedCall(CeedOperatorGetQFunctionAssemblyData(op, &data));
       CeedCall(CeedQFunctionAssemblyDataReferenceCopy(data, &op_fallback->qf_assembled));
     }
+    if (op->active_elems) CeedCall(CeedOperatorSetActiveElements(op_fallback, op->num_active_elem, op->active_elems));
     // Cleanup
     CeedCall(CeedQFunctionDestroy(&qf_fallback));
     CeedCall(CeedQFunctionDestroy(&dqf_fallback));
@@ -250,7 +251,8 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
 
   // Loop over all active bases (find matching input/output pairs)
   for (CeedInt b = 0; b < CeedIntMin(num_active_bases_in, num_active_bases_out); b++) {
-    CeedInt             b_in, b_out, num_elem, num_nodes, num_qpts, num_comp;
+    CeedInt             b_in, b_out, num_active_elem, num_nodes, num_qpts, num_comp;
+    const CeedInt      *active_elems;
     bool                has_eval_none = false;
     CeedScalar         *elem_diag_array, *identity = NULL;
     CeedVector          elem_diag;
@@ -293,7 +295,7 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
     // Assemble element operator diagonals
     CeedCall(CeedVectorSetValue(elem_diag, 0.0));
     CeedCall(CeedVectorGetArray(elem_diag, CEED_MEM_HOST, &elem_diag_array));
-    CeedCall(CeedElemRestrictionGetNumElements(diag_elem_rstr, &num_elem));
+    CeedCall(CeedOperatorGetActiveElements(op, &num_active_elem, &active_elems));
     CeedCall(CeedBasisGetNumNodes(active_bases_in[b_in], &num_nodes));
     CeedCall(CeedBasisGetNumComponents(active_bases_in[b_in], &num_comp));
     if (active_bases_in[b_in] == CEED_BASIS_NONE) num_qpts = num_nodes;
@@ -312,8 +314,9 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
     }
 
     // Compute the diagonal of B^T D B
-    // Each element
-    for (CeedSize e = 0; e < num_elem; e++) {
+    // Each active element
+    for (CeedInt i = 0; i < num_active_elem; i++) {
+      const CeedSize e = active_elems ? active_elems[i] : i;
       // Each basis eval mode pair
       CeedInt      d_out              = 0, q_comp_out;
       CeedEvalMode eval_mode_out_prev = CEED_EVAL_NONE;
@@ -1228,7 +1231,7 @@ int CeedQFunctionAssemblyDataCreate(Ceed ceed, CeedQFunctionAssemblyData *data)
   @ref Backend
 **/
 int CeedQFunctionAssemblyDataReference(CeedQFunctionAssemblyData data) {
-  data->ref_count++;
+  CeedAtomicIncrement(data->ref_count);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1363,7 +1366,7 @@ int CeedQFunctionAssemblyDataGetObjects(CeedQFunctionAssemblyData data, CeedVect
   @ref Backend
 **/
 int CeedQFunctionAssemblyDataDestroy(CeedQFunctionAssemblyData *data) {
-  if (!*data || --(*data)->ref_count > 0) {
+  if (!*data || CeedAtomicDecrement((*data)->ref_count) > 0) {
     *data = NULL;
     return CEED_ERROR_SUCCESS;
   }
@@ -1895,6 +1898,7 @@ int CeedOperatorGetFallbackParentCeed(CeedOperator op, Ceed *parent) {
   @ref User
 **/
 int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  CeedCall(CeedRequestSetImmediate(&request));
   CeedCall(CeedOperatorCheckReady(op));
 
   if (op->LinearAssembleQFunction) {
@@ -1935,6 +1939,7 @@ int CeedOperatorLinearAssembleQFunctionBuildOrUpdate(CeedOperator op, CeedVector
   CeedOperator op_assemble                                                                           = NULL;
   CeedOperator op_fallback_parent                                                                    = NULL;
 
+  CeedCall(CeedRequestSetImmediate(&request));
   CeedCall(CeedOperatorCheckReady(op));
 
   // Determine if fallback parent or operator has implementation
@@ -2008,6 +2013,7 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, Ce
   bool     is_composite;
   CeedSize input_size = 0, output_size = 0;
 
+  CeedCall(CeedRequestSetImmediate(&request));
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
@@ -2068,6 +2074,7 @@ int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled,
   bool     is_composite;
   CeedSize input_size = 0, output_size = 0;
 
+  CeedCall(CeedRequestSetImmediate(&request));
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
@@ -2232,6 +2239,7 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op, CeedVector ass
   bool     is_composite;
   CeedSize input_size = 0, output_size = 0;
 
+  CeedCall(CeedRequestSetImmediate(&request));
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
@@ -2294,6 +2302,7 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector
   bool     is_composite;
   CeedSize input_size = 0, output_size = 0;
 
+  CeedCall(CeedRequestSetImmediate(&request));
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
@@ -2748,6 +2757,7 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   CeedQFunction        qf, qf_fdm;
   CeedOperatorField   *op_fields;
 
+  CeedCall(CeedRequestSetImmediate(&request));
   CeedCall(CeedOperatorCheckReady(op));
 
   if (op->CreateFDMElementInverse) {
@@ -2800,6 +2810,12 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   // Build and diagonalize 1D Mass and Laplacian
   CeedCall(CeedBasisIsTensor(basis, &is_tensor_basis));
   CeedCheck(is_tensor_basis, ceed, CEED_ERROR_BACKEND, "FDMElementInverse only supported for tensor bases");
+  {
+    CeedFESpace fe_space;
+
+    CeedCall(CeedBasisGetFESpace(basis, &fe_space));
+    CeedCheck(fe_space == CEED_FE_SPACE_H1, ceed, CEED_ERROR_BACKEND, "FDMElementInverse only supported for H^1 bases");
+  }
   CeedCall(CeedCalloc(P_1d * P_1d, &mass));
   CeedCall(CeedCalloc(P_1d * P_1d, &laplace));
   CeedCall(CeedCalloc(P_1d * P_1d, &x));
@@ -5,11 +5,14 @@
 //
 // This file is part of CEED:  http://github.com/ceed
 
+#define _POSIX_C_SOURCE 200112
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <pthread.h>
 #include <stdbool.h>
 
-static bool register_all_called;
+static bool            register_all_called;
+static pthread_mutex_t register_all_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 #define CEED_GALLERY_QFUNCTION(name) CEED_INTERN int name(void);
 #include "../gallery/ceed-gallery-list.h"
@@ -30,15 +33,16 @@ static bool register_all_called;
 int CeedQFunctionRegisterAll(void) {
   int ierr = 0;
 
-  CeedPragmaCritical(CeedQFunctionRegisterAll) {
-    if (!register_all_called) {
-      CeedDebugEnv256(1, "\n---------- Registering Gallery QFunctions ----------\n");
+  // Application threads may create gallery `CeedQFunction`s concurrently
+  pthread_mutex_lock(&register_all_mutex);
+  if (!register_all_called) {
+    CeedDebugEnv256(1, "\n---------- Registering Gallery QFunctions ----------\n");
 #define CEED_GALLERY_QFUNCTION(name) \
   if (!ierr) ierr = name();
 #include "../gallery/ceed-gallery-list.h"
 #undef CEED_GALLERY_QFUNCTION
-      register_all_called = true;
-    }
+    register_all_called = true;
   }
+  pthread_mutex_unlock(&register_all_mutex);
   return ierr;
 }
@@ -508,6 +508,38 @@ int CeedQFunctionIsContextWritable(CeedQFunction qf, bool *is_writable) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Determine if backend operators may call the user function of a `CeedQFunction` directly on raw arrays instead of @ref CeedQFunctionApply()
+
+  @param[in]  qf        `CeedQFunction`
+  @param[out] is_direct Variable to store direct call status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionIsUserFunctionDirect(CeedQFunction qf, bool *is_direct) {
+  *is_direct = qf->is_user_function_direct;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set whether backend operators may call the user function of a `CeedQFunction` directly on raw arrays.
+
+  QFunction backends set this when their apply only calls the user function on the host, so skipping @ref CeedQFunctionApply() loses no checks.
+
+  @param[in,out] qf        `CeedQFunction`
+  @param[in]     is_direct Direct call status to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionSetUserFunctionDirect(CeedQFunction qf, bool is_direct) {
+  qf->is_user_function_direct = is_direct;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get backend data of a `CeedQFunction`
 
@@ -577,7 +609,7 @@ int CeedQFunctionSetImmutable(CeedQFunction qf) {
   @ref Backend
 **/
 int CeedQFunctionReference(CeedQFunction qf) {
-  qf->ref_count++;
+  CeedAtomicIncrement(qf->ref_count);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1067,7 +1099,7 @@ int CeedQFunctionApply(CeedQFunction qf, CeedInt Q, CeedVector *u, CeedVector *v
   @ref User
 **/
 int CeedQFunctionDestroy(CeedQFunction *qf) {
-  if (!*qf || --(*qf)->ref_count > 0) {
+  if (!*qf || CeedAtomicDecrement((*qf)->ref_count) > 0) {
     *qf = NULL;
     return CEED_ERROR_SUCCESS;
   }
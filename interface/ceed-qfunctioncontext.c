@@ -542,7 +542,7 @@ int CeedQFunctionContextGetDataDestroy(CeedQFunctionContext ctx, CeedMemType *f_
   @ref Backend
 **/
 int CeedQFunctionContextReference(CeedQFunctionContext ctx) {
-  ctx->ref_count++;
+  CeedAtomicIncrement(ctx->ref_count);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -729,7 +729,7 @@ int CeedQFunctionContextGetDataRead(CeedQFunctionContext ctx, CeedMemType mem_ty
   CeedCheck(has_valid_data, CeedQFunctionContextReturnCeed(ctx), CEED_ERROR_BACKEND, "CeedQFunctionContext has no valid data to get, must set data");
 
   CeedCall(ctx->GetDataRead(ctx, mem_type, data));
-  ctx->num_readers++;
+  CeedAtomicIncrement(ctx->num_readers);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -763,10 +763,10 @@ int CeedQFunctionContextRestoreData(CeedQFunctionContext ctx, void *data) {
   @ref User
 **/
 int CeedQFunctionContextRestoreDataRead(CeedQFunctionContext ctx, void *data) {
-  CeedCheck(ctx->num_readers > 0, CeedQFunctionContextReturnCeed(ctx), 1, "Cannot restore CeedQFunctionContext array access, access was not granted");
+  CeedCheck(CeedAtomicLoad(ctx->num_readers) > 0, CeedQFunctionContextReturnCeed(ctx), 1,
+            "Cannot restore CeedQFunctionContext array access, access was not granted");
 
-  ctx->num_readers--;
-  if (ctx->num_readers == 0 && ctx->RestoreDataRead) CeedCall(ctx->RestoreDataRead(ctx));
+  if (CeedAtomicDecrement(ctx->num_readers) == 0 && ctx->RestoreDataRead) CeedCall(ctx->RestoreDataRead(ctx));
   *(void **)data = NULL;
   return CEED_ERROR_SUCCESS;
 }
@@ -928,7 +928,7 @@ int CeedQFunctionContextSetDataDestroy(CeedQFunctionContext ctx, CeedMemType f_m
   @ref User
 **/
 int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx) {
-  if (!*ctx || --(*ctx)->ref_count > 0) {
+  if (!*ctx || CeedAtomicDecrement((*ctx)->ref_count) > 0) {
     *ctx = NULL;
     return CEED_ERROR_SUCCESS;
   }
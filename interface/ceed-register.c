@@ -5,11 +5,14 @@
 //
 // This file is part of CEED:  http://github.com/ceed
 
+#define _POSIX_C_SOURCE 200112
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <pthread.h>
 #include <stdbool.h>
 
-static bool register_all_called;
+static bool            register_all_called;
+static pthread_mutex_t register_all_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 #define CEED_BACKEND(name, ...) CEED_INTERN int name(void);
 #include "../backends/ceed-backend-list.h"
@@ -30,15 +33,16 @@ static bool register_all_called;
 int CeedRegisterAll(void) {
   int ierr = 0;
 
-  CeedPragmaCritical(CeedRegisterAll) {
-    if (!register_all_called) {
-      CeedDebugEnv256(1, "\n---------- Registering Backends ----------\n");
+  // Application threads may create their first `Ceed` contexts concurrently
+  pthread_mutex_lock(&register_all_mutex);
+  if (!register_all_called) {
+    CeedDebugEnv256(1, "\n---------- Registering Backends ----------\n");
 #define CEED_BACKEND(name, ...) \
   if (!ierr) ierr = name();
 #include "../backends/ceed-backend-list.h"
 #undef CEED_BACKEND
-      register_all_called = true;
-    }
+    register_all_called = true;
   }
+  pthread_mutex_unlock(&register_all_mutex);
   return ierr;
 }
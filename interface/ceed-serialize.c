@@ -0,0 +1,1140 @@
+// Copyright (c) 2017-2025, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed-impl.h>
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/// @file
+/// Implementation of CeedOperator serialization interfaces
+
+/// ----------------------------------------------------------------------------
+/// CeedOperator Library Internal Serialization Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedOperatorDeveloper
+/// @{
+
+// Operator files start with this magic string, followed by the version, an endianness marker, and the scalar type
+static const char     ceed_operator_file_magic[8] = "libCEED";
+static const uint32_t ceed_operator_file_version  = 1;
+static const uint32_t ceed_operator_file_endian   = 0x01020304;
+static const CeedInt  ceed_operator_file_active   = -1;
+static const CeedInt  ceed_operator_file_none     = -2;
+
+// Distinct objects referenced by the fields of a `CeedOperator` and its sub-operators, in the order they are written
+typedef struct {
+  CeedInt num_qf, num_rstr, num_basis, num_vec;
+  void  **qfs, **rstrs, **bases, **vecs;
+} CeedOperatorFileObjects;
+
+/**
+  @brief Write data to an operator file
+
+  @param[in] ceed  `Ceed` object for error handling
+  @param[in] file  File to write to
+  @param[in] data  Data to write
+  @param[in] size  Size of each entry in bytes
+  @param[in] count Number of entries
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedFileWrite(Ceed ceed, FILE *file, const void *data, size_t size, size_t count) {
+  if (count == 0) return CEED_ERROR_SUCCESS;
+  CeedCheck(fwrite(data, size, count, file) == count, ceed, CEED_ERROR_MAJOR, "Couldn't write to operator file");
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read data from an operator file
+
+  @param[in]  ceed  `Ceed` object for error handling
+  @param[in]  file  File to read from
+  @param[out] data  Array to store data
+  @param[in]  size  Size of each entry in bytes
+  @param[in]  count Number of entries
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedFileRead(Ceed ceed, FILE *file, void *data, size_t size, size_t count) {
+  if (count == 0) return CEED_ERROR_SUCCESS;
+  CeedCheck(fread(data, size, count, file) == count, ceed, CEED_ERROR_MAJOR, "Couldn't read from operator file, file is truncated");
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write a string, or `NULL`, to an operator file
+
+  @param[in] ceed `Ceed` object for error handling
+  @param[in] file File to write to
+  @param[in] str  String to write, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedFileWriteString(Ceed ceed, FILE *file, const char *str) {
+  const int64_t len = str ? (int64_t)strlen(str) : -1;
+
+  CeedCall(CeedFileWrite(ceed, file, &len, sizeof(len), 1));
+  if (str) CeedCall(CeedFileWrite(ceed, file, str, sizeof(char), len));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read a string, or `NULL`, from an operator file
+
+  @param[in]  ceed `Ceed` object for error handling
+  @param[in]  file File to read from
+  @param[out] str  Newly allocated string, or `NULL`; caller is responsible for freeing
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedFileReadString(Ceed ceed, FILE *file, char **str) {
+  int64_t len;
+
+  *str = NULL;
+  CeedCall(CeedFileRead(ceed, file, &len, sizeof(len), 1));
+  if (len < 0) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedCalloc(len + 1, str));
+  CeedCall(CeedFileRead(ceed, file, *str, sizeof(char), len));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Pad an operator file with zeros to the next multiple of @ref CEED_ALIGN bytes
+
+  @param[in] ceed `Ceed` object for error handling
+  @param[in] file File to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedFileWritePadding(Ceed ceed, FILE *file) {
+  const char zeros[CEED_ALIGN] = {0};
+  long       offset            = ftell(file);
+
+  CeedCheck(offset >= 0, ceed, CEED_ERROR_MAJOR, "Couldn't get position in operator file");
+  CeedCall(CeedFileWrite(ceed, file, zeros, sizeof(char), (CEED_ALIGN - offset % CEED_ALIGN) % CEED_ALIGN));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Skip the padding of an operator file to the next multiple of @ref CEED_ALIGN bytes
+
+  @param[in]  ceed   `Ceed` object for error handling
+  @param[in]  file   File to read from
+  @param[out] offset Aligned position in the file
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedFileSkipPadding(Ceed ceed, FILE *file, long *offset) {
+  *offset = ftell(file);
+  CeedCheck(*offset >= 0, ceed, CEED_ERROR_MAJOR, "Couldn't get position in operator file");
+  *offset += (CEED_ALIGN - *offset % CEED_ALIGN) % CEED_ALIGN;
+  CeedCheck(!fseek(file, *offset, SEEK_SET), ceed, CEED_ERROR_MAJOR, "Couldn't seek in operator file");
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Find the index of an object in a list of objects, adding it if it is not found
+
+  @param[in,out] num_objs Number of objects in the list
+  @param[in,out] objs     List of objects
+  @param[in]     obj      Object to find or add
+  @param[out]    index    Index of object in list, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedFileObjectsAdd(CeedInt *num_objs, void ***objs, void *obj, CeedInt *index) {
+  CeedInt i = 0;
+
+  while (i < *num_objs && (*objs)[i] != obj) i++;
+  if (i == *num_objs) {
+    CeedCall(CeedRealloc(*num_objs + 1, objs));
+    (*objs)[i] = obj;
+    (*num_objs)++;
+  }
+  if (index) *index = i;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Find the index of an object in a list of objects
+
+  @param[in] num_objs Number of objects in the list
+  @param[in] objs     List of objects
+  @param[in] obj      Object to find
+
+  @return Index of object in list, or -1 if not found
+
+  @ref Developer
+**/
+static CeedInt CeedFileObjectsIndex(CeedInt num_objs, void **objs, const void *obj) {
+  for (CeedInt i = 0; i < num_objs; i++) {
+    if (objs[i] == obj) return i;
+  }
+  return -1;
+}
+
+/**
+  @brief Collect the distinct objects referenced by a `CeedOperator` and its sub-operators
+
+  @param[in]     op   `CeedOperator` to collect objects for
+  @param[in,out] objs Collected objects
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorFileObjectsCollect(CeedOperator op, CeedOperatorFileObjects *objs) {
+  bool               is_composite, is_at_points;
+  CeedInt            num_fields[2];
+  CeedOperatorField *fields[2];
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) CeedCall(CeedOperatorFileObjectsCollect(op->sub_operators[i], objs));
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCall(CeedOperatorIsAtPoints(op, &is_at_points));
+  CeedCheck(!is_at_points, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED, "Saving CeedOperator at points is not supported");
+  CeedCheck(!op->qf->is_fortran, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED,
+            "Saving CeedOperator with Fortran CeedQFunction is not supported");
+
+  CeedCall(CeedFileObjectsAdd(&objs->num_qf, &objs->qfs, op->qf, NULL));
+  if (op->dqf) CeedCall(CeedFileObjectsAdd(&objs->num_qf, &objs->qfs, op->dqf, NULL));
+  if (op->dqfT) CeedCall(CeedFileObjectsAdd(&objs->num_qf, &objs->qfs, op->dqfT, NULL));
+  CeedCall(CeedOperatorGetFields(op, &num_fields[0], &fields[0], &num_fields[1], &fields[1]));
+  for (CeedInt j = 0; j < 2; j++) {
+    for (CeedInt i = 0; i < num_fields[j]; i++) {
+      CeedElemRestriction rstr  = fields[j][i]->elem_rstr;
+      CeedBasis           basis = fields[j][i]->basis;
+      CeedVector          vec   = fields[j][i]->vec;
+
+      if (rstr != CEED_ELEMRESTRICTION_NONE) {
+        // Unsigned and unoriented copies refer to the restriction they were copied from
+        if (rstr->rstr_base) CeedCall(CeedFileObjectsAdd(&objs->num_rstr, &objs->rstrs, rstr->rstr_base, NULL));
+        CeedCall(CeedFileObjectsAdd(&objs->num_rstr, &objs->rstrs, rstr, NULL));
+      }
+      if (basis != CEED_BASIS_NONE) CeedCall(CeedFileObjectsAdd(&objs->num_basis, &objs->bases, basis, NULL));
+      if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) CeedCall(CeedFileObjectsAdd(&objs->num_vec, &objs->vecs, vec, NULL));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write a `CeedQFunction` to an operator file
+
+  Gallery `CeedQFunction` are written by name and user `CeedQFunction` by kernel name.
+  The fields and the context data, with its registered fields, are written in full.
+
+  @param[in] qf   `CeedQFunction` to write
+  @param[in] file File to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedQFunctionWriteToFile(CeedQFunction qf, FILE *file) {
+  Ceed                 ceed     = CeedQFunctionReturnCeed(qf);
+  int64_t              ctx_size = -1;
+  const char          *kernel_name;
+  CeedQFunctionContext ctx;
+
+  CeedCall(CeedQFunctionGetKernelName(qf, &kernel_name));
+  CeedCall(CeedFileWrite(ceed, file, &qf->is_gallery, sizeof(bool), 1));
+  CeedCall(CeedFileWrite(ceed, file, &qf->is_identity, sizeof(bool), 1));
+  CeedCall(CeedFileWriteString(ceed, file, qf->is_gallery ? qf->gallery_name : kernel_name));
+  CeedCall(CeedFileWrite(ceed, file, &qf->vec_length, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &qf->user_flop_estimate, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &qf->is_context_writable, sizeof(bool), 1));
+
+  // Fields
+  CeedCall(CeedFileWrite(ceed, file, &qf->num_input_fields, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &qf->num_output_fields, sizeof(CeedInt), 1));
+  for (CeedInt j = 0; j < 2; j++) {
+    const CeedInt       num_fields = j ? qf->num_output_fields : qf->num_input_fields;
+    CeedQFunctionField *fields     = j ? qf->output_fields : qf->input_fields;
+
+    for (CeedInt i = 0; i < num_fields; i++) {
+      CeedCall(CeedFileWriteString(ceed, file, fields[i]->field_name));
+      CeedCall(CeedFileWrite(ceed, file, &fields[i]->size, sizeof(CeedInt), 1));
+      CeedCall(CeedFileWrite(ceed, file, &fields[i]->eval_mode, sizeof(CeedEvalMode), 1));
+    }
+  }
+
+  // Context data and registered fields
+  CeedCall(CeedQFunctionGetContext(qf, &ctx));
+  if (ctx) {
+    size_t                       size;
+    const void                  *data;
+    CeedInt                      num_labels;
+    const CeedContextFieldLabel *labels;
+
+    CeedCall(CeedQFunctionContextGetContextSize(ctx, &size));
+    ctx_size = (int64_t)size;
+    CeedCall(CeedFileWrite(ceed, file, &ctx_size, sizeof(ctx_size), 1));
+    CeedCall(CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &data));
+    CeedCall(CeedFileWrite(ceed, file, data, sizeof(char), size));
+    CeedCall(CeedQFunctionContextRestoreDataRead(ctx, &data));
+    CeedCall(CeedQFunctionContextGetAllFieldLabels(ctx, &labels, &num_labels));
+    CeedCall(CeedFileWrite(ceed, file, &num_labels, sizeof(CeedInt), 1));
+    for (CeedInt i = 0; i < num_labels; i++) {
+      const uint64_t offset = labels[i]->offset, num_values = labels[i]->num_values;
+
+      CeedCall(CeedFileWriteString(ceed, file, labels[i]->name));
+      CeedCall(CeedFileWriteString(ceed, file, labels[i]->description));
+      CeedCall(CeedFileWrite(ceed, file, &labels[i]->type, sizeof(CeedContextFieldType), 1));
+      CeedCall(CeedFileWrite(ceed, file, &offset, sizeof(offset), 1));
+      CeedCall(CeedFileWrite(ceed, file, &num_values, sizeof(num_values), 1));
+    }
+    CeedCall(CeedQFunctionContextDestroy(&ctx));
+  } else {
+    CeedCall(CeedFileWrite(ceed, file, &ctx_size, sizeof(ctx_size), 1));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read a `CeedQFunction` from an operator file
+
+  Gallery `CeedQFunction` are created by name.
+  User `CeedQFunction` are created with the user function and source of the `CeedQFunction` in `qfs` with a matching kernel name.
+
+  @param[in]  ceed   `Ceed` object used to create the `CeedQFunction`
+  @param[in]  file   File to read from
+  @param[in]  num_qf Number of user `CeedQFunction` in `qfs`
+  @param[in]  qfs    User `CeedQFunction` providing the user functions
+  @param[out] qf     Address of the variable where the newly created `CeedQFunction` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedQFunctionReadFromFile(Ceed ceed, FILE *file, CeedInt num_qf, CeedQFunction *qfs, CeedQFunction *qf) {
+  bool                is_gallery, is_identity, is_context_writable;
+  char               *name;
+  CeedInt             vec_length, user_flop_estimate, num_fields[2], qf_num_fields[2];
+  int64_t             ctx_size;
+  CeedQFunctionField *qf_fields[2];
+
+  CeedCall(CeedFileRead(ceed, file, &is_gallery, sizeof(bool), 1));
+  CeedCall(CeedFileRead(ceed, file, &is_identity, sizeof(bool), 1));
+  CeedCall(CeedFileReadString(ceed, file, &name));
+  CeedCall(CeedFileRead(ceed, file, &vec_length, sizeof(CeedInt), 1));
+  CeedCall(CeedFileRead(ceed, file, &user_flop_estimate, sizeof(CeedInt), 1));
+  CeedCall(CeedFileRead(ceed, file, &is_context_writable, sizeof(bool), 1));
+  CeedCall(CeedFileRead(ceed, file, num_fields, sizeof(CeedInt), 2));
+  CeedCheck(name, ceed, CEED_ERROR_INCOMPATIBLE, "Operator file has a CeedQFunction without a name");
+
+  if (is_gallery) {
+    CeedCall(CeedQFunctionCreateInteriorByName(ceed, name, qf));
+  } else {
+    char         *source_with_name;
+    CeedQFunction qf_user = NULL;
+
+    for (CeedInt i = 0; i < num_qf && !qf_user; i++) {
+      const char *kernel_name;
+
+      CeedCall(CeedQFunctionGetKernelName(qfs[i], &kernel_name));
+      if (!qfs[i]->is_gallery && !strcmp(kernel_name, name)) qf_user = qfs[i];
+    }
+    CeedCheck(qf_user, ceed, CEED_ERROR_INCOMPATIBLE, "No user CeedQFunction provided for kernel %s", name);
+    if (qf_user->user_source) {
+      CeedCall(CeedStringAllocCopy(qf_user->user_source, &source_with_name));
+    } else {
+      size_t path_len = strlen(qf_user->source_path), name_len = strlen(qf_user->kernel_name);
+
+      CeedCall(CeedCalloc(path_len + name_len + 2, &source_with_name));
+      memcpy(source_with_name, qf_user->source_path, path_len);
+      source_with_name[path_len] = ':';
+      memcpy(&source_with_name[path_len + 1], qf_user->kernel_name, name_len);
+    }
+    CeedCall(CeedQFunctionCreateInterior(ceed, vec_length, qf_user->function, source_with_name, qf));
+    CeedCall(CeedFree(&source_with_name));
+    if (user_flop_estimate >= 0) CeedCall(CeedQFunctionSetUserFlopsEstimate(*qf, user_flop_estimate));
+  }
+  CeedCall(CeedFree(&name));
+  (*qf)->is_identity = is_identity;
+
+  // Fields; gallery CeedQFunction may add their own fields, which must match
+  qf_num_fields[0] = (*qf)->num_input_fields;
+  qf_num_fields[1] = (*qf)->num_output_fields;
+  qf_fields[0]     = (*qf)->input_fields;
+  qf_fields[1]     = (*qf)->output_fields;
+  for (CeedInt j = 0; j < 2; j++) {
+    for (CeedInt i = 0; i < num_fields[j]; i++) {
+      char        *field_name;
+      CeedInt      size;
+      CeedEvalMode eval_mode;
+
+      CeedCall(CeedFileReadString(ceed, file, &field_name));
+      CeedCall(CeedFileRead(ceed, file, &size, sizeof(CeedInt), 1));
+      CeedCall(CeedFileRead(ceed, file, &eval_mode, sizeof(CeedEvalMode), 1));
+      if (i < qf_num_fields[j]) {
+        CeedCheck(!strcmp(qf_fields[j][i]->field_name, field_name) && qf_fields[j][i]->size == size && qf_fields[j][i]->eval_mode == eval_mode, ceed,
+                  CEED_ERROR_INCOMPATIBLE, "CeedQFunction field %s does not match operator file", field_name);
+      } else if (j == 0) {
+        CeedCall(CeedQFunctionAddInput(*qf, field_name, size, eval_mode));
+      } else {
+        CeedCall(CeedQFunctionAddOutput(*qf, field_name, size, eval_mode));
+      }
+      CeedCall(CeedFree(&field_name));
+    }
+  }
+
+  // Context data and registered fields
+  CeedCall(CeedFileRead(ceed, file, &ctx_size, sizeof(ctx_size), 1));
+  if (ctx_size >= 0) {
+    size_t               size = 0;
+    void                *data;
+    CeedInt              num_labels;
+    CeedQFunctionContext ctx;
+
+    // Gallery CeedQFunction may create their own context, which is reused if the size matches
+    CeedCall(CeedQFunctionGetContext(*qf, &ctx));
+    if (ctx) CeedCall(CeedQFunctionContextGetContextSize(ctx, &size));
+    if (ctx && size == (size_t)ctx_size) {
+      CeedCall(CeedQFunctionContextGetData(ctx, CEED_MEM_HOST, &data));
+      CeedCall(CeedFileRead(ceed, file, data, sizeof(char), ctx_size));
+      CeedCall(CeedQFunctionContextRestoreData(ctx, &data));
+    } else {
+      CeedCall(CeedQFunctionContextDestroy(&ctx));
+      CeedCall(CeedQFunctionContextCreate(ceed, &ctx));
+      CeedCall(CeedMallocArray(ctx_size ? ctx_size : 1, sizeof(char), &data));
+      CeedCall(CeedFileRead(ceed, file, data, sizeof(char), ctx_size));
+      CeedCall(CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_OWN_POINTER, ctx_size, data));
+      CeedCall(CeedQFunctionSetContext(*qf, ctx));
+    }
+    CeedCall(CeedFileRead(ceed, file, &num_labels, sizeof(CeedInt), 1));
+    for (CeedInt i = 0; i < num_labels; i++) {
+      char                 *label_name, *description;
+      uint64_t              offset, num_values;
+      CeedContextFieldType  type;
+      CeedContextFieldLabel label;
+
+      CeedCall(CeedFileReadString(ceed, file, &label_name));
+      CeedCall(CeedFileReadString(ceed, file, &description));
+      CeedCall(CeedFileRead(ceed, file, &type, sizeof(CeedContextFieldType), 1));
+      CeedCall(CeedFileRead(ceed, file, &offset, sizeof(offset), 1));
+      CeedCall(CeedFileRead(ceed, file, &num_values, sizeof(num_values), 1));
+      CeedCall(CeedQFunctionContextGetFieldLabel(ctx, label_name, &label));
+      if (!label) {
+        switch (type) {
+          case CEED_CONTEXT_FIELD_DOUBLE:
+            CeedCall(CeedQFunctionContextRegisterDouble(ctx, label_name, offset, num_values, description));
+            break;
+          case CEED_CONTEXT_FIELD_INT32:
+            CeedCall(CeedQFunctionContextRegisterInt32(ctx, label_name, offset, num_values, description));
+            break;
+          case CEED_CONTEXT_FIELD_BOOL:
+            CeedCall(CeedQFunctionContextRegisterBoolean(ctx, label_name, offset, num_values, description));
+            break;
+        }
+      }
+      CeedCall(CeedFree(&label_name));
+      CeedCall(CeedFree(&description));
+    }
+    CeedCall(CeedQFunctionContextDestroy(&ctx));
+    CeedCall(CeedQFunctionSetContextWritable(*qf, is_context_writable));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write a `CeedElemRestriction` to an operator file
+
+  @param[in] rstr `CeedElemRestriction` to write
+  @param[in] objs Objects written to the file, for the index of the restriction an unsigned or unoriented copy was made from
+  @param[in] file File to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionWriteToFile(CeedElemRestriction rstr, CeedOperatorFileObjects *objs, FILE *file) {
+  Ceed                ceed      = CeedElemRestrictionReturnCeed(rstr);
+  const int64_t       l_size    = rstr->l_size;
+  CeedInt             copy_type = 0, block_size;
+  CeedRestrictionType rstr_type;
+
+  // Unsigned and unoriented copies
+  if (rstr->rstr_base) {
+    const CeedInt base_index = CeedFileObjectsIndex(objs->num_rstr, objs->rstrs, rstr->rstr_base);
+
+    copy_type = rstr->Apply == rstr->rstr_base->ApplyUnsigned ? 1 : 2;
+    CeedCall(CeedFileWrite(ceed, file, &copy_type, sizeof(CeedInt), 1));
+    CeedCall(CeedFileWrite(ceed, file, &base_index, sizeof(CeedInt), 1));
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCall(CeedFileWrite(ceed, file, &copy_type, sizeof(CeedInt), 1));
+
+  CeedCall(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+  CeedCheck(block_size == 1 || rstr_type == CEED_RESTRICTION_STRUCTURED, ceed, CEED_ERROR_UNSUPPORTED,
+            "Saving blocked CeedElemRestriction is not supported");
+  CeedCheck(rstr_type != CEED_RESTRICTION_POINTS, ceed, CEED_ERROR_UNSUPPORTED, "Saving points CeedElemRestriction is not supported");
+  CeedCall(CeedFileWrite(ceed, file, &rstr_type, sizeof(CeedRestrictionType), 1));
+  CeedCall(CeedFileWrite(ceed, file, &rstr->num_elem, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &rstr->elem_size, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &rstr->num_comp, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &rstr->comp_stride, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &l_size, sizeof(l_size), 1));
+  switch (rstr_type) {
+    case CEED_RESTRICTION_STANDARD:
+    case CEED_RESTRICTION_ORIENTED:
+    case CEED_RESTRICTION_CURL_ORIENTED: {
+      const CeedSize num_offsets = (CeedSize)rstr->num_elem * rstr->elem_size;
+      const CeedInt *offsets;
+
+      CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+      CeedCall(CeedFileWrite(ceed, file, offsets, sizeof(CeedInt), num_offsets));
+      CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+      if (rstr_type == CEED_RESTRICTION_ORIENTED) {
+        const bool *orients;
+
+        CeedCall(CeedElemRestrictionGetOrientations(rstr, CEED_MEM_HOST, &orients));
+        CeedCall(CeedFileWrite(ceed, file, orients, sizeof(bool), num_offsets));
+        CeedCall(CeedElemRestrictionRestoreOrientations(rstr, &orients));
+      } else if (rstr_type == CEED_RESTRICTION_CURL_ORIENTED) {
+        const CeedInt8 *curl_orients;
+
+        CeedCall(CeedElemRestrictionGetCurlOrientations(rstr, CEED_MEM_HOST, &curl_orients));
+        CeedCall(CeedFileWrite(ceed, file, curl_orients, sizeof(CeedInt8), 3 * num_offsets));
+        CeedCall(CeedElemRestrictionRestoreCurlOrientations(rstr, &curl_orients));
+      }
+    } break;
+    case CEED_RESTRICTION_STRIDED: {
+      bool    has_backend_strides;
+      CeedInt strides[3] = {0, 0, 0};
+
+      CeedCall(CeedElemRestrictionHasBackendStrides(rstr, &has_backend_strides));
+      if (!has_backend_strides) CeedCall(CeedElemRestrictionGetStrides(rstr, strides));
+      CeedCall(CeedFileWrite(ceed, file, &has_backend_strides, sizeof(bool), 1));
+      CeedCall(CeedFileWrite(ceed, file, strides, sizeof(CeedInt), 3));
+    } break;
+    case CEED_RESTRICTION_STRUCTURED: {
+      bool    is_periodic[3];
+      CeedInt dim, num_elem_1d[3], P_1d, node_stride;
+
+      CeedCall(CeedElemRestrictionGetStructure(rstr, &dim, num_elem_1d, &P_1d, is_periodic, &node_stride));
+      CeedCall(CeedFileWrite(ceed, file, &dim, sizeof(CeedInt), 1));
+      CeedCall(CeedFileWrite(ceed, file, num_elem_1d, sizeof(CeedInt), 3));
+      CeedCall(CeedFileWrite(ceed, file, &P_1d, sizeof(CeedInt), 1));
+      CeedCall(CeedFileWrite(ceed, file, is_periodic, sizeof(bool), 3));
+      CeedCall(CeedFileWrite(ceed, file, &node_stride, sizeof(CeedInt), 1));
+    } break;
+    case CEED_RESTRICTION_POINTS:
+      break;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read a `CeedElemRestriction` from an operator file
+
+  @param[in]  ceed   `Ceed` object used to create the `CeedElemRestriction`
+  @param[in]  file   File to read from
+  @param[in]  rstrs  `CeedElemRestriction` already read from the file
+  @param[out] rstr   Address of the variable where the newly created `CeedElemRestriction` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionReadFromFile(Ceed ceed, FILE *file, CeedElemRestriction *rstrs, CeedElemRestriction *rstr) {
+  CeedInt             copy_type, num_elem, elem_size, num_comp, comp_stride;
+  int64_t             l_size;
+  CeedRestrictionType rstr_type;
+
+  // Unsigned and unoriented copies
+  CeedCall(CeedFileRead(ceed, file, &copy_type, sizeof(CeedInt), 1));
+  if (copy_type) {
+    CeedInt base_index;
+
+    CeedCall(CeedFileRead(ceed, file, &base_index, sizeof(CeedInt), 1));
+    if (copy_type == 1) CeedCall(CeedElemRestrictionCreateUnsignedCopy(rstrs[base_index], rstr));
+    else CeedCall(CeedElemRestrictionCreateUnorientedCopy(rstrs[base_index], rstr));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedCall(CeedFileRead(ceed, file, &rstr_type, sizeof(CeedRestrictionType), 1));
+  CeedCall(CeedFileRead(ceed, file, &num_elem, sizeof(CeedInt), 1));
+  CeedCall(CeedFileRead(ceed, file, &elem_size, sizeof(CeedInt), 1));
+  CeedCall(CeedFileRead(ceed, file, &num_comp, sizeof(CeedInt), 1));
+  CeedCall(CeedFileRead(ceed, file, &comp_stride, sizeof(CeedInt), 1));
+  CeedCall(CeedFileRead(ceed, file, &l_size, sizeof(l_size), 1));
+  switch (rstr_type) {
+    case CEED_RESTRICTION_STANDARD:
+    case CEED_RESTRICTION_ORIENTED:
+    case CEED_RESTRICTION_CURL_ORIENTED: {
+      const CeedSize num_offsets = (CeedSize)num_elem * elem_size;
+      CeedInt       *offsets;
+
+      CeedCall(CeedMalloc(num_offsets, &offsets));
+      CeedCall(CeedFileRead(ceed, file, offsets, sizeof(CeedInt), num_offsets));
+      if (rstr_type == CEED_RESTRICTION_STANDARD) {
+        CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER, offsets, rstr));
+      } else if (rstr_type == CEED_RESTRICTION_ORIENTED) {
+        bool *orients;
+
+        CeedCall(CeedMalloc(num_offsets, &orients));
+        CeedCall(CeedFileRead(ceed, file, orients, sizeof(bool), num_offsets));
+        CeedCall(CeedElemRestrictionCreateOriented(ceed, num_elem, elem_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER, offsets,
+                                                   orients, rstr));
+      } else {
+        CeedInt8 *curl_orients;
+
+        CeedCall(CeedMalloc(3 * num_offsets, &curl_orients));
+        CeedCall(CeedFileRead(ceed, file, curl_orients, sizeof(CeedInt8), 3 * num_offsets));
+        CeedCall(CeedElemRestrictionCreateCurlOriented(ceed, num_elem, elem_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                                       offsets, curl_orients, rstr));
+      }
+    } break;
+    case CEED_RESTRICTION_STRIDED: {
+      bool    has_backend_strides;
+      CeedInt strides[3];
+
+      CeedCall(CeedFileRead(ceed, file, &has_backend_strides, sizeof(bool), 1));
+      CeedCall(CeedFileRead(ceed, file, strides, sizeof(CeedInt), 3));
+      CeedCall(CeedElemRestrictionCreateStrided(ceed, num_elem, elem_size, num_comp, l_size, has_backend_strides ? CEED_STRIDES_BACKEND : strides,
+                                                rstr));
+    } break;
+    case CEED_RESTRICTION_STRUCTURED: {
+      bool    is_periodic[3];
+      CeedInt dim, num_elem_1d[3], P_1d, node_stride;
+
+      CeedCall(CeedFileRead(ceed, file, &dim, sizeof(CeedInt), 1));
+      CeedCall(CeedFileRead(ceed, file, num_elem_1d, sizeof(CeedInt), 3));
+      CeedCall(CeedFileRead(ceed, file, &P_1d, sizeof(CeedInt), 1));
+      CeedCall(CeedFileRead(ceed, file, is_periodic, sizeof(bool), 3));
+      CeedCall(CeedFileRead(ceed, file, &node_stride, sizeof(CeedInt), 1));
+      CeedCall(CeedElemRestrictionCreateStructured(ceed, dim, num_elem_1d, P_1d, is_periodic, num_comp, node_stride, comp_stride, l_size, rstr));
+    } break;
+    default:
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_INCOMPATIBLE, "Operator file has an unsupported CeedElemRestriction type");
+      // LCOV_EXCL_STOP
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write a `CeedBasis` to an operator file
+
+  Tensor-product bases are written by their 1D matrices and other bases by their full matrices.
+
+  @param[in] basis `CeedBasis` to write
+  @param[in] file  File to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisWriteToFile(CeedBasis basis, FILE *file) {
+  Ceed ceed = CeedBasisReturnCeed(basis);
+
+  CeedCall(CeedFileWrite(ceed, file, &basis->is_tensor_basis, sizeof(bool), 1));
+  CeedCall(CeedFileWrite(ceed, file, &basis->fe_space, sizeof(CeedFESpace), 1));
+  CeedCall(CeedFileWrite(ceed, file, &basis->topo, sizeof(CeedElemTopology), 1));
+  CeedCall(CeedFileWrite(ceed, file, &basis->dim, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &basis->num_comp, sizeof(CeedInt), 1));
+  if (basis->is_tensor_basis) {
+    const CeedInt P_1d = basis->P_1d, Q_1d = basis->Q_1d;
+
+    CeedCall(CeedFileWrite(ceed, file, &P_1d, sizeof(CeedInt), 1));
+    CeedCall(CeedFileWrite(ceed, file, &Q_1d, sizeof(CeedInt), 1));
+    CeedCall(CeedFileWrite(ceed, file, basis->q_ref_1d, sizeof(CeedScalar), Q_1d));
+    CeedCall(CeedFileWrite(ceed, file, basis->q_weight_1d, sizeof(CeedScalar), Q_1d));
+    CeedCall(CeedFileWrite(ceed, file, basis->interp_1d, sizeof(CeedScalar), Q_1d * P_1d));
+    CeedCall(CeedFileWrite(ceed, file, basis->grad_1d, sizeof(CeedScalar), Q_1d * P_1d));
+    if (basis->fe_space != CEED_FE_SPACE_H1) CeedCall(CeedFileWrite(ceed, file, basis->interp_1d_open, sizeof(CeedScalar), Q_1d * (P_1d - 1)));
+  } else {
+    const CeedInt     P = basis->P, Q = basis->Q;
+    const CeedEvalMode deriv_mode = basis->fe_space == CEED_FE_SPACE_H1 ? CEED_EVAL_GRAD
+                                    : basis->fe_space == CEED_FE_SPACE_HDIV ? CEED_EVAL_DIV
+                                                                            : CEED_EVAL_CURL;
+    CeedInt            q_comp_interp, q_comp_deriv;
+    const CeedScalar  *q_ref, *q_weight, *interp, *deriv;
+
+    CeedCall(CeedBasisGetNumQuadratureComponents(basis, CEED_EVAL_INTERP, &q_comp_interp));
+    CeedCall(CeedBasisGetNumQuadratureComponents(basis, deriv_mode, &q_comp_deriv));
+    CeedCall(CeedBasisGetQRef(basis, &q_ref));
+    CeedCall(CeedBasisGetQWeights(basis, &q_weight));
+    CeedCall(CeedBasisGetInterp(basis, &interp));
+    if (deriv_mode == CEED_EVAL_GRAD) CeedCall(CeedBasisGetGrad(basis, &deriv));
+    else if (deriv_mode == CEED_EVAL_DIV) CeedCall(CeedBasisGetDiv(basis, &deriv));
+    else CeedCall(CeedBasisGetCurl(basis, &deriv));
+    CeedCall(CeedFileWrite(ceed, file, &P, sizeof(CeedInt), 1));
+    CeedCall(CeedFileWrite(ceed, file, &Q, sizeof(CeedInt), 1));
+    CeedCall(CeedFileWrite(ceed, file, q_ref, sizeof(CeedScalar), basis->dim * Q));
+    CeedCall(CeedFileWrite(ceed, file, q_weight, sizeof(CeedScalar), Q));
+    CeedCall(CeedFileWrite(ceed, file, interp, sizeof(CeedScalar), q_comp_interp * Q * P));
+    CeedCall(CeedFileWrite(ceed, file, deriv, sizeof(CeedScalar), q_comp_deriv * Q * P));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read a `CeedBasis` from an operator file
+
+  @param[in]  ceed  `Ceed` object used to create the `CeedBasis`
+  @param[in]  file  File to read from
+  @param[out] basis Address of the variable where the newly created `CeedBasis` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisReadFromFile(Ceed ceed, FILE *file, CeedBasis *basis) {
+  bool             is_tensor;
+  CeedInt          dim, num_comp, P, Q, num_matrix_entries;
+  CeedFESpace      fe_space;
+  CeedElemTopology topo;
+  CeedScalar      *q_ref, *q_weight, *interp, *deriv, *interp_open = NULL;
+
+  CeedCall(CeedFileRead(ceed, file, &is_tensor, sizeof(bool), 1));
+  CeedCall(CeedFileRead(ceed, file, &fe_space, sizeof(CeedFESpace), 1));
+  CeedCall(CeedFileRead(ceed, file, &topo, sizeof(CeedElemTopology), 1));
+  CeedCall(CeedFileRead(ceed, file, &dim, sizeof(CeedInt), 1));
+  CeedCall(CeedFileRead(ceed, file, &num_comp, sizeof(CeedInt), 1));
+  CeedCall(CeedFileRead(ceed, file, &P, sizeof(CeedInt), 1));
+  CeedCall(CeedFileRead(ceed, file, &Q, sizeof(CeedInt), 1));
+  if (is_tensor) {
+    CeedCall(CeedCalloc(Q, &q_ref));
+    CeedCall(CeedCalloc(Q, &q_weight));
+    CeedCall(CeedCalloc(Q * P, &interp));
+    CeedCall(CeedCalloc(Q * P, &deriv));
+    CeedCall(CeedFileRead(ceed, file, q_ref, sizeof(CeedScalar), Q));
+    CeedCall(CeedFileRead(ceed, file, q_weight, sizeof(CeedScalar), Q));
+    CeedCall(CeedFileRead(ceed, file, interp, sizeof(CeedScalar), Q * P));
+    CeedCall(CeedFileRead(ceed, file, deriv, sizeof(CeedScalar), Q * P));
+    if (fe_space == CEED_FE_SPACE_H1) {
+      CeedCall(CeedBasisCreateTensorH1(ceed, dim, num_comp, P, Q, interp, deriv, q_ref, q_weight, basis));
+    } else {
+      CeedCall(CeedCalloc(Q * (P - 1), &interp_open));
+      CeedCall(CeedFileRead(ceed, file, interp_open, sizeof(CeedScalar), Q * (P - 1)));
+      if (fe_space == CEED_FE_SPACE_HDIV) {
+        CeedCall(CeedBasisCreateTensorHdiv(ceed, dim, num_comp, P, Q, interp, deriv, interp_open, q_ref, q_weight, basis));
+      } else {
+        CeedCall(CeedBasisCreateTensorHcurl(ceed, dim, num_comp, P, Q, interp, deriv, interp_open, q_ref, q_weight, basis));
+      }
+    }
+  } else {
+    const CeedInt q_comp_interp = fe_space == CEED_FE_SPACE_H1 ? 1 : dim;
+    const CeedInt q_comp_deriv  = fe_space == CEED_FE_SPACE_H1 ? dim : fe_space == CEED_FE_SPACE_HDIV ? 1 : (dim < 3 ? 1 : dim);
+
+    num_matrix_entries = Q * P;
+    CeedCall(CeedCalloc(dim * Q, &q_ref));
+    CeedCall(CeedCalloc(Q, &q_weight));
+    CeedCall(CeedCalloc(q_comp_interp * num_matrix_entries, &interp));
+    CeedCall(CeedCalloc(q_comp_deriv * num_matrix_entries, &deriv));
+    CeedCall(CeedFileRead(ceed, file, q_ref, sizeof(CeedScalar), dim * Q));
+    CeedCall(CeedFileRead(ceed, file, q_weight, sizeof(CeedScalar), Q));
+    CeedCall(CeedFileRead(ceed, file, interp, sizeof(CeedScalar), q_comp_interp * num_matrix_entries));
+    CeedCall(CeedFileRead(ceed, file, deriv, sizeof(CeedScalar), q_comp_deriv * num_matrix_entries));
+    if (fe_space == CEED_FE_SPACE_H1) CeedCall(CeedBasisCreateH1(ceed, topo, num_comp, P, Q, interp, deriv, q_ref, q_weight, basis));
+    else if (fe_space == CEED_FE_SPACE_HDIV) CeedCall(CeedBasisCreateHdiv(ceed, topo, num_comp, P, Q, interp, deriv, q_ref, q_weight, basis));
+    else CeedCall(CeedBasisCreateHcurl(ceed, topo, num_comp, P, Q, interp, deriv, q_ref, q_weight, basis));
+  }
+  CeedCall(CeedFree(&q_ref));
+  CeedCall(CeedFree(&q_weight));
+  CeedCall(CeedFree(&interp));
+  CeedCall(CeedFree(&deriv));
+  CeedCall(CeedFree(&interp_open));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write a `CeedVector` to an operator file.
+
+  The vector entries start at a multiple of @ref CEED_ALIGN bytes from the start of the file.
+
+  @param[in] vec  `CeedVector` to write
+  @param[in] file File to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedVectorWriteToFile(CeedVector vec, FILE *file) {
+  Ceed     ceed = CeedVectorReturnCeed(vec);
+  bool     has_valid_array;
+  CeedSize length;
+  int64_t  file_length;
+
+  CeedCall(CeedVectorGetLength(vec, &length));
+  CeedCall(CeedVectorHasValidArray(vec, &has_valid_array));
+  file_length = length;
+  CeedCall(CeedFileWrite(ceed, file, &file_length, sizeof(file_length), 1));
+  CeedCall(CeedFileWrite(ceed, file, &has_valid_array, sizeof(bool), 1));
+  if (has_valid_array) {
+    const CeedScalar *array;
+
+    CeedCall(CeedFileWritePadding(ceed, file));
+    CeedCall(CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array));
+    CeedCall(CeedFileWrite(ceed, file, array, sizeof(CeedScalar), length));
+    CeedCall(CeedVectorRestoreArrayRead(vec, &array));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read a `CeedVector` from an operator file.
+
+  The vector entries are mapped from the file, see @ref CeedVectorCreateFromFile().
+
+  @param[in]  ceed      `Ceed` object used to create the `CeedVector`
+  @param[in]  file      File to read from
+  @param[in]  file_name Path of the file, for mapping the vector entries
+  @param[out] vec       Address of the variable where the newly created `CeedVector` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedVectorReadFromFile(Ceed ceed, FILE *file, const char *file_name, CeedVector *vec) {
+  bool    has_valid_array;
+  int64_t length;
+
+  CeedCall(CeedFileRead(ceed, file, &length, sizeof(length), 1));
+  CeedCall(CeedFileRead(ceed, file, &has_valid_array, sizeof(bool), 1));
+  if (has_valid_array) {
+    long offset;
+
+    CeedCall(CeedFileSkipPadding(ceed, file, &offset));
+    CeedCall(CeedVectorCreateFromFile(ceed, file_name, offset, length, CEED_MAP_READ, CEED_MAP_HINT_NONE, vec));
+    CeedCheck(!fseek(file, offset + length * (long)sizeof(CeedScalar), SEEK_SET), ceed, CEED_ERROR_MAJOR, "Couldn't seek in operator file");
+  } else {
+    CeedCall(CeedVectorCreate(ceed, length, vec));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write a `CeedOperator` and its sub-operators to an operator file
+
+  @param[in] op   `CeedOperator` to write
+  @param[in] objs Objects written to the file, for the indices of the objects referenced by the operator fields
+  @param[in] file File to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorWriteToFile(CeedOperator op, CeedOperatorFileObjects *objs, FILE *file) {
+  Ceed ceed = CeedOperatorReturnCeed(op);
+
+  CeedCall(CeedFileWrite(ceed, file, &op->is_composite, sizeof(bool), 1));
+  CeedCall(CeedFileWriteString(ceed, file, op->name));
+  if (op->is_composite) {
+    CeedCall(CeedFileWrite(ceed, file, &op->num_suboperators, sizeof(CeedInt), 1));
+    CeedCall(CeedFileWrite(ceed, file, &op->num_threads, sizeof(CeedInt), 1));
+    for (CeedInt i = 0; i < op->num_suboperators; i++) CeedCall(CeedOperatorWriteToFile(op->sub_operators[i], objs, file));
+  } else {
+    const CeedInt      num_active_elem = op->active_elems ? op->num_active_elem : -1;
+    const CeedInt      qf_indices[3]   = {CeedFileObjectsIndex(objs->num_qf, objs->qfs, op->qf),
+                                          op->dqf ? CeedFileObjectsIndex(objs->num_qf, objs->qfs, op->dqf) : ceed_operator_file_none,
+                                          op->dqfT ? CeedFileObjectsIndex(objs->num_qf, objs->qfs, op->dqfT) : ceed_operator_file_none};
+    CeedInt            num_fields[2];
+    CeedOperatorField *fields[2];
+
+    CeedCall(CeedFileWrite(ceed, file, qf_indices, sizeof(CeedInt), 3));
+    CeedCall(CeedFileWrite(ceed, file, &op->block_size, sizeof(CeedInt), 1));
+    CeedCall(CeedFileWrite(ceed, file, &num_active_elem, sizeof(CeedInt), 1));
+    if (op->active_elems) CeedCall(CeedFileWrite(ceed, file, op->active_elems, sizeof(CeedInt), num_active_elem));
+    CeedCall(CeedOperatorGetFields(op, &num_fields[0], &fields[0], &num_fields[1], &fields[1]));
+    for (CeedInt j = 0; j < 2; j++) {
+      for (CeedInt i = 0; i < num_fields[j]; i++) {
+        CeedOperatorField field      = fields[j][i];
+        CeedInt           rstr_index = ceed_operator_file_none, basis_index = ceed_operator_file_none, vec_index = ceed_operator_file_none;
+
+        if (field->elem_rstr != CEED_ELEMRESTRICTION_NONE) rstr_index = CeedFileObjectsIndex(objs->num_rstr, objs->rstrs, field->elem_rstr);
+        if (field->basis != CEED_BASIS_NONE) basis_index = CeedFileObjectsIndex(objs->num_basis, objs->bases, field->basis);
+        if (field->vec == CEED_VECTOR_ACTIVE) vec_index = ceed_operator_file_active;
+        else if (field->vec != CEED_VECTOR_NONE) vec_index = CeedFileObjectsIndex(objs->num_vec, objs->vecs, field->vec);
+
+        CeedCall(CeedFileWriteString(ceed, file, field->field_name));
+        CeedCall(CeedFileWrite(ceed, file, &rstr_index, sizeof(CeedInt), 1));
+        CeedCall(CeedFileWrite(ceed, file, &basis_index, sizeof(CeedInt), 1));
+        CeedCall(CeedFileWrite(ceed, file, &vec_index, sizeof(CeedInt), 1));
+        CeedCall(CeedFileWrite(ceed, file, &field->storage_precision, sizeof(CeedScalarType), 1));
+        CeedCall(CeedFileWrite(ceed, file, &field->cache_qpt_values, sizeof(bool), 1));
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read a `CeedOperator` and its sub-operators from an operator file
+
+  @param[in]  ceed   `Ceed` object used to create the `CeedOperator`
+  @param[in]  file   File to read from
+  @param[in]  qfs    `CeedQFunction` read from the file
+  @param[in]  rstrs  `CeedElemRestriction` read from the file
+  @param[in]  bases  `CeedBasis` read from the file
+  @param[in]  vecs   `CeedVector` read from the file
+  @param[out] op     Address of the variable where the newly created `CeedOperator` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorReadFromFile(Ceed ceed, FILE *file, CeedQFunction *qfs, CeedElemRestriction *rstrs, CeedBasis *bases, CeedVector *vecs,
+                                    CeedOperator *op) {
+  bool  is_composite;
+  char *name;
+
+  CeedCall(CeedFileRead(ceed, file, &is_composite, sizeof(bool), 1));
+  CeedCall(CeedFileReadString(ceed, file, &name));
+  if (is_composite) {
+    CeedInt num_sub, num_threads;
+
+    CeedCall(CeedFileRead(ceed, file, &num_sub, sizeof(CeedInt), 1));
+    CeedCall(CeedFileRead(ceed, file, &num_threads, sizeof(CeedInt), 1));
+    CeedCall(CeedCompositeOperatorCreate(ceed, op));
+    for (CeedInt i = 0; i < num_sub; i++) {
+      CeedOperator sub_op;
+
+      CeedCall(CeedOperatorReadFromFile(ceed, file, qfs, rstrs, bases, vecs, &sub_op));
+      CeedCall(CeedCompositeOperatorAddSub(*op, sub_op));
+      CeedCall(CeedOperatorDestroy(&sub_op));
+    }
+    if (num_threads) CeedCall(CeedCompositeOperatorSetNumThreads(*op, num_threads));
+  } else {
+    CeedInt qf_indices[3], block_size, num_active_elem, num_fields[2], *active_elems = NULL;
+
+    CeedCall(CeedFileRead(ceed, file, qf_indices, sizeof(CeedInt), 3));
+    CeedCall(CeedFileRead(ceed, file, &block_size, sizeof(CeedInt), 1));
+    CeedCall(CeedFileRead(ceed, file, &num_active_elem, sizeof(CeedInt), 1));
+    if (num_active_elem >= 0) {
+      CeedCall(CeedMalloc(num_active_elem ? num_active_elem : 1, &active_elems));
+      CeedCall(CeedFileRead(ceed, file, active_elems, sizeof(CeedInt), num_active_elem));
+    }
+    CeedCall(CeedOperatorCreate(ceed, qfs[qf_indices[0]], qf_indices[1] >= 0 ? qfs[qf_indices[1]] : CEED_QFUNCTION_NONE,
+                                qf_indices[2] >= 0 ? qfs[qf_indices[2]] : CEED_QFUNCTION_NONE, op));
+    num_fields[0] = (*op)->qf->num_input_fields;
+    num_fields[1] = (*op)->qf->num_output_fields;
+    for (CeedInt j = 0; j < 2; j++) {
+      for (CeedInt i = 0; i < num_fields[j]; i++) {
+        bool           cache_qpt_values;
+        char          *field_name;
+        CeedInt        rstr_index, basis_index, vec_index;
+        CeedScalarType storage_precision;
+        CeedVector     vec;
+
+        CeedCall(CeedFileReadString(ceed, file, &field_name));
+        CeedCall(CeedFileRead(ceed, file, &rstr_index, sizeof(CeedInt), 1));
+        CeedCall(CeedFileRead(ceed, file, &basis_index, sizeof(CeedInt), 1));
+        CeedCall(CeedFileRead(ceed, file, &vec_index, sizeof(CeedInt), 1));
+        CeedCall(CeedFileRead(ceed, file, &storage_precision, sizeof(CeedScalarType), 1));
+        CeedCall(CeedFileRead(ceed, file, &cache_qpt_values, sizeof(bool), 1));
+        if (vec_index >= 0) vec = vecs[vec_index];
+        else vec = vec_index == ceed_operator_file_active ? CEED_VECTOR_ACTIVE : CEED_VECTOR_NONE;
+        CeedCall(CeedOperatorSetField(*op, field_name, rstr_index >= 0 ? rstrs[rstr_index] : CEED_ELEMRESTRICTION_NONE,
+                                      basis_index >= 0 ? bases[basis_index] : CEED_BASIS_NONE, vec));
+        if (storage_precision != CEED_SCALAR_TYPE) CeedCall(CeedOperatorSetFieldStoragePrecision(*op, field_name, storage_precision));
+        if (cache_qpt_values) CeedCall(CeedOperatorSetFieldCacheQuadratureValues(*op, field_name, true));
+        CeedCall(CeedFree(&field_name));
+      }
+    }
+    if (block_size) CeedCall(CeedOperatorSetBlockSize(*op, block_size));
+    if (active_elems) CeedCall(CeedOperatorSetActiveElements(*op, num_active_elem, active_elems));
+    CeedCall(CeedFree(&active_elems));
+  }
+  if (name) CeedCall(CeedOperatorSetName(*op, name));
+  CeedCall(CeedFree(&name));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write a `CeedOperator` and all objects it references to an open operator file
+
+  @param[in] op   `CeedOperator` to write
+  @param[in] objs Distinct objects referenced by `op`
+  @param[in] file File to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSaveToFile(CeedOperator op, CeedOperatorFileObjects *objs, FILE *file) {
+  Ceed          ceed        = CeedOperatorReturnCeed(op);
+  const CeedInt scalar_type = CEED_SCALAR_TYPE;
+
+  // Header
+  CeedCall(CeedFileWrite(ceed, file, ceed_operator_file_magic, sizeof(char), sizeof(ceed_operator_file_magic)));
+  CeedCall(CeedFileWrite(ceed, file, &ceed_operator_file_version, sizeof(uint32_t), 1));
+  CeedCall(CeedFileWrite(ceed, file, &ceed_operator_file_endian, sizeof(uint32_t), 1));
+  CeedCall(CeedFileWrite(ceed, file, &scalar_type, sizeof(CeedInt), 1));
+
+  // Objects, in dependency order
+  CeedCall(CeedFileWrite(ceed, file, &objs->num_qf, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &objs->num_rstr, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &objs->num_basis, sizeof(CeedInt), 1));
+  CeedCall(CeedFileWrite(ceed, file, &objs->num_vec, sizeof(CeedInt), 1));
+  for (CeedInt i = 0; i < objs->num_qf; i++) CeedCall(CeedQFunctionWriteToFile((CeedQFunction)objs->qfs[i], file));
+  for (CeedInt i = 0; i < objs->num_rstr; i++) CeedCall(CeedElemRestrictionWriteToFile((CeedElemRestriction)objs->rstrs[i], objs, file));
+  for (CeedInt i = 0; i < objs->num_basis; i++) CeedCall(CeedBasisWriteToFile((CeedBasis)objs->bases[i], file));
+  for (CeedInt i = 0; i < objs->num_vec; i++) CeedCall(CeedVectorWriteToFile((CeedVector)objs->vecs[i], file));
+
+  // Operator tree
+  CeedCall(CeedOperatorWriteToFile(op, objs, file));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read a `CeedOperator` and all objects it references from an open operator file
+
+  @param[in]  ceed      `Ceed` object used to create the `CeedOperator`
+  @param[in]  file      File to read from
+  @param[in]  file_name Path of the file, for mapping passive `CeedVector`
+  @param[in]  num_qf    Number of user `CeedQFunction` in `qfs`
+  @param[in]  qfs       User `CeedQFunction` providing the user functions
+  @param[out] op        Address of the variable where the newly created `CeedOperator` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorLoadFromFile(Ceed ceed, FILE *file, const char *file_name, CeedInt num_qf, CeedQFunction *qfs, CeedOperator *op) {
+  char                 magic[sizeof(ceed_operator_file_magic)];
+  uint32_t             version, endian;
+  CeedInt              scalar_type, num_objs[4];
+  CeedQFunction       *file_qfs;
+  CeedElemRestriction *file_rstrs;
+  CeedBasis           *file_bases;
+  CeedVector          *file_vecs;
+
+  // Header
+  CeedCall(CeedFileRead(ceed, file, magic, sizeof(char), sizeof(magic)));
+  CeedCheck(!memcmp(magic, ceed_operator_file_magic, sizeof(magic)), ceed, CEED_ERROR_INCOMPATIBLE, "File is not a libCEED operator file");
+  CeedCall(CeedFileRead(ceed, file, &version, sizeof(uint32_t), 1));
+  CeedCall(CeedFileRead(ceed, file, &endian, sizeof(uint32_t), 1));
+  CeedCall(CeedFileRead(ceed, file, &scalar_type, sizeof(CeedInt), 1));
+  CeedCheck(version <= ceed_operator_file_version, ceed, CEED_ERROR_INCOMPATIBLE, "Operator file version %u is newer than supported version %u",
+            version, ceed_operator_file_version);
+  CeedCheck(endian == ceed_operator_file_endian, ceed, CEED_ERROR_INCOMPATIBLE, "Operator file was written with a different byte order");
+  CeedCheck(scalar_type == CEED_SCALAR_TYPE, ceed, CEED_ERROR_INCOMPATIBLE, "Operator file was written with a different CeedScalar type");
+
+  // Objects
+  CeedCall(CeedFileRead(ceed, file, num_objs, sizeof(CeedInt), 4));
+  CeedCall(CeedCalloc(num_objs[0], &file_qfs));
+  CeedCall(CeedCalloc(num_objs[1], &file_rstrs));
+  CeedCall(CeedCalloc(num_objs[2], &file_bases));
+  CeedCall(CeedCalloc(num_objs[3], &file_vecs));
+  for (CeedInt i = 0; i < num_objs[0]; i++) CeedCall(CeedQFunctionReadFromFile(ceed, file, num_qf, qfs, &file_qfs[i]));
+  for (CeedInt i = 0; i < num_objs[1]; i++) CeedCall(CeedElemRestrictionReadFromFile(ceed, file, file_rstrs, &file_rstrs[i]));
+  for (CeedInt i = 0; i < num_objs[2]; i++) CeedCall(CeedBasisReadFromFile(ceed, file, &file_bases[i]));
+  for (CeedInt i = 0; i < num_objs[3]; i++) CeedCall(CeedVectorReadFromFile(ceed, file, file_name, &file_vecs[i]));
+
+  // Operator tree
+  CeedCall(CeedOperatorReadFromFile(ceed, file, file_qfs, file_rstrs, file_bases, file_vecs, op));
+
+  // The operator holds references to all objects it uses
+  for (CeedInt i = 0; i < num_objs[0]; i++) CeedCall(CeedQFunctionDestroy(&file_qfs[i]));
+  for (CeedInt i = 0; i < num_objs[1]; i++) CeedCall(CeedElemRestrictionDestroy(&file_rstrs[i]));
+  for (CeedInt i = 0; i < num_objs[2]; i++) CeedCall(CeedBasisDestroy(&file_bases[i]));
+  for (CeedInt i = 0; i < num_objs[3]; i++) CeedCall(CeedVectorDestroy(&file_vecs[i]));
+  CeedCall(CeedFree(&file_qfs));
+  CeedCall(CeedFree(&file_rstrs));
+  CeedCall(CeedFree(&file_bases));
+  CeedCall(CeedFree(&file_vecs));
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// CeedOperator Public API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedOperatorUser
+/// @{
+
+/**
+  @brief Save a `CeedOperator` to a binary file, to be recreated with @ref CeedOperatorLoad().
+
+  The file holds the operator and its sub-operators, the `CeedElemRestriction`, `CeedBasis`, and passive `CeedVector`, such as quadrature data, of all fields, and the `CeedQFunction` with their context data.
+  Objects shared between fields or sub-operators are stored once.
+  Gallery `CeedQFunction` are stored by name and user `CeedQFunction` by kernel name; user functions are provided again when loading.
+  Context data is copied byte for byte, so contexts must not hold pointers.
+  The entries of each passive `CeedVector` start at a multiple of @ref CEED_ALIGN bytes from the start of the file.
+
+  Operators at points, operators with Fortran `CeedQFunction`, and operators using blocked `CeedElemRestriction` are not supported.
+
+  @param[in] op        `CeedOperator` to save
+  @param[in] file_name Path of the file to write
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSave(CeedOperator op, const char *file_name) {
+  int                     ierr;
+  FILE                   *file;
+  CeedOperatorFileObjects objs = {0};
+
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorFileObjectsCollect(op, &objs));
+  file = fopen(file_name, "wb");
+  CeedCheck(file, CeedOperatorReturnCeed(op), CEED_ERROR_MAJOR, "Couldn't open operator file for writing: %s", file_name);
+  ierr = CeedOperatorSaveToFile(op, &objs, file);
+  CeedCall(CeedFree(&objs.qfs));
+  CeedCall(CeedFree(&objs.rstrs));
+  CeedCall(CeedFree(&objs.bases));
+  CeedCall(CeedFree(&objs.vecs));
+  CeedCheck(!fclose(file) || ierr, CeedOperatorReturnCeed(op), CEED_ERROR_MAJOR, "Couldn't write operator file: %s", file_name);
+  return ierr;
+}
+
+/**
+  @brief Create a `CeedOperator` from a file written by @ref CeedOperatorSave().
+
+  Gallery `CeedQFunction` are recreated by name.
+  For each user `CeedQFunction` in the file, `qfs` must contain a `CeedQFunction` with the same kernel name, which provides the user function and source; fields and context data are restored from the file.
+  Passive `CeedVector` are mapped from the file with @ref CEED_MAP_READ rather than copied, so their entries are shared through the page cache and only read when used.
+  The file must have been written with the same `CeedScalar` type and byte order.
+
+  @param[in]  ceed      `Ceed` object used to create the `CeedOperator`
+  @param[in]  file_name Path of the file to read
+  @param[in]  num_qf    Number of user `CeedQFunction` in `qfs`
+  @param[in]  qfs       Array of user `CeedQFunction` providing the user functions, or `NULL` if the operator only uses gallery `CeedQFunction`
+  @param[out] op        Address of the variable where the newly created `CeedOperator` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorLoad(Ceed ceed, const char *file_name, CeedInt num_qf, CeedQFunction *qfs, CeedOperator *op) {
+  int   ierr;
+  FILE *file;
+
+  file = fopen(file_name, "rb");
+  CeedCheck(file, ceed, CEED_ERROR_MAJOR, "Couldn't open operator file for reading: %s", file_name);
+  ierr = CeedOperatorLoadFromFile(ceed, file, file_name, num_qf, qfs, op);
+  fclose(file);
+  return ierr;
+}
+
+/// @}
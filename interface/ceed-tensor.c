@@ -8,6 +8,7 @@
 #include <ceed-impl.h>
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <math.h>
 #include <stddef.h>
 
 /// @file
@@ -83,6 +84,8 @@ int CeedTensorContractApply(CeedTensorContract contract, CeedInt A, CeedInt B, C
   TRANSPOSE:   `v_ajc  = t_dbj u_dabc`
   If `add != 0`, `=` is replaced by `+=`
 
+  Backends may provide a `StridedApply` implementation to batch the contractions over `D`; otherwise this loops over `D` and calls @ref CeedTensorContractApply().
+
   @param[in]  contract `CeedTensorContract` to use
   @param[in]  A        First index of `u`, second index of `v`
   @param[in]  B        Middle index of `u`, one of last two indices of `t`
@@ -101,6 +104,10 @@ int CeedTensorContractApply(CeedTensorContract contract, CeedInt A, CeedInt B, C
 **/
 int CeedTensorContractStridedApply(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt D, CeedInt J, const CeedScalar *restrict t,
                                    CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  if (contract->StridedApply) {
+    CeedCall(contract->StridedApply(contract, A, B, C, D, J, t, t_mode, add, u, v));
+    return CEED_ERROR_SUCCESS;
+  }
   if (t_mode == CEED_TRANSPOSE) {
     for (CeedInt d = 0; d < D; d++) {
       CeedCall(contract->Apply(contract, A, J, C, B, t + d * B * J, t_mode, add, u + d * A * J * C, v));
@@ -113,6 +120,89 @@ int CeedTensorContractStridedApply(CeedTensorContract contract, CeedInt A, CeedI
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Factor a 1D contraction matrix with even-odd symmetry
+
+  Symmetric node and quadrature sets, such as Gauss and Gauss-Lobatto points, give interpolation matrices with `t_jb = t_(J-1-j)(B-1-b)` and derivative matrices with `t_jb = -t_(J-1-j)(B-1-b)`.
+  Such matrices are stored as the first `ceil(J/2)` rows of the even part, in the first `ceil(B/2)` columns, and the odd part, in the remaining `floor(B/2)` columns.
+  @ref CeedTensorContractApplyEvenOdd() then needs half of the multiplications of @ref CeedTensorContractApply().
+
+  Backends that do not implement `ApplyEvenOdd`, such as those with dense matrix kernels that are faster than the even-odd loops, always report `parity` as `0`.
+
+  @param[in]  contract   `CeedTensorContract` to use
+  @param[in]  J          Number of rows of `t`
+  @param[in]  B          Number of columns of `t`
+  @param[in]  t          Row-major matrix to factor
+  @param[out] parity     `1` for symmetric, `-1` for antisymmetric, or `0` if `t` has neither symmetry or the backend has no even-odd kernel
+  @param[out] t_even_odd Array of size `ceil(J/2) * B` to store the factored matrix, unchanged if `parity` is `0`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractGetEvenOdd(CeedTensorContract contract, CeedInt J, CeedInt B, const CeedScalar *t, CeedInt *parity, CeedScalar *t_even_odd) {
+  const CeedInt half_J = (J + 1) / 2, half_B = (B + 1) / 2;
+  CeedScalar    max_t = 0.0, max_sym = 0.0, max_anti = 0.0;
+
+  *parity = 0;
+  if (!contract->ApplyEvenOdd) return CEED_ERROR_SUCCESS;
+
+  // Detect symmetry
+  for (CeedInt j = 0; j < J; j++) {
+    for (CeedInt b = 0; b < B; b++) {
+      const CeedScalar t_jb = t[j * B + b], t_flip = t[(J - 1 - j) * B + (B - 1 - b)];
+
+      max_t    = fmax(max_t, fabs(t_jb));
+      max_sym  = fmax(max_sym, fabs(t_jb - t_flip));
+      max_anti = fmax(max_anti, fabs(t_jb + t_flip));
+    }
+  }
+  if (max_sym <= 100 * CEED_EPSILON * max_t) *parity = 1;
+  else if (max_anti <= 100 * CEED_EPSILON * max_t) *parity = -1;
+  if (*parity == 0) return CEED_ERROR_SUCCESS;
+
+  // Even and odd parts
+  for (CeedInt j = 0; j < half_J; j++) {
+    for (CeedInt b = 0; b < B / 2; b++) {
+      t_even_odd[j * B + b]          = (t[j * B + b] + t[j * B + B - 1 - b]) / 2;
+      t_even_odd[j * B + half_B + b] = (t[j * B + b] - t[j * B + B - 1 - b]) / 2;
+    }
+    if (B % 2) t_even_odd[j * B + B / 2] = t[j * B + B / 2];
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply tensor contraction with a matrix factored by @ref CeedTensorContractGetEvenOdd()
+
+  Computes the same result as @ref CeedTensorContractApply() with the original matrix.
+  Pairs of inputs are folded into even and odd parts, which are contracted with the even and odd parts of the matrix and unfolded into pairs of outputs.
+
+  @param[in]  contract   `CeedTensorContract` to use
+  @param[in]  A          First index of `u`, `v`
+  @param[in]  B          Middle index of `u`, one index of `t`
+  @param[in]  C          Last index of `u`, `v`
+  @param[in]  J          Middle index of `v`, one index of `t`
+  @param[in]  t_even_odd Factored tensor array to contract against
+  @param[in]  parity     Parity of the original matrix, `1` or `-1`
+  @param[in]  t_mode     Transpose mode for `t`, @ref CEED_NOTRANSPOSE for `t_jb` @ref CEED_TRANSPOSE for `t_bj`
+  @param[in]  add        Add mode
+  @param[in]  u          Input array
+  @param[out] v          Output array
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractApplyEvenOdd(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t_even_odd,
+                                   CeedInt parity, CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u,
+                                   CeedScalar *restrict v) {
+  CeedCheck(contract->ApplyEvenOdd, CeedTensorContractReturnCeed(contract), CEED_ERROR_UNSUPPORTED,
+            "Backend does not implement CeedTensorContractApplyEvenOdd");
+  CeedCall(contract->ApplyEvenOdd(contract, A, B, C, J, t_even_odd, parity, t_mode, add, u, v));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the `Ceed` associated with a `CeedTensorContract`
 
@@ -180,7 +270,7 @@ int CeedTensorContractSetData(CeedTensorContract contract, void *data) {
   @ref Backend
 **/
 int CeedTensorContractReference(CeedTensorContract contract) {
-  contract->ref_count++;
+  CeedAtomicIncrement(contract->ref_count);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -216,7 +306,7 @@ int CeedTensorContractReferenceCopy(CeedTensorContract tensor, CeedTensorContrac
   @ref Backend
 **/
 int CeedTensorContractDestroy(CeedTensorContract *contract) {
-  if (!*contract || --(*contract)->ref_count > 0) {
+  if (!*contract || CeedAtomicDecrement((*contract)->ref_count) > 0) {
     *contract = NULL;
     return CEED_ERROR_SUCCESS;
   }
@@ -5,14 +5,19 @@
 //
 // This file is part of CEED:  http://github.com/ceed
 
+#define _POSIX_C_SOURCE 200112L
 #include <ceed-impl.h>
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <assert.h>
+#include <fcntl.h>
 #include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /// @file
 /// Implementation of public CeedVector interfaces
@@ -135,7 +140,7 @@ int CeedVectorSetData(CeedVector vec, void *data) {
   @ref Backend
 **/
 int CeedVectorReference(CeedVector vec) {
-  vec->ref_count++;
+  CeedAtomicIncrement(vec->ref_count);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -178,6 +183,85 @@ int CeedVectorCreate(Ceed ceed, CeedSize length, CeedVector *vec) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a `CeedVector` backed by a memory-mapped file
+
+  The `CeedVector` borrows the mapped file range as its host array, as with @ref CeedVectorSetArray() and @ref CEED_USE_POINTER, so @ref CeedVectorGetArrayRead() on the host returns the mapped entries without copying.
+  Processes mapping the same file share its pages through the page cache until they modify them.
+  With @ref CEED_MAP_READ, modified entries are private to the process; with @ref CEED_MAP_READ_WRITE, the operating system writes modified pages back to the file, at the latest when the `CeedVector` is destroyed.
+  The file is unmapped when the `CeedVector` is destroyed.
+  If a different array is later set with @ref CeedVectorSetArray(), the mapping is kept until the `CeedVector` is destroyed.
+
+  @param[in]  ceed      `Ceed` object used to create the `CeedVector`
+  @param[in]  file_name Path of the file to map
+  @param[in]  offset    Offset in bytes of the first vector entry in the file, must be a multiple of `sizeof(CeedScalar)`
+  @param[in]  length    Length of vector
+  @param[in]  map_mode  Whether modified entries are written back to the file, see @ref CeedMapMode
+  @param[in]  hints     Bitwise or of @ref CeedMapHint values
+  @param[out] vec       Address of the variable where the newly created `CeedVector` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorCreateFromFile(Ceed ceed, const char *file_name, size_t offset, CeedSize length, CeedMapMode map_mode, int hints, CeedVector *vec) {
+  int         fd;
+  const long  page_size = sysconf(_SC_PAGESIZE);
+  size_t      map_offset, map_size;
+  struct stat file_stat;
+  void       *map;
+
+  CeedCheck(length >= 0, ceed, CEED_ERROR_DIMENSION, "CeedVector length must be non-negative");
+  CeedCheck(offset % sizeof(CeedScalar) == 0, ceed, CEED_ERROR_DIMENSION, "File offset must be a multiple of the CeedScalar size");
+  CeedCall(CeedVectorCreate(ceed, length, vec));
+  if (length == 0) return CEED_ERROR_SUCCESS;
+
+  // Map from the page containing the first entry, the CeedVector is destroyed on failure
+  fd = open(file_name, map_mode == CEED_MAP_READ_WRITE ? O_RDWR : O_RDONLY);
+  if (fd < 0) {
+    // LCOV_EXCL_START
+    CeedCall(CeedVectorDestroy(vec));
+    return CeedError(ceed, CEED_ERROR_MAJOR, "Couldn't open file for mapping: %s", file_name);
+    // LCOV_EXCL_STOP
+  }
+  map_offset = offset - offset % page_size;
+  map_size   = offset - map_offset + (size_t)length * sizeof(CeedScalar);
+  if (fstat(fd, &file_stat) || (size_t)file_stat.st_size < offset + (size_t)length * sizeof(CeedScalar)) {
+    // LCOV_EXCL_START
+    close(fd);
+    CeedCall(CeedVectorDestroy(vec));
+    return CeedError(ceed, CEED_ERROR_DIMENSION, "File %s is too small for %" CeedSize_FMT " entries at offset %zu", file_name, length, offset);
+    // LCOV_EXCL_STOP
+  }
+  map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, map_mode == CEED_MAP_READ_WRITE ? MAP_SHARED : MAP_PRIVATE, fd, map_offset);
+  close(fd);
+  if (map == MAP_FAILED) {
+    // LCOV_EXCL_START
+    CeedCall(CeedVectorDestroy(vec));
+    return CeedError(ceed, CEED_ERROR_MAJOR, "Couldn't map file: %s", file_name);
+    // LCOV_EXCL_STOP
+  }
+#ifdef MADV_HUGEPAGE
+  if (hints & CEED_MAP_HINT_HUGE_PAGES) madvise(map, map_size, MADV_HUGEPAGE);
+#endif
+  if (hints & CEED_MAP_HINT_PREFETCH) posix_madvise(map, map_size, POSIX_MADV_WILLNEED);
+
+  // The CeedVector owns the mapping from here on, so destroying it unmaps the file
+  (*vec)->mapped_file      = map;
+  (*vec)->mapped_file_size = map_size;
+  {
+    int ierr = CeedVectorSetArray(*vec, CEED_MEM_HOST, CEED_USE_POINTER, (CeedScalar *)((char *)map + offset - map_offset));
+
+    if (ierr != CEED_ERROR_SUCCESS) {
+      // LCOV_EXCL_START
+      CeedCall(CeedVectorDestroy(vec));
+      return ierr;
+      // LCOV_EXCL_STOP
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Copy the pointer to a `CeedVector`.
 
@@ -544,7 +628,7 @@ int CeedVectorGetArrayRead(CeedVector vec, CeedMemType mem_type, const CeedScala
   } else {
     *array = NULL;
   }
-  vec->num_readers++;
+  CeedAtomicIncrement(vec->num_readers);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -612,13 +696,14 @@ int CeedVectorRestoreArray(CeedVector vec, CeedScalar **array) {
   @ref User
 **/
 int CeedVectorRestoreArrayRead(CeedVector vec, const CeedScalar **array) {
+  bool     is_last_reader;
   CeedSize length;
 
-  CeedCheck(vec->num_readers > 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS,
+  CeedCheck(CeedAtomicLoad(vec->num_readers) > 0, CeedVectorReturnCeed(vec), CEED_ERROR_ACCESS,
             "Cannot restore CeedVector array read access, access was not granted");
-  vec->num_readers--;
+  is_last_reader = CeedAtomicDecrement(vec->num_readers) == 0;
   CeedCall(CeedVectorGetLength(vec, &length));
-  if (length > 0 && vec->num_readers == 0 && vec->RestoreArrayRead) CeedCall(vec->RestoreArrayRead(vec));
+  if (length > 0 && is_last_reader && vec->RestoreArrayRead) CeedCall(vec->RestoreArrayRead(vec));
   *array = NULL;
   return CEED_ERROR_SUCCESS;
 }
@@ -1104,7 +1189,7 @@ int CeedVectorGetLength(CeedVector vec, CeedSize *length) {
   @ref User
 **/
 int CeedVectorDestroy(CeedVector *vec) {
-  if (!*vec || *vec == CEED_VECTOR_ACTIVE || *vec == CEED_VECTOR_NONE || --(*vec)->ref_count > 0) {
+  if (!*vec || *vec == CEED_VECTOR_ACTIVE || *vec == CEED_VECTOR_NONE || CeedAtomicDecrement((*vec)->ref_count) > 0) {
     *vec = NULL;
     return CEED_ERROR_SUCCESS;
   }
@@ -1112,6 +1197,9 @@ int CeedVectorDestroy(CeedVector *vec) {
   CeedCheck((*vec)->num_readers == 0, (*vec)->ceed, CEED_ERROR_ACCESS, "Cannot destroy CeedVector, a process has read access");
 
   if ((*vec)->Destroy) CeedCall((*vec)->Destroy(*vec));
+  if ((*vec)->mapped_file) {
+    CeedCheck(!munmap((*vec)->mapped_file, (*vec)->mapped_file_size), (*vec)->ceed, CEED_ERROR_MAJOR, "Couldn't unmap CeedVector file");
+  }
 
   CeedCall(CeedDestroy(&(*vec)->ceed));
   CeedCall(CeedFree(vec));
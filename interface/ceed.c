@@ -10,6 +10,7 @@
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <limits.h>
+#include <pthread.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -21,6 +22,17 @@
 static CeedRequest ceed_request_immediate;
 static CeedRequest ceed_request_ordered;
 
+// Copy of the stored error message handed to the calling thread, so other threads may store errors while it is read
+static __thread char ceed_err_msg_thread[CEED_MAX_RESOURCE_LEN];
+
+struct CeedRequestQueue_private {
+  pthread_t       thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t  cond_pending, cond_done;
+  CeedRequest     head, tail;
+  bool            is_stopping;
+};
+
 static struct {
   char prefix[CEED_MAX_RESOURCE_LEN];
   int (*init)(const char *resource, Ceed f);
@@ -75,7 +87,7 @@ CeedRequest *const CEED_REQUEST_IMMEDIATE = &ceed_request_immediate;
 
   which allows the sequence to complete asynchronously but does not start `op2` until `op1` has completed.
 
-  @todo The current implementation is overly strict, offering equivalent semantics to @ref CEED_REQUEST_IMMEDIATE.
+  On host backends, ordered work waits for work already queued on the `Ceed` context and then completes before returning.
 
   @sa CEED_REQUEST_IMMEDIATE
  */
@@ -86,6 +98,16 @@ CeedRequest *const CEED_REQUEST_ORDERED = &ceed_request_ordered;
 
   Calling @ref CeedRequestWait() on a `NULL` request is a no-op.
 
+  On backends that prefer @ref CEED_MEM_HOST, only @ref CeedOperatorApply(), @ref CeedOperatorApplyAdd(), and @ref CeedElemRestrictionApply() complete asynchronously, when passed a request other than @ref CEED_REQUEST_IMMEDIATE.
+  Their work is queued on a single worker thread owned by the `Ceed` context, shared with its delegate and fallback contexts, and runs in submission order.
+  Other interfaces that take a @ref CeedRequest, such as @ref CeedOperatorApplyMultiple() and the assembly interfaces, complete before returning and set the request to `NULL`.
+  Backends that do not prefer @ref CEED_MEM_HOST complete the call before returning; initialize requests to `NULL` so that waiting on them is a no-op.
+
+  Any application thread may wait on a request, not only the thread that submitted it, but each request must be waited on exactly once, as it is freed here.
+  A queued request holds references to the `Ceed` context, objects, and vectors passed to the call, released here, so the caller may destroy them before waiting.
+  Until the request has been waited on, the objects and vectors passed to the queued call must not otherwise be accessed or modified by any thread; other objects may still be used with the same `Ceed` context, as described in the thread safety section of the user manual.
+  @ref CeedDestroy() finishes all queued work before destroying the context.
+
   @param[in,out] req Address of @ref CeedRequest to wait for; zeroed on completion.
 
   @return An error code: 0 - success, otherwise - failure
@@ -93,8 +115,21 @@ CeedRequest *const CEED_REQUEST_ORDERED = &ceed_request_ordered;
   @ref User
 **/
 int CeedRequestWait(CeedRequest *req) {
+  int              error;
+  Ceed             ceed = NULL;
+  CeedRequestQueue queue;
+
   if (!*req) return CEED_ERROR_SUCCESS;
-  return CeedError(NULL, CEED_ERROR_UNSUPPORTED, "CeedRequestWait not implemented");
+  queue = (*req)->ceed->request_queue;
+  pthread_mutex_lock(&queue->mutex);
+  while (!(*req)->is_done) pthread_cond_wait(&queue->cond_done, &queue->mutex);
+  pthread_mutex_unlock(&queue->mutex);
+  error = (*req)->error;
+  CeedCall(CeedReferenceCopy((*req)->ceed, &ceed));
+  CeedCall(CeedRequestDestroy(req));
+  if (error) error = CeedError(ceed, error, "Non-blocking request failed");
+  CeedCall(CeedDestroy(&ceed));
+  return error;
 }
 
 /// @}
@@ -165,6 +200,11 @@ static int CeedWorkVectorsDestroy(Ceed ceed) {
   if (!ceed->work_vectors) return CEED_ERROR_SUCCESS;
   for (CeedSize i = 0; i < ceed->work_vectors->num_vecs; i++) {
     CeedCheck(!ceed->work_vectors->is_in_use[i], ceed, CEED_ERROR_ACCESS, "Work vector %" CeedSize_FMT " checked out but not returned");
+    // Vectors created by a delegate hold a reference to the delegate, not a ref-loop
+    if (ceed->work_vectors->vecs[i]->ceed != ceed) {
+      CeedCall(CeedVectorDestroy(&ceed->work_vectors->vecs[i]));
+      continue;
+    }
     ceed->ref_count += 2;  // Note: increase ref_count to prevent Ceed destructor from triggering again
     CeedCall(CeedVectorDestroy(&ceed->work_vectors->vecs[i]));
     ceed->ref_count -= 1;  // Note: restore ref_count
@@ -175,6 +215,264 @@ static int CeedWorkVectorsDestroy(Ceed ceed) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the `Ceed` context that owns the request queue for a `ceed`
+
+  Delegate and fallback contexts share the queue of the user-facing context that created them.
+
+  @param[in] ceed `Ceed` context
+
+  @return `Ceed` context owning the request queue
+
+  @ref Developer
+**/
+static Ceed CeedRequestQueueOwner(Ceed ceed) {
+  while (ceed->parent || ceed->op_fallback_parent) ceed = ceed->parent ? ceed->parent : ceed->op_fallback_parent;
+  return ceed;
+}
+
+/**
+  @brief Worker thread loop for a request queue
+
+  Requests are run in submission order and flagged as done, keeping their error for @ref CeedRequestWait().
+
+  @param[in,out] data `CeedRequestQueue` to process
+
+  @return `NULL`
+
+  @ref Developer
+**/
+static void *CeedRequestQueueRun(void *data) {
+  CeedRequestQueue queue = data;
+
+  pthread_mutex_lock(&queue->mutex);
+  while (true) {
+    int         error;
+    CeedRequest req;
+
+    while (!queue->head && !queue->is_stopping) pthread_cond_wait(&queue->cond_pending, &queue->mutex);
+    if (!queue->head) break;
+    req = queue->head;
+    pthread_mutex_unlock(&queue->mutex);
+    error = req->Run(req);
+    pthread_mutex_lock(&queue->mutex);
+    queue->head = req->next;
+    if (!queue->head) queue->tail = NULL;
+    req->error   = error;
+    req->is_done = true;
+    pthread_cond_broadcast(&queue->cond_done);
+  }
+  pthread_mutex_unlock(&queue->mutex);
+  return NULL;
+}
+
+/**
+  @brief Start the request queue and worker thread for a `ceed`
+
+  @param[in,out] ceed `Ceed` context owning the queue
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedRequestQueueCreate(Ceed ceed) {
+  CeedRequestQueue queue;
+
+  CeedCall(CeedCalloc(1, &queue));
+  pthread_mutex_init(&queue->mutex, NULL);
+  pthread_cond_init(&queue->cond_pending, NULL);
+  pthread_cond_init(&queue->cond_done, NULL);
+  if (pthread_create(&queue->thread, NULL, CeedRequestQueueRun, queue)) {
+    // LCOV_EXCL_START
+    pthread_mutex_destroy(&queue->mutex);
+    pthread_cond_destroy(&queue->cond_pending);
+    pthread_cond_destroy(&queue->cond_done);
+    CeedCall(CeedFree(&queue));
+    return CeedError(ceed, CEED_ERROR_MAJOR, "Unable to start worker thread for non-blocking requests");
+    // LCOV_EXCL_STOP
+  }
+  ceed->request_queue = queue;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Finish queued work and stop the worker thread for a `ceed`
+
+  @param[in,out] ceed `Ceed` context owning the queue
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedRequestQueueDestroy(Ceed ceed) {
+  CeedRequestQueue queue = ceed->request_queue;
+
+  if (!queue) return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&queue->mutex);
+  queue->is_stopping = true;
+  pthread_cond_signal(&queue->cond_pending);
+  pthread_mutex_unlock(&queue->mutex);
+  pthread_join(queue->thread, NULL);
+  pthread_mutex_destroy(&queue->mutex);
+  pthread_cond_destroy(&queue->cond_pending);
+  pthread_cond_destroy(&queue->cond_done);
+  CeedCall(CeedFree(&ceed->request_queue));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Determine if a call with a given @ref CeedRequest should be queued
+
+  Work is only queued for backends that prefer @ref CEED_MEM_HOST; other backends keep handling requests themselves.
+  Calls with @ref CEED_REQUEST_ORDERED are not queued, but first wait for queued work so they complete in submission order.
+
+  @param[in]  ceed     `Ceed` context of the object being applied
+  @param[in]  request  Address of @ref CeedRequest passed by the caller
+  @param[out] is_async Variable to store whether the call should be queued
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedRequestIsAsync(Ceed ceed, CeedRequest *request, bool *is_async) {
+  bool        has_queue;
+  CeedMemType mem_type;
+
+  *is_async = false;
+  if (!request || request == CEED_REQUEST_IMMEDIATE) return CEED_ERROR_SUCCESS;
+  if (request == CEED_REQUEST_ORDERED) return CeedRequestQueueWait(ceed);
+  ceed = CeedRequestQueueOwner(ceed);
+  pthread_mutex_lock(&ceed->mutex);
+  has_queue = ceed->request_queue;
+  pthread_mutex_unlock(&ceed->mutex);
+  // Memory type lookup updates reference counts, so skip it once the worker may be running
+  if (has_queue) {
+    *is_async = true;
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCall(CeedGetPreferredMemType(ceed, &mem_type));
+  *is_async = mem_type == CEED_MEM_HOST;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create a @ref CeedRequest to be filled by the caller and passed to @ref CeedRequestSubmit()
+
+  The request holds a reference to the `Ceed` context owning the queue.
+  Objects and vectors stored in the request by the caller must be references taken with the corresponding `ReferenceCopy` function.
+
+  @param[in]  ceed `Ceed` context of the object being applied
+  @param[in]  Run  Function run on the worker thread, with the return value stored as the request error
+  @param[out] req  Address of the variable to store the newly created @ref CeedRequest
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedRequestCreate(Ceed ceed, int (*Run)(CeedRequest), CeedRequest *req) {
+  CeedCall(CeedCalloc(1, req));
+  CeedCall(CeedReferenceCopy(CeedRequestQueueOwner(ceed), &(*req)->ceed));
+  (*req)->Run = Run;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Release the references held by a @ref CeedRequest and free it
+
+  @param[in,out] req Address of @ref CeedRequest to destroy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedRequestDestroy(CeedRequest *req) {
+  CeedCall(CeedOperatorDestroy(&(*req)->op));
+  CeedCall(CeedElemRestrictionDestroy(&(*req)->rstr));
+  CeedCall(CeedVectorDestroy(&(*req)->in));
+  CeedCall(CeedVectorDestroy(&(*req)->out));
+  CeedCall(CeedDestroy(&(*req)->ceed));
+  CeedCall(CeedFree(req));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Append a @ref CeedRequest to the queue of its `Ceed` context
+
+  The queue and worker thread are started on first use.
+  The references held by `req` are released by @ref CeedRequestWait(), never on the worker thread, so the last reference to the `Ceed` context is not dropped while the worker is running.
+
+  @param[in]  req     @ref CeedRequest to queue
+  @param[out] request Caller request, set to `req`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedRequestSubmit(CeedRequest req, CeedRequest *request) {
+  int              ierr = CEED_ERROR_SUCCESS;
+  CeedRequestQueue queue;
+
+  // Several application threads may submit the first request to the same `Ceed`
+  pthread_mutex_lock(&req->ceed->mutex);
+  if (!req->ceed->request_queue) ierr = CeedRequestQueueCreate(req->ceed);
+  queue = req->ceed->request_queue;
+  pthread_mutex_unlock(&req->ceed->mutex);
+  if (ierr) {
+    // LCOV_EXCL_START
+    CeedCall(CeedRequestDestroy(&req));
+    return ierr;
+    // LCOV_EXCL_STOP
+  }
+  *request = req;
+  pthread_mutex_lock(&queue->mutex);
+  if (queue->tail) queue->tail->next = req;
+  else queue->head = req;
+  queue->tail = req;
+  pthread_cond_signal(&queue->cond_pending);
+  pthread_mutex_unlock(&queue->mutex);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Wait for all queued work for a `ceed` to finish
+
+  @param[in] ceed `Ceed` context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedRequestQueueWait(Ceed ceed) {
+  CeedRequestQueue queue;
+
+  ceed = CeedRequestQueueOwner(ceed);
+  pthread_mutex_lock(&ceed->mutex);
+  queue = ceed->request_queue;
+  pthread_mutex_unlock(&ceed->mutex);
+  if (!queue) return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&queue->mutex);
+  while (queue->head) pthread_cond_wait(&queue->cond_done, &queue->mutex);
+  pthread_mutex_unlock(&queue->mutex);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Complete a @ref CeedRequest for an interface that always runs synchronously
+
+  Non-blocking requests are zeroed, so that @ref CeedRequestWait() is a no-op, and `request` is replaced by @ref CEED_REQUEST_IMMEDIATE so nested calls are not queued.
+
+  @param[in,out] request Address of the caller @ref CeedRequest pointer
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedRequestSetImmediate(CeedRequest **request) {
+  if (*request && *request != CEED_REQUEST_IMMEDIATE && *request != CEED_REQUEST_ORDERED) **request = NULL;
+  *request = CEED_REQUEST_IMMEDIATE;
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -638,9 +936,53 @@ int CeedGetOperatorFallbackResource(Ceed ceed, const char **resource) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create the fallback `Ceed` for `CeedOperator`; caller must hold `ceed->mutex`
+
+  @param[in,out] ceed `Ceed` context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCreateOperatorFallbackCeed_Core(Ceed ceed) {
+  Ceed        fallback_ceed;
+  const char *fallback_resource;
+
+  CeedDebug(ceed, "Creating fallback Ceed");
+  CeedCall(CeedGetOperatorFallbackResource(ceed, &fallback_resource));
+  CeedCall(CeedInit(fallback_resource, &fallback_ceed));
+  fallback_ceed->op_fallback_parent = ceed;
+  fallback_ceed->Error              = ceed->Error;
+  ceed->op_fallback_ceed            = fallback_ceed;
+  {
+    const char **jit_source_roots;
+    CeedInt      num_jit_source_roots = 0;
+
+    CeedCall(CeedGetJitSourceRoots(ceed, &num_jit_source_roots, &jit_source_roots));
+    for (CeedInt i = 0; i < num_jit_source_roots; i++) {
+      CeedCall(CeedAddJitSourceRoot(fallback_ceed, jit_source_roots[i]));
+    }
+    CeedCall(CeedRestoreJitSourceRoots(ceed, &jit_source_roots));
+  }
+  {
+    const char **jit_defines;
+    CeedInt      num_jit_defines = 0;
+
+    CeedCall(CeedGetJitDefines(ceed, &num_jit_defines, &jit_defines));
+    for (CeedInt i = 0; i < num_jit_defines; i++) {
+      CeedCall(CeedAddJitSourceRoot(fallback_ceed, jit_defines[i]));
+    }
+    CeedCall(CeedRestoreJitDefines(ceed, &jit_defines));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the fallback `Ceed` for `CeedOperator`
 
+  The fallback `Ceed` is created on first use, which may happen concurrently from threads sharing `ceed`.
+
   @param[in]  ceed          `Ceed` context
   @param[out] fallback_ceed Variable to store fallback `Ceed`
 
@@ -649,47 +991,20 @@ int CeedGetOperatorFallbackResource(Ceed ceed, const char **resource) {
   @ref Backend
 **/
 int CeedGetOperatorFallbackCeed(Ceed ceed, Ceed *fallback_ceed) {
+  int ierr = CEED_ERROR_SUCCESS;
+
   if (ceed->has_valid_op_fallback_resource) {
     CeedDebug256(ceed, CEED_DEBUG_COLOR_SUCCESS, "---------- CeedOperator Fallback ----------\n");
     CeedDebug(ceed, "Getting fallback from %s to %s\n", ceed->resource, ceed->op_fallback_resource);
   }
 
   // Create fallback Ceed if uninitalized
-  if (!ceed->op_fallback_ceed && ceed->has_valid_op_fallback_resource) {
-    CeedDebug(ceed, "Creating fallback Ceed");
-
-    Ceed        fallback_ceed;
-    const char *fallback_resource;
-
-    CeedCall(CeedGetOperatorFallbackResource(ceed, &fallback_resource));
-    CeedCall(CeedInit(fallback_resource, &fallback_ceed));
-    fallback_ceed->op_fallback_parent = ceed;
-    fallback_ceed->Error              = ceed->Error;
-    ceed->op_fallback_ceed            = fallback_ceed;
-    {
-      const char **jit_source_roots;
-      CeedInt      num_jit_source_roots = 0;
-
-      CeedCall(CeedGetJitSourceRoots(ceed, &num_jit_source_roots, &jit_source_roots));
-      for (CeedInt i = 0; i < num_jit_source_roots; i++) {
-        CeedCall(CeedAddJitSourceRoot(fallback_ceed, jit_source_roots[i]));
-      }
-      CeedCall(CeedRestoreJitSourceRoots(ceed, &jit_source_roots));
-    }
-    {
-      const char **jit_defines;
-      CeedInt      num_jit_defines = 0;
-
-      CeedCall(CeedGetJitDefines(ceed, &num_jit_defines, &jit_defines));
-      for (CeedInt i = 0; i < num_jit_defines; i++) {
-        CeedCall(CeedAddJitSourceRoot(fallback_ceed, jit_defines[i]));
-      }
-      CeedCall(CeedRestoreJitDefines(ceed, &jit_defines));
-    }
-  }
   *fallback_ceed = NULL;
-  if (ceed->op_fallback_ceed) CeedCall(CeedReferenceCopy(ceed->op_fallback_ceed, fallback_ceed));
-  return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&ceed->mutex);
+  if (!ceed->op_fallback_ceed && ceed->has_valid_op_fallback_resource) ierr = CeedCreateOperatorFallbackCeed_Core(ceed);
+  if (!ierr && ceed->op_fallback_ceed) ierr = CeedReferenceCopy(ceed->op_fallback_ceed, fallback_ceed);
+  pthread_mutex_unlock(&ceed->mutex);
+  return ierr;
 }
 
 /**
@@ -813,14 +1128,12 @@ int CeedSetData(Ceed ceed, void *data) {
   @ref Backend
 **/
 int CeedReference(Ceed ceed) {
-  ceed->ref_count++;
+  CeedAtomicIncrement(ceed->ref_count);
   return CEED_ERROR_SUCCESS;
 }
 
 /**
-  @brief Get a `CeedVector` for scratch work from a `Ceed` context.
-
-  Note: This vector must be restored with @ref CeedRestoreWorkVector().
+  @brief Get a `CeedVector` for scratch work from a `Ceed` context; caller must hold `ceed->mutex`
 
   @param[in]  ceed `Ceed` context
   @param[in]  len  Minimum length of work vector
@@ -828,9 +1141,9 @@ int CeedReference(Ceed ceed) {
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
-int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec) {
+static int CeedGetWorkVector_Core(Ceed ceed, CeedSize len, CeedVector *vec) {
   CeedInt i = 0;
 
   if (!ceed->work_vectors) CeedCall(CeedWorkVectorsCreate(ceed));
@@ -857,33 +1170,34 @@ int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec) {
     }
     ceed->work_vectors->num_vecs++;
     CeedCallBackend(CeedVectorCreate(ceed, len, &ceed->work_vectors->vecs[i]));
-    ceed->ref_count--;  // Note: ref_count manipulation to prevent a ref-loop
+    // Note: ref_count manipulation to prevent a ref-loop; vectors created by a delegate reference the delegate instead
+    if (ceed->work_vectors->vecs[i]->ceed == ceed) CeedAtomicDecrement(ceed->ref_count);
   }
   // Return pointer to work vector
   ceed->work_vectors->is_in_use[i] = true;
   *vec                             = NULL;
   CeedCall(CeedVectorReferenceCopy(ceed->work_vectors->vecs[i], vec));
-  ceed->ref_count++;  // Note: bump ref_count to account for external access
+  CeedAtomicIncrement(ceed->ref_count);  // Note: bump ref_count to account for external access
   return CEED_ERROR_SUCCESS;
 }
 
 /**
-  @brief Restore a `CeedVector` for scratch work from a `Ceed` context from @ref CeedGetWorkVector()
+  @brief Restore a `CeedVector` for scratch work to a `Ceed` context; caller must hold `ceed->mutex`
 
   @param[in]  ceed `Ceed` context
   @param[out] vec  `CeedVector` to restore
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
-int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec) {
+static int CeedRestoreWorkVector_Core(Ceed ceed, CeedVector *vec) {
   for (CeedInt i = 0; i < ceed->work_vectors->num_vecs; i++) {
     if (*vec == ceed->work_vectors->vecs[i]) {
       CeedCheck(ceed->work_vectors->is_in_use[i], ceed, CEED_ERROR_ACCESS, "Work vector %" CeedSize_FMT " was not checked out but is being returned");
       CeedCall(CeedVectorDestroy(vec));
       ceed->work_vectors->is_in_use[i] = false;
-      ceed->ref_count--;  // Note: reduce ref_count again to prevent a ref-loop
+      CeedAtomicDecrement(ceed->ref_count);  // Note: reduce ref_count again to prevent a ref-loop
       return CEED_ERROR_SUCCESS;
     }
   }
@@ -892,6 +1206,49 @@ int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec) {
   // LCOV_EXCL_STOP
 }
 
+/**
+  @brief Get a `CeedVector` for scratch work from a `Ceed` context.
+
+  Work vectors may be checked out concurrently by threads sharing `ceed`; each checked out vector is used by a single thread.
+
+  Note: This vector must be restored with @ref CeedRestoreWorkVector().
+
+  @param[in]  ceed `Ceed` context
+  @param[in]  len  Minimum length of work vector
+  @param[out] vec  Address of the variable where `CeedVector` will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec) {
+  int ierr;
+
+  pthread_mutex_lock(&ceed->mutex);
+  ierr = CeedGetWorkVector_Core(ceed, len, vec);
+  pthread_mutex_unlock(&ceed->mutex);
+  return ierr;
+}
+
+/**
+  @brief Restore a `CeedVector` for scratch work from a `Ceed` context from @ref CeedGetWorkVector()
+
+  @param[in]  ceed `Ceed` context
+  @param[out] vec  `CeedVector` to restore
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec) {
+  int ierr;
+
+  pthread_mutex_lock(&ceed->mutex);
+  ierr = CeedRestoreWorkVector_Core(ceed, vec);
+  pthread_mutex_unlock(&ceed->mutex);
+  return ierr;
+}
+
 /**
   @brief Retrieve list of additional JiT source roots from `Ceed` context.
 
@@ -911,7 +1268,7 @@ int CeedGetJitSourceRoots(Ceed ceed, CeedInt *num_source_roots, const char ***ji
   CeedCall(CeedGetParent(ceed, &ceed_parent));
   *num_source_roots = ceed_parent->num_jit_source_roots;
   *jit_source_roots = (const char **)ceed_parent->jit_source_roots;
-  ceed_parent->num_jit_source_roots_readers++;
+  CeedAtomicIncrement(ceed_parent->num_jit_source_roots_readers);
   CeedCall(CeedDestroy(&ceed_parent));
   return CEED_ERROR_SUCCESS;
 }
@@ -931,7 +1288,7 @@ int CeedRestoreJitSourceRoots(Ceed ceed, const char ***jit_source_roots) {
 
   CeedCall(CeedGetParent(ceed, &ceed_parent));
   *jit_source_roots = NULL;
-  ceed_parent->num_jit_source_roots_readers--;
+  CeedAtomicDecrement(ceed_parent->num_jit_source_roots_readers);
   CeedCall(CeedDestroy(&ceed_parent));
   return CEED_ERROR_SUCCESS;
 }
@@ -955,7 +1312,7 @@ int CeedGetJitDefines(Ceed ceed, CeedInt *num_jit_defines, const char ***jit_def
   CeedCall(CeedGetParent(ceed, &ceed_parent));
   *num_jit_defines = ceed_parent->num_jit_defines;
   *jit_defines     = (const char **)ceed_parent->jit_defines;
-  ceed_parent->num_jit_defines_readers++;
+  CeedAtomicIncrement(ceed_parent->num_jit_defines_readers);
   CeedCall(CeedDestroy(&ceed_parent));
   return CEED_ERROR_SUCCESS;
 }
@@ -975,7 +1332,7 @@ int CeedRestoreJitDefines(Ceed ceed, const char ***jit_defines) {
 
   CeedCall(CeedGetParent(ceed, &ceed_parent));
   *jit_defines = NULL;
-  ceed_parent->num_jit_defines_readers--;
+  CeedAtomicDecrement(ceed_parent->num_jit_defines_readers);
   CeedCall(CeedDestroy(&ceed_parent));
   return CEED_ERROR_SUCCESS;
 }
@@ -1034,6 +1391,9 @@ int CeedRegistryGetList(size_t *n, char ***const resources, CeedInt **priorities
 
   Note: Prefixing the resource with "help:" (e.g. "help:/cpu/self") will result in @ref CeedInt() printing the current libCEED version number and a list of current available backend resources to `stderr`.
 
+  Note: Several application threads may share the resulting `Ceed` context, creating and using distinct libCEED objects concurrently.
+  Each object created from the context, such as a `CeedVector` or `CeedOperator`, must only be used by one thread at a time, except that a `CeedBasis` or `CeedElemRestriction` on `/cpu/self` backends may be applied from several threads at once.
+
   @param[in]  resource Resource to use, e.g., "/cpu/self"
   @param[out] ceed     The library context
 
@@ -1122,6 +1482,8 @@ int CeedInit(const char *resource, Ceed *ceed) {
 
   // Setup Ceed
   CeedCall(CeedCalloc(1, ceed));
+  pthread_mutex_init(&(*ceed)->mutex, NULL);
+  pthread_mutex_init(&(*ceed)->err_msg_mutex, NULL);
   CeedCall(CeedCalloc(1, &(*ceed)->jit_source_roots));
   const char *ceed_error_handler = getenv("CEED_ERROR_HANDLER");
   if (!ceed_error_handler) ceed_error_handler = "abort";
@@ -1142,8 +1504,12 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreate),
       CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateAtPoints),
       CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateBlocked),
+      CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateStructured),
       CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorH1),
+      CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorHdiv),
+      CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorHcurl),
       CEED_FTABLE_ENTRY(Ceed, BasisCreateH1),
+      CEED_FTABLE_ENTRY(Ceed, BasisCreateSimplexH1),
       CEED_FTABLE_ENTRY(Ceed, BasisCreateHdiv),
       CEED_FTABLE_ENTRY(Ceed, BasisCreateHcurl),
       CEED_FTABLE_ENTRY(Ceed, TensorContractCreate),
@@ -1178,16 +1544,21 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyAtPointsInElement),
       CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlock),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets),
+      CEED_FTABLE_ENTRY(CeedElemRestriction, RestoreOffsets),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetOrientations),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetCurlOrientations),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetAtPointsElementOffset),
+      CEED_FTABLE_ENTRY(CeedElemRestriction, SetAtPointsOffsets),
       CEED_FTABLE_ENTRY(CeedElemRestriction, Destroy),
       CEED_FTABLE_ENTRY(CeedBasis, Apply),
       CEED_FTABLE_ENTRY(CeedBasis, ApplyAdd),
+      CEED_FTABLE_ENTRY(CeedBasis, ApplyInterpAndGrad),
       CEED_FTABLE_ENTRY(CeedBasis, ApplyAtPoints),
       CEED_FTABLE_ENTRY(CeedBasis, ApplyAddAtPoints),
       CEED_FTABLE_ENTRY(CeedBasis, Destroy),
       CEED_FTABLE_ENTRY(CeedTensorContract, Apply),
+      CEED_FTABLE_ENTRY(CeedTensorContract, StridedApply),
+      CEED_FTABLE_ENTRY(CeedTensorContract, ApplyEvenOdd),
       CEED_FTABLE_ENTRY(CeedTensorContract, Destroy),
       CEED_FTABLE_ENTRY(CeedQFunction, Apply),
       CEED_FTABLE_ENTRY(CeedQFunction, SetCUDAUserFunction),
@@ -1217,7 +1588,9 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
+      CEED_FTABLE_ENTRY(CeedOperator, ApplyAddMultiple),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
+      CEED_FTABLE_ENTRY(CeedOperator, SetActiveElements),
       CEED_FTABLE_ENTRY(CeedOperator, Destroy),
       {NULL, 0}  // End of lookup table - used in SetBackendFunction loop
   };
@@ -1362,7 +1735,8 @@ int CeedAddJitSourceRoot(Ceed ceed, const char *jit_source_root) {
   Ceed ceed_parent;
 
   CeedCall(CeedGetParent(ceed, &ceed_parent));
-  CeedCheck(!ceed_parent->num_jit_source_roots_readers, ceed, CEED_ERROR_ACCESS, "Cannot add JiT source root, read access has not been restored");
+  CeedCheck(!CeedAtomicLoad(ceed_parent->num_jit_source_roots_readers), ceed, CEED_ERROR_ACCESS,
+            "Cannot add JiT source root, read access has not been restored");
 
   CeedInt index       = ceed_parent->num_jit_source_roots;
   size_t  path_length = strlen(jit_source_root);
@@ -1393,7 +1767,8 @@ int CeedAddJitDefine(Ceed ceed, const char *jit_define) {
   Ceed ceed_parent;
 
   CeedCall(CeedGetParent(ceed, &ceed_parent));
-  CeedCheck(!ceed_parent->num_jit_defines_readers, ceed, CEED_ERROR_ACCESS, "Cannot add JiT define, read access has not been restored");
+  CeedCheck(!CeedAtomicLoad(ceed_parent->num_jit_defines_readers), ceed, CEED_ERROR_ACCESS,
+            "Cannot add JiT define, read access has not been restored");
 
   CeedInt index         = ceed_parent->num_jit_defines;
   size_t  define_length = strlen(jit_define);
@@ -1443,15 +1818,17 @@ int CeedView(Ceed ceed, FILE *stream) {
   @ref User
 **/
 int CeedDestroy(Ceed *ceed) {
-  if (!*ceed || --(*ceed)->ref_count > 0) {
+  if (!*ceed || CeedAtomicDecrement((*ceed)->ref_count) > 0) {
     *ceed = NULL;
     return CEED_ERROR_SUCCESS;
   }
 
-  CeedCheck(!(*ceed)->num_jit_source_roots_readers, *ceed, CEED_ERROR_ACCESS,
+  CeedCheck(!CeedAtomicLoad((*ceed)->num_jit_source_roots_readers), *ceed, CEED_ERROR_ACCESS,
             "Cannot destroy ceed context, read access for JiT source roots has been granted");
-  CeedCheck(!(*ceed)->num_jit_defines_readers, *ceed, CEED_ERROR_ACCESS, "Cannot add JiT source root, read access for JiT defines has been granted");
+  CeedCheck(!CeedAtomicLoad((*ceed)->num_jit_defines_readers), *ceed, CEED_ERROR_ACCESS,
+            "Cannot add JiT source root, read access for JiT defines has been granted");
 
+  CeedCall(CeedRequestQueueDestroy(*ceed));
   if ((*ceed)->delegate) CeedCall(CeedDestroy(&(*ceed)->delegate));
 
   if ((*ceed)->obj_delegate_count > 0) {
@@ -1479,6 +1856,8 @@ int CeedDestroy(Ceed *ceed) {
   CeedCall(CeedDestroy(&(*ceed)->op_fallback_ceed));
   CeedCall(CeedFree(&(*ceed)->op_fallback_resource));
   CeedCall(CeedWorkVectorsDestroy(*ceed));
+  pthread_mutex_destroy(&(*ceed)->mutex);
+  pthread_mutex_destroy(&(*ceed)->err_msg_mutex);
   CeedCall(CeedFree(ceed));
   return CEED_ERROR_SUCCESS;
 }
@@ -1487,9 +1866,12 @@ int CeedDestroy(Ceed *ceed) {
 const char *CeedErrorFormat(Ceed ceed, const char *format, va_list *args) {
   if (ceed->parent) return CeedErrorFormat(ceed->parent, format, args);
   if (ceed->op_fallback_parent) return CeedErrorFormat(ceed->op_fallback_parent, format, args);
+  pthread_mutex_lock(&ceed->err_msg_mutex);
   // Using pointer to va_list for better FFI, but clang-tidy can't verify va_list is initalized
   vsnprintf(ceed->err_msg, CEED_MAX_RESOURCE_LEN, format, *args);  // NOLINT
-  return ceed->err_msg;
+  memcpy(ceed_err_msg_thread, ceed->err_msg, CEED_MAX_RESOURCE_LEN);
+  pthread_mutex_unlock(&ceed->err_msg_mutex);
+  return ceed_err_msg_thread;
 }
 // LCOV_EXCL_STOP
 
@@ -1553,9 +1935,11 @@ int CeedErrorStore(Ceed ceed, const char *filename, int line_no, const char *fun
   if (ceed->op_fallback_parent) return CeedErrorStore(ceed->op_fallback_parent, filename, line_no, func, err_code, format, args);
 
   // Build message
+  pthread_mutex_lock(&ceed->err_msg_mutex);
   int len = snprintf(ceed->err_msg, CEED_MAX_RESOURCE_LEN, "%s:%d in %s(): ", filename, line_no, func);
   // Using pointer to va_list for better FFI, but clang-tidy can't verify va_list is initalized
   vsnprintf(ceed->err_msg + len, CEED_MAX_RESOURCE_LEN - len, format, *args);  // NOLINT
+  pthread_mutex_unlock(&ceed->err_msg_mutex);
   return err_code;
 }
 // LCOV_EXCL_STOP
@@ -1619,7 +2003,9 @@ int CeedSetErrorHandler(Ceed ceed, CeedErrorHandler handler) {
 /**
   @brief Get error message
 
-  The error message is only stored when using the error handler @ref CeedErrorStore()
+  The error message is only stored when using the error handler @ref CeedErrorStore().
+  The message is the last error stored by any thread using `ceed`.
+  `err_msg` points to a copy owned by the calling thread and is valid until the next call to @ref CeedGetErrorMessage() on that thread.
 
   @param[in]  ceed    `Ceed` context to retrieve error message
   @param[out] err_msg Char pointer to hold error message
@@ -1631,7 +2017,10 @@ int CeedSetErrorHandler(Ceed ceed, CeedErrorHandler handler) {
 int CeedGetErrorMessage(Ceed ceed, const char **err_msg) {
   if (ceed->parent) return CeedGetErrorMessage(ceed->parent, err_msg);
   if (ceed->op_fallback_parent) return CeedGetErrorMessage(ceed->op_fallback_parent, err_msg);
-  *err_msg = ceed->err_msg;
+  pthread_mutex_lock(&ceed->err_msg_mutex);
+  memcpy(ceed_err_msg_thread, ceed->err_msg, CEED_MAX_RESOURCE_LEN);
+  pthread_mutex_unlock(&ceed->err_msg_mutex);
+  *err_msg = ceed_err_msg_thread;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1651,7 +2040,9 @@ int CeedResetErrorMessage(Ceed ceed, const char **err_msg) {
   if (ceed->parent) return CeedResetErrorMessage(ceed->parent, err_msg);
   if (ceed->op_fallback_parent) return CeedResetErrorMessage(ceed->op_fallback_parent, err_msg);
   *err_msg = NULL;
+  pthread_mutex_lock(&ceed->err_msg_mutex);
   memcpy(ceed->err_msg, "No error message stored", 24);
+  pthread_mutex_unlock(&ceed->err_msg_mutex);
   return CEED_ERROR_SUCCESS;
 }
 
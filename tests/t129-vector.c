@@ -0,0 +1,62 @@
+/// @file
+/// Test creation of vectors backed by a memory-mapped file
+/// \test Test creation of vectors backed by a memory-mapped file
+#include <ceed.h>
+#include <stdio.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+  Ceed          ceed;
+  CeedVector    x;
+  const CeedInt len = 10, offset = 3;
+  CeedScalar    file_array[len + offset];
+  char          file_name[64];
+  FILE         *file;
+
+  CeedInit(argv[1], &ceed);
+
+  // Vector entries start after a header in the file
+  snprintf(file_name, sizeof(file_name), "t129-vector-%d.dat", (int)getpid());
+  for (CeedInt i = 0; i < len + offset; i++) file_array[i] = i - offset;
+  file = fopen(file_name, "wb");
+  fwrite(file_array, sizeof(CeedScalar), len + offset, file);
+  fclose(file);
+
+  for (CeedInt k = 0; k < 2; k++) {
+    const CeedMapMode map_mode = k == 0 ? CEED_MAP_READ : CEED_MAP_READ_WRITE;
+
+    CeedVectorCreateFromFile(ceed, file_name, offset * sizeof(CeedScalar), len, map_mode, CEED_MAP_HINT_HUGE_PAGES | CEED_MAP_HINT_PREFETCH, &x);
+
+    // Check mapped values
+    {
+      const CeedScalar *read_array;
+
+      CeedVectorGetArrayRead(x, CEED_MEM_HOST, &read_array);
+      for (CeedInt i = 0; i < len; i++) {
+        if (read_array[i] != i) printf("[%" CeedInt_FMT "] Error reading mapped array a[%" CeedInt_FMT "] = %f\n", k, i, (double)read_array[i]);
+      }
+      CeedVectorRestoreArrayRead(x, &read_array);
+    }
+
+    // Modify values, written back to the file only in read-write mode
+    CeedVectorScale(x, 2.0);
+    CeedVectorDestroy(&x);
+
+    file = fopen(file_name, "rb");
+    if (fread(file_array, sizeof(CeedScalar), len + offset, file) != (size_t)(len + offset)) printf("Error reading file\n");
+    fclose(file);
+    for (CeedInt i = 0; i < len + offset; i++) {
+      const CeedScalar expected = (k == 1 && i >= offset) ? 2 * (i - offset) : i - offset;
+
+      if (file_array[i] != expected) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in file after unmapping f[%" CeedInt_FMT "] = %f != %f\n", k, i, (double)file_array[i], (double)expected);
+        // LCOV_EXCL_STOP
+      }
+    }
+  }
+  remove(file_name);
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,108 @@
+/// @file
+/// Test creation, use, and destruction of a structured element restriction
+/// \test Test creation, use, and destruction of a structured element restriction
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedVector          x, x_structured, y, y_structured;
+  const CeedInt       dim = 2, num_elem_1d[2] = {4, 3}, p = 3, num_comp = 2;
+  const bool          is_periodic[2] = {true, false};
+  const CeedInt       num_nodes_1d[2] = {num_elem_1d[0] * (p - 1), num_elem_1d[1] * (p - 1) + 1};
+  const CeedInt       num_nodes = num_nodes_1d[0] * num_nodes_1d[1], num_elem = num_elem_1d[0] * num_elem_1d[1], elem_size = p * p;
+  CeedInt             ind[num_elem * elem_size];
+  CeedScalar          x_array[num_nodes * num_comp];
+  CeedElemRestriction elem_restriction, elem_restriction_structured;
+
+  CeedInit(argv[1], &ceed);
+
+  // Equivalent restriction with explicit offsets, components interlaced
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_x = e % num_elem_1d[0], e_y = e / num_elem_1d[0];
+
+    for (CeedInt j = 0; j < p; j++) {
+      for (CeedInt i = 0; i < p; i++) {
+        const CeedInt n_x = (e_x * (p - 1) + i) % num_nodes_1d[0], n_y = e_y * (p - 1) + j;
+
+        ind[e * elem_size + j * p + i] = (n_y * num_nodes_1d[0] + n_x) * num_comp;
+      }
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, 1, num_nodes * num_comp, CEED_MEM_HOST, CEED_USE_POINTER, ind, &elem_restriction);
+  CeedElemRestrictionCreateStructured(ceed, dim, num_elem_1d, p, is_periodic, num_comp, num_comp, 1, num_nodes * num_comp,
+                                      &elem_restriction_structured);
+
+  CeedVectorCreate(ceed, num_nodes * num_comp, &x);
+  for (CeedInt i = 0; i < num_nodes * num_comp; i++) x_array[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, x_array);
+  CeedVectorCreate(ceed, num_nodes * num_comp, &x_structured);
+  CeedVectorCreate(ceed, num_elem * elem_size * num_comp, &y);
+  CeedVectorCreate(ceed, num_elem * elem_size * num_comp, &y_structured);
+
+  // NoTranspose
+  CeedElemRestrictionApply(elem_restriction, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(elem_restriction_structured, CEED_NOTRANSPOSE, x, y_structured, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *y_array, *y_structured_array;
+
+    CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+    CeedVectorGetArrayRead(y_structured, CEED_MEM_HOST, &y_structured_array);
+    for (CeedInt i = 0; i < num_elem * elem_size * num_comp; i++) {
+      if (y_array[i] != y_structured_array[i]) {
+        // LCOV_EXCL_START
+        printf("Error in structured restricted array y[%" CeedInt_FMT "] = %f != %f\n", i, (double)y_structured_array[i], (double)y_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(y, &y_array);
+    CeedVectorRestoreArrayRead(y_structured, &y_structured_array);
+  }
+
+  // Transpose
+  CeedVectorSetValue(x, 0.0);
+  CeedVectorSetValue(x_structured, 0.0);
+  CeedElemRestrictionApply(elem_restriction, CEED_TRANSPOSE, y, x, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(elem_restriction_structured, CEED_TRANSPOSE, y, x_structured, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *x_array, *x_structured_array;
+
+    CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array);
+    CeedVectorGetArrayRead(x_structured, CEED_MEM_HOST, &x_structured_array);
+    for (CeedInt i = 0; i < num_nodes * num_comp; i++) {
+      if (fabs(x_array[i] - x_structured_array[i]) > 10 * CEED_EPSILON * fabs(x_array[i])) {
+        // LCOV_EXCL_START
+        printf("Error in structured transpose array x[%" CeedInt_FMT "] = %f != %f\n", i, (double)x_structured_array[i], (double)x_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(x, &x_array);
+    CeedVectorRestoreArrayRead(x_structured, &x_structured_array);
+  }
+
+  // Explicit offsets
+  {
+    const CeedInt *offsets;
+
+    CeedElemRestrictionGetOffsets(elem_restriction_structured, CEED_MEM_HOST, &offsets);
+    for (CeedInt i = 0; i < num_elem * elem_size; i++) {
+      if (offsets[i] != ind[i]) {
+        // LCOV_EXCL_START
+        printf("Error in structured offsets[%" CeedInt_FMT "] = %" CeedInt_FMT " != %" CeedInt_FMT "\n", i, offsets[i], ind[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedElemRestrictionRestoreOffsets(elem_restriction_structured, &offsets);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&x_structured);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&y_structured);
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedElemRestrictionDestroy(&elem_restriction_structured);
+  CeedDestroy(&ceed);
+  return 0;
+}
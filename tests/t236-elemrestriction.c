@@ -0,0 +1,113 @@
+/// @file
+/// Test creation, use, and destruction of a blocked structured element restriction
+/// \test Test creation, use, and destruction of a blocked structured element restriction
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedVector          x, x_structured, y, y_structured;
+  const CeedInt       dim = 3, num_elem_1d[3] = {3, 2, 2}, p = 2, block_size = 5, num_comp = 3;
+  const CeedInt       num_nodes_1d[3] = {num_elem_1d[0] * (p - 1) + 1, num_elem_1d[1] * (p - 1) + 1, num_elem_1d[2] * (p - 1) + 1};
+  const CeedInt       num_nodes = num_nodes_1d[0] * num_nodes_1d[1] * num_nodes_1d[2], num_elem = num_elem_1d[0] * num_elem_1d[1] * num_elem_1d[2];
+  const CeedInt       elem_size = p * p * p, num_block = num_elem / block_size + !!(num_elem % block_size);
+  CeedInt             ind[num_elem * elem_size];
+  CeedScalar          x_array[num_nodes * num_comp];
+  CeedElemRestriction elem_restriction, elem_restriction_structured;
+
+  CeedInit(argv[1], &ceed);
+
+  // Equivalent restriction with explicit offsets, components blocked
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_x = e % num_elem_1d[0], e_y = (e / num_elem_1d[0]) % num_elem_1d[1], e_z = e / (num_elem_1d[0] * num_elem_1d[1]);
+
+    for (CeedInt k = 0; k < p; k++) {
+      for (CeedInt j = 0; j < p; j++) {
+        for (CeedInt i = 0; i < p; i++) {
+          const CeedInt n_x = e_x * (p - 1) + i, n_y = e_y * (p - 1) + j, n_z = e_z * (p - 1) + k;
+
+          ind[e * elem_size + (k * p + j) * p + i] = (n_z * num_nodes_1d[1] + n_y) * num_nodes_1d[0] + n_x;
+        }
+      }
+    }
+  }
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, block_size, num_comp, num_nodes, num_nodes * num_comp, CEED_MEM_HOST, CEED_USE_POINTER,
+                                   ind, &elem_restriction);
+  CeedElemRestrictionCreateBlockedStructured(ceed, dim, num_elem_1d, p, block_size, NULL, num_comp, 1, num_nodes, num_nodes * num_comp,
+                                             &elem_restriction_structured);
+
+  CeedVectorCreate(ceed, num_nodes * num_comp, &x);
+  for (CeedInt i = 0; i < num_nodes * num_comp; i++) x_array[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, x_array);
+  CeedVectorCreate(ceed, num_nodes * num_comp, &x_structured);
+  CeedVectorCreate(ceed, num_block * block_size * elem_size * num_comp, &y);
+  CeedVectorCreate(ceed, num_block * block_size * elem_size * num_comp, &y_structured);
+
+  // NoTranspose
+  CeedElemRestrictionApply(elem_restriction, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(elem_restriction_structured, CEED_NOTRANSPOSE, x, y_structured, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *y_array, *y_structured_array;
+
+    CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+    CeedVectorGetArrayRead(y_structured, CEED_MEM_HOST, &y_structured_array);
+    for (CeedInt i = 0; i < num_block * block_size * elem_size * num_comp; i++) {
+      if (y_array[i] != y_structured_array[i]) {
+        // LCOV_EXCL_START
+        printf("Error in structured restricted array y[%" CeedInt_FMT "] = %f != %f\n", i, (double)y_structured_array[i], (double)y_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(y, &y_array);
+    CeedVectorRestoreArrayRead(y_structured, &y_structured_array);
+  }
+
+  // Transpose
+  CeedVectorSetValue(x, 0.0);
+  CeedVectorSetValue(x_structured, 0.0);
+  CeedElemRestrictionApply(elem_restriction, CEED_TRANSPOSE, y, x, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(elem_restriction_structured, CEED_TRANSPOSE, y, x_structured, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *x_array, *x_structured_array;
+
+    CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array);
+    CeedVectorGetArrayRead(x_structured, CEED_MEM_HOST, &x_structured_array);
+    for (CeedInt i = 0; i < num_nodes * num_comp; i++) {
+      if (fabs(x_array[i] - x_structured_array[i]) > 10 * CEED_EPSILON * fabs(x_array[i])) {
+        // LCOV_EXCL_START
+        printf("Error in structured transpose array x[%" CeedInt_FMT "] = %f != %f\n", i, (double)x_structured_array[i], (double)x_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(x, &x_array);
+    CeedVectorRestoreArrayRead(x_structured, &x_structured_array);
+  }
+
+  // Offsets built on request, again after the previous readers restored them
+  for (CeedInt r = 0; r < 2; r++) {
+    const CeedInt *offsets, *offsets_structured;
+
+    CeedElemRestrictionGetOffsets(elem_restriction, CEED_MEM_HOST, &offsets);
+    CeedElemRestrictionGetOffsets(elem_restriction_structured, CEED_MEM_HOST, &offsets_structured);
+    for (CeedInt i = 0; i < num_block * block_size * elem_size; i++) {
+      if (offsets[i] != offsets_structured[i]) {
+        // LCOV_EXCL_START
+        printf("Error in structured offsets [%" CeedInt_FMT "] = %" CeedInt_FMT " != %" CeedInt_FMT "\n", i, offsets_structured[i], offsets[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedElemRestrictionRestoreOffsets(elem_restriction, &offsets);
+    CeedElemRestrictionRestoreOffsets(elem_restriction_structured, &offsets_structured);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&x_structured);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&y_structured);
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedElemRestrictionDestroy(&elem_restriction_structured);
+  CeedDestroy(&ceed);
+  return 0;
+}
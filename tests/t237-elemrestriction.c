@@ -0,0 +1,116 @@
+/// @file
+/// Test element restriction with compressed offsets
+/// \test Test element restriction with compressed offsets
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedVector          x, x_compressed, y, y_compressed;
+  const CeedInt       num_elem = 10, elem_size = 4, num_comp = 2, block_size = 3, num_nodes = 70000;
+  const CeedInt       num_block = num_elem / block_size + !!(num_elem % block_size);
+  CeedInt             ind[num_elem * elem_size];
+  CeedElemRestriction elem_restriction, elem_restriction_compressed;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_nodes * num_comp, &x);
+  {
+    CeedScalar *x_array;
+
+    CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &x_array);
+    for (CeedInt i = 0; i < num_nodes * num_comp; i++) x_array[i] = i % 1000 + 1;
+    CeedVectorRestoreArray(x, &x_array);
+  }
+  CeedVectorCreate(ceed, num_nodes * num_comp, &x_compressed);
+  CeedVectorCreate(ceed, num_block * block_size * elem_size * num_comp, &y);
+  CeedVectorCreate(ceed, num_block * block_size * elem_size * num_comp, &y_compressed);
+
+  // Unstructured connectivity, shuffled nodes within each element
+  for (CeedInt e = 0; e < num_elem; e++) {
+    for (CeedInt n = 0; n < elem_size; n++) ind[e * elem_size + n] = (7 * e + 3 * ((n + e) % elem_size)) % (num_nodes / 2);
+  }
+
+  for (CeedInt t = 0; t < 2; t++) {
+    // Second pass, the last element spans more than a 16-bit range of the L-vector
+    if (t == 1) ind[num_elem * elem_size - 1] = num_nodes - 1;
+
+    CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, block_size, num_comp, num_nodes, num_nodes * num_comp, CEED_MEM_HOST,
+                                     CEED_COPY_VALUES, ind, &elem_restriction);
+    CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, block_size, num_comp, num_nodes, num_nodes * num_comp, CEED_MEM_HOST,
+                                     CEED_COPY_VALUES, ind, &elem_restriction_compressed);
+    CeedElemRestrictionSetUseCompressedOffsets(elem_restriction_compressed, true);
+
+    // NoTranspose
+    CeedElemRestrictionApply(elem_restriction, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+    CeedElemRestrictionApply(elem_restriction_compressed, CEED_NOTRANSPOSE, x, y_compressed, CEED_REQUEST_IMMEDIATE);
+    {
+      const CeedScalar *y_array, *y_compressed_array;
+
+      CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+      CeedVectorGetArrayRead(y_compressed, CEED_MEM_HOST, &y_compressed_array);
+      for (CeedInt i = 0; i < num_block * block_size * elem_size * num_comp; i++) {
+        if (y_array[i] != y_compressed_array[i]) {
+          // LCOV_EXCL_START
+          printf("Error in compressed restricted array y[%" CeedInt_FMT "] = %f != %f\n", i, (double)y_compressed_array[i], (double)y_array[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(y, &y_array);
+      CeedVectorRestoreArrayRead(y_compressed, &y_compressed_array);
+    }
+
+    // Transpose
+    CeedVectorSetValue(x_compressed, 0.0);
+    CeedElemRestrictionApply(elem_restriction_compressed, CEED_TRANSPOSE, y_compressed, x_compressed, CEED_REQUEST_IMMEDIATE);
+    {
+      CeedVector        x_check;
+      const CeedScalar *x_check_array, *x_compressed_array;
+
+      CeedVectorCreate(ceed, num_nodes * num_comp, &x_check);
+      CeedVectorSetValue(x_check, 0.0);
+      CeedElemRestrictionApply(elem_restriction, CEED_TRANSPOSE, y, x_check, CEED_REQUEST_IMMEDIATE);
+      CeedVectorGetArrayRead(x_check, CEED_MEM_HOST, &x_check_array);
+      CeedVectorGetArrayRead(x_compressed, CEED_MEM_HOST, &x_compressed_array);
+      for (CeedInt i = 0; i < num_nodes * num_comp; i++) {
+        if (fabs(x_check_array[i] - x_compressed_array[i]) > 10 * CEED_EPSILON * fabs(x_check_array[i])) {
+          // LCOV_EXCL_START
+          printf("Error in compressed transpose array x[%" CeedInt_FMT "] = %f != %f\n", i, (double)x_compressed_array[i], (double)x_check_array[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(x_check, &x_check_array);
+      CeedVectorRestoreArrayRead(x_compressed, &x_compressed_array);
+      CeedVectorDestroy(&x_check);
+    }
+
+    // Offsets rebuilt from the compressed offsets
+    {
+      const CeedInt *offsets, *offsets_compressed;
+
+      CeedElemRestrictionGetOffsets(elem_restriction, CEED_MEM_HOST, &offsets);
+      CeedElemRestrictionGetOffsets(elem_restriction_compressed, CEED_MEM_HOST, &offsets_compressed);
+      for (CeedInt i = 0; i < num_block * block_size * elem_size; i++) {
+        if (offsets[i] != offsets_compressed[i]) {
+          // LCOV_EXCL_START
+          printf("Error in compressed offsets [%" CeedInt_FMT "] = %" CeedInt_FMT " != %" CeedInt_FMT "\n", i, offsets_compressed[i], offsets[i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedElemRestrictionRestoreOffsets(elem_restriction, &offsets);
+      CeedElemRestrictionRestoreOffsets(elem_restriction_compressed, &offsets_compressed);
+    }
+
+    CeedElemRestrictionDestroy(&elem_restriction);
+    CeedElemRestrictionDestroy(&elem_restriction_compressed);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&x_compressed);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&y_compressed);
+  CeedDestroy(&ceed);
+  return 0;
+}
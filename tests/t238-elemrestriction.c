@@ -0,0 +1,99 @@
+/// @file
+/// Test element and node reordering of an element restriction
+/// \test Test element and node reordering of an element restriction
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedVector          x, x_reordered, y, y_reordered;
+  const CeedInt       num_elem_1d = 6, p = 2, num_comp = 2, num_nodes_1d = num_elem_1d * (p - 1) + 1;
+  const CeedInt       num_elem = num_elem_1d * num_elem_1d, elem_size = p * p, num_nodes = num_nodes_1d * num_nodes_1d;
+  CeedInt             ind[num_elem * elem_size], elem_perm[num_elem], l_perm[num_nodes * num_comp];
+  CeedInt             span = 0, span_reordered = 0;
+  CeedElemRestriction elem_restriction, elem_restriction_reordered;
+
+  CeedInit(argv[1], &ceed);
+
+  // Scrambled element order and node numbering
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_scrambled = (7 * e) % num_elem, e_x = e_scrambled % num_elem_1d, e_y = e_scrambled / num_elem_1d;
+
+    for (CeedInt j = 0; j < p; j++) {
+      for (CeedInt i = 0; i < p; i++) {
+        const CeedInt node = (e_y * (p - 1) + j) * num_nodes_1d + e_x * (p - 1) + i;
+
+        ind[e * elem_size + j * p + i] = (11 * node) % num_nodes;
+      }
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes, num_nodes * num_comp, CEED_MEM_HOST, CEED_USE_POINTER, ind,
+                            &elem_restriction);
+  CeedElemRestrictionCreateReordered(elem_restriction, true, elem_perm, l_perm, &elem_restriction_reordered);
+
+  CeedVectorCreate(ceed, num_nodes * num_comp, &x);
+  CeedVectorCreate(ceed, num_nodes * num_comp, &x_reordered);
+  {
+    CeedScalar *x_array, *x_reordered_array;
+
+    CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &x_array);
+    CeedVectorGetArrayWrite(x_reordered, CEED_MEM_HOST, &x_reordered_array);
+    for (CeedInt i = 0; i < num_nodes * num_comp; i++) x_array[i] = 10 + i;
+    for (CeedInt i = 0; i < num_nodes * num_comp; i++) x_reordered_array[l_perm[i]] = x_array[i];
+    CeedVectorRestoreArray(x, &x_array);
+    CeedVectorRestoreArray(x_reordered, &x_reordered_array);
+  }
+  CeedVectorCreate(ceed, num_elem * elem_size * num_comp, &y);
+  CeedVectorCreate(ceed, num_elem * elem_size * num_comp, &y_reordered);
+
+  CeedElemRestrictionApply(elem_restriction, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(elem_restriction_reordered, CEED_NOTRANSPOSE, x_reordered, y_reordered, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *y_array, *y_reordered_array;
+
+    CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+    CeedVectorGetArrayRead(y_reordered, CEED_MEM_HOST, &y_reordered_array);
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt i = 0; i < elem_size * num_comp; i++) {
+        if (y_reordered_array[e * elem_size * num_comp + i] != y_array[elem_perm[e] * elem_size * num_comp + i]) {
+          // LCOV_EXCL_START
+          printf("Error in reordered restricted array y[%" CeedInt_FMT "][%" CeedInt_FMT "] = %f != %f\n", e, i,
+                 (double)y_reordered_array[e * elem_size * num_comp + i], (double)y_array[elem_perm[e] * elem_size * num_comp + i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+    CeedVectorRestoreArrayRead(y, &y_array);
+    CeedVectorRestoreArrayRead(y_reordered, &y_reordered_array);
+  }
+
+  // Node span of consecutive elements should not increase
+  {
+    const CeedInt *offsets, *offsets_reordered;
+
+    CeedElemRestrictionGetOffsets(elem_restriction, CEED_MEM_HOST, &offsets);
+    CeedElemRestrictionGetOffsets(elem_restriction_reordered, CEED_MEM_HOST, &offsets_reordered);
+    for (CeedInt i = 0; i < (num_elem - 1) * elem_size; i++) {
+      for (CeedInt j = i + 1; j < i + 2 * elem_size - i % elem_size; j++) {
+        span           = CeedIntMax(span, offsets[i] > offsets[j] ? offsets[i] - offsets[j] : offsets[j] - offsets[i]);
+        span_reordered = CeedIntMax(span_reordered, offsets_reordered[i] > offsets_reordered[j] ? offsets_reordered[i] - offsets_reordered[j]
+                                                                                                : offsets_reordered[j] - offsets_reordered[i]);
+      }
+    }
+    CeedElemRestrictionRestoreOffsets(elem_restriction, &offsets);
+    CeedElemRestrictionRestoreOffsets(elem_restriction_reordered, &offsets_reordered);
+    // LCOV_EXCL_START
+    if (span_reordered > span) printf("Reordering increased node span: %" CeedInt_FMT " > %" CeedInt_FMT "\n", span_reordered, span);
+    // LCOV_EXCL_STOP
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&x_reordered);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&y_reordered);
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedElemRestrictionDestroy(&elem_restriction_reordered);
+  CeedDestroy(&ceed);
+  return 0;
+}
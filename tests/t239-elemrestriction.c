@@ -0,0 +1,166 @@
+/// @file
+/// Test locating points in a curved mesh and creating the points element restriction
+/// \test Test locating points in a curved mesh and creating the points element restriction
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  const CeedInt       dim = 2, num_elem_1d[2] = {3, 2}, num_elem = 6, p = 3, points_per_elem = 5;
+  const CeedInt       num_nodes_1d[2] = {num_elem_1d[0] * (p - 1) + 1, num_elem_1d[1] * (p - 1) + 1}, num_nodes = num_nodes_1d[0] * num_nodes_1d[1];
+  const CeedInt       num_points = num_elem * points_per_elem + 1;
+  CeedInt             point_elem[num_points], expected_elem[num_points];
+  CeedScalar          x_ref_expected[num_points * dim];
+  CeedVector          x_coords, x_points, x_ref_points;
+  CeedElemRestriction elem_restriction_x, elem_restriction_x_points;
+  CeedBasis           basis_x;
+  CeedScalar          tol;
+
+  CeedInit(argv[1], &ceed);
+  {
+    CeedScalarType scalar_type;
+
+    CeedGetScalarType(&scalar_type);
+    tol = scalar_type == CEED_SCALAR_FP32 ? 5e-4 : 1e-10;
+  }
+
+  // Quadratic mesh of [0, 3] x [0, 2] with curved interior lines
+  {
+    const bool is_periodic[2] = {false, false};
+    CeedScalar x_array[num_nodes * dim];
+
+    CeedElemRestrictionCreateStructured(ceed, dim, num_elem_1d, p, is_periodic, dim, 1, num_nodes, num_nodes * dim, &elem_restriction_x);
+    for (CeedInt j = 0; j < num_nodes_1d[1]; j++) {
+      for (CeedInt i = 0; i < num_nodes_1d[0]; i++) {
+        const CeedScalar x = (CeedScalar)i / (p - 1), y = (CeedScalar)j / (p - 1);
+
+        x_array[j * num_nodes_1d[0] + i]             = x + 0.1 * sin(3.0 * y);
+        x_array[num_nodes + j * num_nodes_1d[0] + i] = y + 0.1 * sin(x);
+      }
+    }
+    CeedVectorCreate(ceed, num_nodes * dim, &x_coords);
+    CeedVectorSetArray(x_coords, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, p + 1, CEED_GAUSS_LOBATTO, &basis_x);
+
+  // Points at known reference coordinates in each element, stored in shuffled order
+  {
+    const CeedInt elem_size = p * p;
+    CeedScalar    x_array[num_points * dim];
+    CeedVector    x_e, x_elem, x_ref, x_phys;
+
+    CeedElemRestrictionCreateVector(elem_restriction_x, NULL, &x_e);
+    CeedElemRestrictionApply(elem_restriction_x, CEED_NOTRANSPOSE, x_coords, x_e, CEED_REQUEST_IMMEDIATE);
+    CeedVectorCreate(ceed, elem_size * dim, &x_elem);
+    CeedVectorCreate(ceed, points_per_elem * dim, &x_ref);
+    CeedVectorCreate(ceed, points_per_elem * dim, &x_phys);
+    for (CeedInt e = 0; e < num_elem; e++) {
+      CeedScalar x_ref_array[points_per_elem * dim];
+
+      {
+        const CeedScalar *x_e_array;
+        CeedScalar        x_elem_array[elem_size * dim];
+
+        CeedVectorGetArrayRead(x_e, CEED_MEM_HOST, &x_e_array);
+        for (CeedInt i = 0; i < elem_size * dim; i++) x_elem_array[i] = x_e_array[e * elem_size * dim + i];
+        CeedVectorRestoreArrayRead(x_e, &x_e_array);
+        CeedVectorSetArray(x_elem, CEED_MEM_HOST, CEED_COPY_VALUES, x_elem_array);
+      }
+      for (CeedInt i = 0; i < points_per_elem; i++) {
+        for (CeedInt d = 0; d < dim; d++) x_ref_array[d * points_per_elem + i] = 0.9 * sin(1.7 * (e * points_per_elem + i) + 2.3 * d);
+      }
+      CeedVectorSetArray(x_ref, CEED_MEM_HOST, CEED_COPY_VALUES, x_ref_array);
+      CeedBasisApplyAtPoints(basis_x, 1, &points_per_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, x_ref, x_elem, x_phys);
+      {
+        const CeedScalar *x_phys_array;
+
+        CeedVectorGetArrayRead(x_phys, CEED_MEM_HOST, &x_phys_array);
+        for (CeedInt i = 0; i < points_per_elem; i++) {
+          const CeedInt point = (7 * (e * points_per_elem + i)) % (num_points - 1);
+
+          expected_elem[point] = e;
+          for (CeedInt d = 0; d < dim; d++) {
+            x_array[point * dim + d]        = x_phys_array[d * points_per_elem + i];
+            x_ref_expected[point * dim + d] = x_ref_array[d * points_per_elem + i];
+          }
+        }
+        CeedVectorRestoreArrayRead(x_phys, &x_phys_array);
+      }
+    }
+    CeedVectorDestroy(&x_e);
+    CeedVectorDestroy(&x_elem);
+    CeedVectorDestroy(&x_ref);
+    CeedVectorDestroy(&x_phys);
+
+    // Last point is outside of the mesh
+    expected_elem[num_points - 1] = -1;
+    for (CeedInt d = 0; d < dim; d++) {
+      x_array[(num_points - 1) * dim + d]        = 10.0;
+      x_ref_expected[(num_points - 1) * dim + d] = 0.0;
+    }
+    CeedVectorCreate(ceed, num_points * dim, &x_points);
+    CeedVectorSetArray(x_points, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+
+  // Locate without guesses, then again reusing the previous assignment
+  for (CeedInt pass = 0; pass < 2; pass++) {
+    if (pass == 0) {
+      for (CeedInt i = 0; i < num_points; i++) point_elem[i] = -1;
+    }
+    CeedElemRestrictionCreateAtPointsByLocation(elem_restriction_x, basis_x, x_coords, x_points, point_elem, &elem_restriction_x_points,
+                                                &x_ref_points);
+    {
+      const CeedScalar *x_ref_array;
+
+      CeedVectorGetArrayRead(x_ref_points, CEED_MEM_HOST, &x_ref_array);
+      for (CeedInt i = 0; i < num_points; i++) {
+        if (point_elem[i] != expected_elem[i]) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT "] Point %" CeedInt_FMT " in element %" CeedInt_FMT " != %" CeedInt_FMT "\n", pass, i, point_elem[i],
+                 expected_elem[i]);
+          // LCOV_EXCL_STOP
+        }
+        for (CeedInt d = 0; d < dim; d++) {
+          if (fabs(x_ref_array[i * dim + d] - x_ref_expected[i * dim + d]) > tol) {
+            // LCOV_EXCL_START
+            printf("[%" CeedInt_FMT "] Point %" CeedInt_FMT " reference coordinate %" CeedInt_FMT ": %f != %f\n", pass, i, d,
+                   (double)x_ref_array[i * dim + d], (double)x_ref_expected[i * dim + d]);
+            // LCOV_EXCL_STOP
+          }
+        }
+      }
+      CeedVectorRestoreArrayRead(x_ref_points, &x_ref_array);
+    }
+    {
+      CeedInt num_points_located;
+
+      CeedElemRestrictionGetNumPoints(elem_restriction_x_points, &num_points_located);
+      if (num_points_located != num_points - 1) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Located %" CeedInt_FMT " points != %" CeedInt_FMT "\n", pass, num_points_located, num_points - 1);
+        // LCOV_EXCL_STOP
+      }
+      for (CeedInt e = 0; e < num_elem; e++) {
+        CeedInt num_points_elem;
+
+        CeedElemRestrictionGetNumPointsInElement(elem_restriction_x_points, e, &num_points_elem);
+        if (num_points_elem != points_per_elem) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT "] Element %" CeedInt_FMT " has %" CeedInt_FMT " points != %" CeedInt_FMT "\n", pass, e, num_points_elem,
+                 points_per_elem);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+    CeedVectorDestroy(&x_ref_points);
+    CeedElemRestrictionDestroy(&elem_restriction_x_points);
+  }
+
+  CeedVectorDestroy(&x_coords);
+  CeedVectorDestroy(&x_points);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedBasisDestroy(&basis_x);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,110 @@
+/// @file
+/// Test fused interpolation and gradient with H^1 Lagrange bases
+/// \test Test fused interpolation and gradient with H^1 Lagrange bases
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  // Underintegrated, overintegrated, and collocated quadrature
+  for (CeedInt dim = 1; dim <= 3; dim++) {
+    for (CeedInt s = 0; s < 3; s++) {
+      const CeedQuadMode quad_mode = s == 2 ? CEED_GAUSS_LOBATTO : CEED_GAUSS;
+      const CeedInt      p = 4, q = s == 0 ? 3 : (s == 1 ? 6 : 4), num_comp = 2, num_elem = 3;
+      CeedInt            num_nodes, num_qpts;
+      CeedScalar         tol;
+      CeedVector         u, v_interp, v_grad, v_interp_ref, v_grad_ref, w, u_t;
+      CeedBasis          basis;
+
+      {
+        CeedScalarType scalar_type;
+
+        CeedGetScalarType(&scalar_type);
+        tol = scalar_type == CEED_SCALAR_FP32 ? 1e-4 : 1e-12;
+      }
+      CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p, q, quad_mode, &basis);
+      CeedBasisGetNumNodes(basis, &num_nodes);
+      CeedBasisGetNumQuadraturePoints(basis, &num_qpts);
+
+      CeedVectorCreate(ceed, num_comp * num_nodes * num_elem, &u);
+      CeedVectorCreate(ceed, num_comp * num_qpts * num_elem, &v_interp);
+      CeedVectorCreate(ceed, dim * num_comp * num_qpts * num_elem, &v_grad);
+      CeedVectorCreate(ceed, num_comp * num_qpts * num_elem, &v_interp_ref);
+      CeedVectorCreate(ceed, dim * num_comp * num_qpts * num_elem, &v_grad_ref);
+      CeedVectorCreate(ceed, dim * num_comp * num_qpts * num_elem, &w);
+      CeedVectorCreate(ceed, num_comp * num_nodes * num_elem, &u_t);
+      {
+        CeedScalar u_array[num_comp * num_nodes * num_elem];
+
+        for (CeedInt i = 0; i < num_comp * num_nodes * num_elem; i++) u_array[i] = sin(0.37 * i + 0.1);
+        CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+      }
+
+      // Fused evaluation matches separate evaluation
+      CeedBasisApplyInterpAndGrad(basis, num_elem, u, v_interp, v_grad);
+      CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u, v_interp_ref);
+      CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, u, v_grad_ref);
+      for (CeedInt m = 0; m < 2; m++) {
+        const CeedInt     len = (m == 0 ? 1 : dim) * num_comp * num_qpts * num_elem;
+        const CeedScalar *v_array, *v_ref_array;
+
+        CeedVectorGetArrayRead(m == 0 ? v_interp : v_grad, CEED_MEM_HOST, &v_array);
+        CeedVectorGetArrayRead(m == 0 ? v_interp_ref : v_grad_ref, CEED_MEM_HOST, &v_ref_array);
+        for (CeedInt i = 0; i < len; i++) {
+          if (fabs(v_array[i] - v_ref_array[i]) > tol) {
+            // LCOV_EXCL_START
+            printf("[%" CeedInt_FMT ", %" CeedInt_FMT ", %s] Entry %" CeedInt_FMT ": %f != %f\n", dim, q, m == 0 ? "interp" : "grad", i,
+                   (double)v_array[i], (double)v_ref_array[i]);
+            // LCOV_EXCL_STOP
+          }
+        }
+        CeedVectorRestoreArrayRead(m == 0 ? v_interp : v_grad, &v_array);
+        CeedVectorRestoreArrayRead(m == 0 ? v_interp_ref : v_grad_ref, &v_ref_array);
+      }
+
+      // Gradient transpose satisfies (w, G u) == (G^T w, u)
+      {
+        CeedScalar w_array[dim * num_comp * num_qpts * num_elem];
+
+        for (CeedInt i = 0; i < dim * num_comp * num_qpts * num_elem; i++) w_array[i] = cos(0.3 * i);
+        CeedVectorSetArray(w, CEED_MEM_HOST, CEED_COPY_VALUES, w_array);
+      }
+      CeedBasisApply(basis, num_elem, CEED_TRANSPOSE, CEED_EVAL_GRAD, w, u_t);
+      {
+        const CeedScalar *u_array, *u_t_array, *v_array, *w_array;
+        CeedScalar        sum_1 = 0, sum_2 = 0;
+
+        CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array);
+        CeedVectorGetArrayRead(u_t, CEED_MEM_HOST, &u_t_array);
+        CeedVectorGetArrayRead(v_grad, CEED_MEM_HOST, &v_array);
+        CeedVectorGetArrayRead(w, CEED_MEM_HOST, &w_array);
+        for (CeedInt i = 0; i < num_comp * num_nodes * num_elem; i++) sum_1 += u_t_array[i] * u_array[i];
+        for (CeedInt i = 0; i < dim * num_comp * num_qpts * num_elem; i++) sum_2 += w_array[i] * v_array[i];
+        CeedVectorRestoreArrayRead(u, &u_array);
+        CeedVectorRestoreArrayRead(u_t, &u_t_array);
+        CeedVectorRestoreArrayRead(v_grad, &v_array);
+        CeedVectorRestoreArrayRead(w, &w_array);
+        if (fabs(sum_1 - sum_2) > 10 * tol * fabs(sum_2)) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] %f != %f\n", dim, q, (double)sum_1, (double)sum_2);
+          // LCOV_EXCL_STOP
+        }
+      }
+
+      CeedVectorDestroy(&u);
+      CeedVectorDestroy(&v_interp);
+      CeedVectorDestroy(&v_grad);
+      CeedVectorDestroy(&v_interp_ref);
+      CeedVectorDestroy(&v_grad_ref);
+      CeedVectorDestroy(&w);
+      CeedVectorDestroy(&u_t);
+      CeedBasisDestroy(&basis);
+    }
+  }
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,135 @@
+/// @file
+/// Test applying H^1 Lagrange bases to a large batch of elements
+/// \test Test applying H^1 Lagrange bases to a large batch of elements
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim = 1; dim <= 3; dim++) {
+    const CeedInt p = 4, q = 5, num_comp = 2, num_elem = 4099;
+    CeedInt       num_nodes, num_qpts;
+    CeedScalar    tol;
+    CeedVector    v_interp, v_grad, v_interp_ref, v_grad_ref;
+    CeedBasis     basis;
+
+    {
+      CeedScalarType scalar_type;
+
+      CeedGetScalarType(&scalar_type);
+      tol = scalar_type == CEED_SCALAR_FP32 ? 1e-4 : 1e-12;
+    }
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p, q, CEED_GAUSS, &basis);
+    CeedBasisGetNumNodes(basis, &num_nodes);
+    CeedBasisGetNumQuadraturePoints(basis, &num_qpts);
+
+    const CeedInt len_nodes = num_comp * num_nodes, len_qpts = dim * num_comp * num_qpts;
+
+    CeedVectorCreate(ceed, num_comp * num_qpts * num_elem, &v_interp);
+    CeedVectorCreate(ceed, len_qpts * num_elem, &v_grad);
+    CeedVectorCreate(ceed, num_comp * num_qpts * num_elem, &v_interp_ref);
+    CeedVectorCreate(ceed, len_qpts * num_elem, &v_grad_ref);
+
+    // Batched application matches element by element application
+    for (CeedInt m = 0; m < 5; m++) {
+      const CeedTransposeMode t_mode    = m < 2 ? CEED_NOTRANSPOSE : CEED_TRANSPOSE;
+      const CeedEvalMode      eval_mode = m == 0 || m == 2 ? CEED_EVAL_INTERP : CEED_EVAL_GRAD;
+      const bool              is_add    = m == 4;
+      const CeedInt           q_comp    = eval_mode == CEED_EVAL_GRAD ? dim : 1;
+      const CeedInt           len_in    = t_mode == CEED_NOTRANSPOSE ? len_nodes : q_comp * num_comp * num_qpts;
+      const CeedInt           len_out   = t_mode == CEED_NOTRANSPOSE ? q_comp * num_comp * num_qpts : len_nodes;
+      const CeedScalar       *u_array, *v_array;
+      CeedScalar             *u_elem_array, *v_elem_array;
+      CeedVector              u_batch, v_batch, u_elem, v_elem;
+
+      CeedVectorCreate(ceed, len_in * num_elem, &u_batch);
+      CeedVectorCreate(ceed, len_out * num_elem, &v_batch);
+      {
+        CeedScalar *array;
+
+        CeedVectorGetArrayWrite(u_batch, CEED_MEM_HOST, &array);
+        for (CeedInt i = 0; i < len_in * num_elem; i++) array[i] = sin(0.37 * i + m);
+        CeedVectorRestoreArray(u_batch, &array);
+      }
+      CeedVectorSetValue(v_batch, 1.0);
+      if (is_add) CeedBasisApplyAdd(basis, num_elem, t_mode, eval_mode, u_batch, v_batch);
+      else CeedBasisApply(basis, num_elem, t_mode, eval_mode, u_batch, v_batch);
+
+      CeedVectorCreate(ceed, len_in, &u_elem);
+      CeedVectorCreate(ceed, len_out, &v_elem);
+      CeedVectorGetArrayRead(u_batch, CEED_MEM_HOST, &u_array);
+      CeedVectorGetArrayRead(v_batch, CEED_MEM_HOST, &v_array);
+      for (CeedInt e = 0; e < num_elem; e++) {
+        CeedVectorGetArrayWrite(u_elem, CEED_MEM_HOST, &u_elem_array);
+        for (CeedInt i = 0; i < len_in; i++) u_elem_array[i] = u_array[i * num_elem + e];
+        CeedVectorRestoreArray(u_elem, &u_elem_array);
+        CeedBasisApply(basis, 1, t_mode, eval_mode, u_elem, v_elem);
+        CeedVectorGetArray(v_elem, CEED_MEM_HOST, &v_elem_array);
+        for (CeedInt i = 0; i < len_out; i++) {
+          const CeedScalar expected = v_elem_array[i] + (is_add ? 1.0 : 0.0);
+
+          if (fabs(v_array[i * num_elem + e] - expected) > tol) {
+            // LCOV_EXCL_START
+            printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Element %" CeedInt_FMT ", entry %" CeedInt_FMT ": %f != %f\n", dim, m, e, i,
+                   (double)v_array[i * num_elem + e], (double)expected);
+            // LCOV_EXCL_STOP
+          }
+        }
+        CeedVectorRestoreArray(v_elem, &v_elem_array);
+      }
+      CeedVectorRestoreArrayRead(u_batch, &u_array);
+      CeedVectorRestoreArrayRead(v_batch, &v_array);
+      CeedVectorDestroy(&u_batch);
+      CeedVectorDestroy(&v_batch);
+      CeedVectorDestroy(&u_elem);
+      CeedVectorDestroy(&v_elem);
+    }
+
+    // Batched fused interpolation and gradient matches separate evaluation
+    {
+      CeedVector u_batch;
+
+      CeedVectorCreate(ceed, len_nodes * num_elem, &u_batch);
+      {
+        CeedScalar *array;
+
+        CeedVectorGetArrayWrite(u_batch, CEED_MEM_HOST, &array);
+        for (CeedInt i = 0; i < len_nodes * num_elem; i++) array[i] = cos(0.23 * i);
+        CeedVectorRestoreArray(u_batch, &array);
+      }
+      CeedBasisApplyInterpAndGrad(basis, num_elem, u_batch, v_interp, v_grad);
+      CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u_batch, v_interp_ref);
+      CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, u_batch, v_grad_ref);
+      for (CeedInt m = 0; m < 2; m++) {
+        const CeedInt     len = (m == 0 ? num_comp * num_qpts : len_qpts) * num_elem;
+        const CeedScalar *v_array, *v_ref_array;
+
+        CeedVectorGetArrayRead(m == 0 ? v_interp : v_grad, CEED_MEM_HOST, &v_array);
+        CeedVectorGetArrayRead(m == 0 ? v_interp_ref : v_grad_ref, CEED_MEM_HOST, &v_ref_array);
+        for (CeedInt i = 0; i < len; i++) {
+          if (fabs(v_array[i] - v_ref_array[i]) > tol) {
+            // LCOV_EXCL_START
+            printf("[%" CeedInt_FMT ", fused %s] Entry %" CeedInt_FMT ": %f != %f\n", dim, m == 0 ? "interp" : "grad", i, (double)v_array[i],
+                   (double)v_ref_array[i]);
+            // LCOV_EXCL_STOP
+          }
+        }
+        CeedVectorRestoreArrayRead(m == 0 ? v_interp : v_grad, &v_array);
+        CeedVectorRestoreArrayRead(m == 0 ? v_interp_ref : v_grad_ref, &v_ref_array);
+      }
+      CeedVectorDestroy(&u_batch);
+    }
+
+    CeedVectorDestroy(&v_interp);
+    CeedVectorDestroy(&v_grad);
+    CeedVectorDestroy(&v_interp_ref);
+    CeedVectorDestroy(&v_grad_ref);
+    CeedBasisDestroy(&basis);
+  }
+  CeedDestroy(&ceed);
+  return 0;
+}
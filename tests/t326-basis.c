@@ -0,0 +1,153 @@
+/// @file
+/// Test interpolation and gradient with collapsed-coordinate simplex H1 bases
+/// \test Test interpolation and gradient with collapsed-coordinate simplex H1 bases
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+// Cubic polynomial and its gradient
+static CeedScalar Eval(CeedInt dim, const CeedScalar x[], CeedScalar df[]) {
+  const CeedScalar z = dim == 3 ? x[2] : 0.0;
+
+  df[0] = 1.0 + 2.0 * x[0] * x[1];
+  df[1] = x[0] * x[0] - 2.0 * x[1] * z - 0.5;
+  if (dim == 3) df[2] = 2.0 - x[1] * x[1];
+  return x[0] + x[0] * x[0] * x[1] - 0.5 * x[1] + 2.0 * z - x[1] * x[1] * z;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim = 2; dim <= 3; dim++) {
+    const CeedElemTopology topo = dim == 2 ? CEED_TOPOLOGY_TRIANGLE : CEED_TOPOLOGY_TET;
+    const CeedInt          p = 4, q = 5, num_comp = 2, num_elem = 3;
+    CeedInt                num_nodes, num_qpts;
+    CeedScalar             tol;
+    CeedVector             u, v, w, u_t;
+    CeedBasis              basis;
+
+    {
+      CeedScalarType scalar_type;
+
+      CeedGetScalarType(&scalar_type);
+      tol = scalar_type == CEED_SCALAR_FP32 ? 1e-3 : 1e-10;
+    }
+    CeedBasisCreateSimplexH1(ceed, topo, num_comp, p, q, &basis);
+    CeedBasisGetNumNodes(basis, &num_nodes);
+    CeedBasisGetNumQuadraturePoints(basis, &num_qpts);
+
+    CeedVectorCreate(ceed, num_comp * num_nodes * num_elem, &u);
+    CeedVectorCreate(ceed, dim * num_comp * num_qpts * num_elem, &v);
+    CeedVectorCreate(ceed, dim * num_comp * num_qpts * num_elem, &w);
+    CeedVectorCreate(ceed, num_comp * num_nodes * num_elem, &u_t);
+
+    // Quadrature weights sum to the simplex volume
+    {
+      const CeedScalar *q_weight;
+      CeedScalar        volume = 0.0;
+
+      CeedBasisGetQWeights(basis, &q_weight);
+      for (CeedInt i = 0; i < num_qpts; i++) volume += q_weight[i];
+      if (fabs(volume - (dim == 2 ? 1.0 / 2.0 : 1.0 / 6.0)) > tol) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Volume %f != %f\n", dim, (double)volume, dim == 2 ? 1.0 / 2.0 : 1.0 / 6.0);
+        // LCOV_EXCL_STOP
+      }
+    }
+
+    // Nodal values on the equispaced lattice, second component and elements scaled
+    {
+      CeedInt    n = 0;
+      CeedScalar u_array[num_comp * num_nodes * num_elem];
+
+      for (CeedInt k = 0; k < (dim == 3 ? p : 1); k++) {
+        for (CeedInt j = 0; j < p - k; j++) {
+          for (CeedInt i = 0; i < p - j - k; i++, n++) {
+            const CeedScalar x[3] = {i / (p - 1.0), j / (p - 1.0), k / (p - 1.0)};
+            CeedScalar       df[3];
+            const CeedScalar f = Eval(dim, x, df);
+
+            for (CeedInt c = 0; c < num_comp; c++) {
+              for (CeedInt e = 0; e < num_elem; e++) u_array[(c * num_nodes + n) * num_elem + e] = (c == 0 ? 1 : -2) * (e + 1) * f;
+            }
+          }
+        }
+      }
+      CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+    }
+
+    // Interpolation and gradient reproduce the cubic at quadrature points
+    for (CeedInt m = 0; m < 2; m++) {
+      const CeedEvalMode eval_mode = m == 0 ? CEED_EVAL_INTERP : CEED_EVAL_GRAD;
+      const CeedScalar  *q_ref, *v_array;
+
+      CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, eval_mode, u, v);
+      CeedBasisGetQRef(basis, &q_ref);
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      for (CeedInt i = 0; i < num_qpts; i++) {
+        CeedScalar x[3], f, df[3];
+
+        for (CeedInt d = 0; d < dim; d++) x[d] = q_ref[d * num_qpts + i];
+        f = Eval(dim, x, df);
+        for (CeedInt d = 0; d < (m == 0 ? 1 : dim); d++) {
+          for (CeedInt c = 0; c < num_comp; c++) {
+            for (CeedInt e = 0; e < num_elem; e++) {
+              const CeedScalar expected = (c == 0 ? 1 : -2) * (e + 1) * (m == 0 ? f : df[d]);
+              const CeedScalar computed = v_array[(((d * num_comp + c) * num_qpts) + i) * num_elem + e];
+
+              if (fabs(computed - expected) > tol) {
+                // LCOV_EXCL_START
+                printf("[%" CeedInt_FMT ", %s] Component %" CeedInt_FMT ", direction %" CeedInt_FMT ", point %" CeedInt_FMT ": %f != %f\n", dim,
+                       m == 0 ? "interp" : "grad", c, d, i, (double)computed, (double)expected);
+                // LCOV_EXCL_STOP
+              }
+            }
+          }
+        }
+      }
+      CeedVectorRestoreArrayRead(v, &v_array);
+    }
+
+    // Transposes satisfy (w, B u) == (B^T w, u)
+    {
+      CeedScalar w_array[dim * num_comp * num_qpts * num_elem];
+
+      for (CeedInt i = 0; i < dim * num_comp * num_qpts * num_elem; i++) w_array[i] = cos(0.3 * i);
+      CeedVectorSetArray(w, CEED_MEM_HOST, CEED_COPY_VALUES, w_array);
+    }
+    for (CeedInt m = 0; m < 2; m++) {
+      const CeedEvalMode eval_mode = m == 0 ? CEED_EVAL_INTERP : CEED_EVAL_GRAD;
+      const CeedInt      len_q     = (m == 0 ? 1 : dim) * num_comp * num_qpts * num_elem;
+      const CeedScalar  *u_array, *u_t_array, *v_array, *w_array;
+      CeedScalar         sum_1 = 0, sum_2 = 0;
+
+      CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, eval_mode, u, v);
+      CeedBasisApply(basis, num_elem, CEED_TRANSPOSE, eval_mode, w, u_t);
+      CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array);
+      CeedVectorGetArrayRead(u_t, CEED_MEM_HOST, &u_t_array);
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      CeedVectorGetArrayRead(w, CEED_MEM_HOST, &w_array);
+      for (CeedInt i = 0; i < num_comp * num_nodes * num_elem; i++) sum_1 += u_t_array[i] * u_array[i];
+      for (CeedInt i = 0; i < len_q; i++) sum_2 += w_array[i] * v_array[i];
+      CeedVectorRestoreArrayRead(u, &u_array);
+      CeedVectorRestoreArrayRead(u_t, &u_t_array);
+      CeedVectorRestoreArrayRead(v, &v_array);
+      CeedVectorRestoreArrayRead(w, &w_array);
+      if (fabs(sum_1 - sum_2) > tol * fabs(sum_2)) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT ", %s] %f != %f\n", dim, m == 0 ? "interp" : "grad", (double)sum_1, (double)sum_2);
+        // LCOV_EXCL_STOP
+      }
+    }
+
+    CeedVectorDestroy(&u);
+    CeedVectorDestroy(&v);
+    CeedVectorDestroy(&w);
+    CeedVectorDestroy(&u_t);
+    CeedBasisDestroy(&basis);
+  }
+  CeedDestroy(&ceed);
+  return 0;
+}
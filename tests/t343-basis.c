@@ -0,0 +1,172 @@
+/// @file
+/// Test interpolation, divergence, and curl with tensor-product H(div) and H(curl) bases
+/// \test Test interpolation, divergence, and curl with tensor-product H(div) and H(curl) bases
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+// Linear vector fields, exactly represented by the lowest order bases, and their divergence or curl
+static void Field(bool is_hdiv, CeedInt dim, const CeedScalar x[], CeedScalar f[]) {
+  if (is_hdiv) {
+    for (CeedInt d = 0; d < dim; d++) f[d] = (d + 1) * x[d] + 0.5;
+  } else if (dim == 2) {
+    f[0] = -x[1] + 0.5;
+    f[1] = x[0];
+  } else {
+    f[0] = -x[1] + 0.5;
+    f[1] = x[0] - x[2];
+    f[2] = x[1];
+  }
+}
+
+static void Deriv(bool is_hdiv, CeedInt dim, CeedScalar f[]) {
+  if (is_hdiv) f[0] = dim == 2 ? 3 : 6;
+  else if (dim == 2) f[0] = 2;
+  else {
+    f[0] = 2;
+    f[1] = 0;
+    f[2] = 2;
+  }
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim = 2; dim <= 3; dim++) {
+    for (CeedInt s = 0; s < 2; s++) {
+      const bool         is_hdiv   = s == 0;
+      const CeedEvalMode eval_mode = is_hdiv ? CEED_EVAL_DIV : CEED_EVAL_CURL;
+      const CeedInt      p = 3, q = 4, num_elem = 2, q_comp = (is_hdiv || dim == 2) ? 1 : dim;
+      CeedInt            num_nodes, num_qpts;
+      CeedScalar         nodes[p], nodes_open[p - 1], weights_open[p - 1], q_ref_1d[q], q_weight_1d[q], tol;
+      CeedVector         u, v, v_deriv, w, w_deriv, u_t;
+      CeedBasis          basis;
+
+      {
+        CeedScalarType scalar_type;
+
+        CeedGetScalarType(&scalar_type);
+        tol = scalar_type == CEED_SCALAR_FP32 ? 1e-4 : 1e-12;
+      }
+      if (is_hdiv) CeedBasisCreateTensorHdivLagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis);
+      else CeedBasisCreateTensorHcurlLagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis);
+      CeedBasisGetNumNodes(basis, &num_nodes);
+      CeedBasisGetNumQuadraturePoints(basis, &num_qpts);
+      CeedLobattoQuadrature(p, nodes, NULL);
+      CeedGaussQuadrature(p - 1, nodes_open, weights_open);
+      CeedGaussQuadrature(q, q_ref_1d, q_weight_1d);
+
+      CeedVectorCreate(ceed, num_nodes * num_elem, &u);
+      CeedVectorCreate(ceed, dim * num_qpts * num_elem, &v);
+      CeedVectorCreate(ceed, q_comp * num_qpts * num_elem, &v_deriv);
+      CeedVectorCreate(ceed, dim * num_qpts * num_elem, &w);
+      CeedVectorCreate(ceed, q_comp * num_qpts * num_elem, &w_deriv);
+      CeedVectorCreate(ceed, num_nodes * num_elem, &u_t);
+
+      // Nodal values, component b of the field at the nodes of block b, scaled by element
+      {
+        const CeedInt N = num_nodes / dim;
+        CeedScalar    u_array[num_nodes * num_elem];
+
+        for (CeedInt b = 0; b < dim; b++) {
+          for (CeedInt i = 0; i < N; i++) {
+            CeedInt    stride = 1;
+            CeedScalar x[3], f[3];
+
+            for (CeedInt j = 0; j < dim; j++) {
+              const bool    is_closed = (j == b) == is_hdiv;
+              const CeedInt n_j       = is_closed ? p : p - 1;
+
+              x[j] = is_closed ? nodes[(i / stride) % n_j] : nodes_open[(i / stride) % n_j];
+              stride *= n_j;
+            }
+            Field(is_hdiv, dim, x, f);
+            for (CeedInt e = 0; e < num_elem; e++) u_array[(b * N + i) * num_elem + e] = (e + 1) * f[b];
+          }
+        }
+        CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+      }
+
+      // Interpolation and divergence or curl reproduce the field at quadrature points
+      CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u, v);
+      CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, eval_mode, u, v_deriv);
+      {
+        const CeedScalar *v_array, *v_deriv_array;
+
+        CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+        CeedVectorGetArrayRead(v_deriv, CEED_MEM_HOST, &v_deriv_array);
+        for (CeedInt i = 0; i < num_qpts; i++) {
+          CeedScalar x[3], f[3], df[3];
+
+          for (CeedInt d = 0; d < dim; d++) x[d] = q_ref_1d[(i / CeedIntPow(q, d)) % q];
+          Field(is_hdiv, dim, x, f);
+          Deriv(is_hdiv, dim, df);
+          for (CeedInt e = 0; e < num_elem; e++) {
+            for (CeedInt d = 0; d < dim; d++) {
+              if (fabs(v_array[(d * num_qpts + i) * num_elem + e] - (e + 1) * f[d]) > tol) {
+                // LCOV_EXCL_START
+                printf("[%" CeedInt_FMT ", %s] Interpolated component %" CeedInt_FMT " at point %" CeedInt_FMT ": %f != %f\n", dim,
+                       is_hdiv ? "H(div)" : "H(curl)", d, i, (double)v_array[(d * num_qpts + i) * num_elem + e], (double)((e + 1) * f[d]));
+                // LCOV_EXCL_STOP
+              }
+            }
+            for (CeedInt k = 0; k < q_comp; k++) {
+              if (fabs(v_deriv_array[(k * num_qpts + i) * num_elem + e] - (e + 1) * df[k]) > 10 * tol) {
+                // LCOV_EXCL_START
+                printf("[%" CeedInt_FMT ", %s] Derivative component %" CeedInt_FMT " at point %" CeedInt_FMT ": %f != %f\n", dim,
+                       is_hdiv ? "H(div)" : "H(curl)", k, i, (double)v_deriv_array[(k * num_qpts + i) * num_elem + e], (double)((e + 1) * df[k]));
+                // LCOV_EXCL_STOP
+              }
+            }
+          }
+        }
+        CeedVectorRestoreArrayRead(v, &v_array);
+        CeedVectorRestoreArrayRead(v_deriv, &v_deriv_array);
+      }
+
+      // Transposes satisfy (w, B u) == (B^T w, u)
+      {
+        CeedScalar w_array[dim * num_qpts * num_elem];
+
+        for (CeedInt i = 0; i < dim * num_qpts * num_elem; i++) w_array[i] = cos(0.7 * i);
+        CeedVectorSetArray(w, CEED_MEM_HOST, CEED_COPY_VALUES, w_array);
+        CeedVectorSetArray(w_deriv, CEED_MEM_HOST, CEED_COPY_VALUES, w_array);
+      }
+      for (CeedInt m = 0; m < 2; m++) {
+        const CeedInt     len_q = (m == 0 ? dim : q_comp) * num_qpts * num_elem;
+        const CeedScalar *u_array, *u_t_array, *v_array, *w_array;
+        CeedScalar        sum_1 = 0, sum_2 = 0;
+
+        CeedBasisApply(basis, num_elem, CEED_TRANSPOSE, m == 0 ? CEED_EVAL_INTERP : eval_mode, m == 0 ? w : w_deriv, u_t);
+        CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array);
+        CeedVectorGetArrayRead(u_t, CEED_MEM_HOST, &u_t_array);
+        CeedVectorGetArrayRead(m == 0 ? v : v_deriv, CEED_MEM_HOST, &v_array);
+        CeedVectorGetArrayRead(m == 0 ? w : w_deriv, CEED_MEM_HOST, &w_array);
+        for (CeedInt i = 0; i < num_nodes * num_elem; i++) sum_1 += u_t_array[i] * u_array[i];
+        for (CeedInt i = 0; i < len_q; i++) sum_2 += w_array[i] * v_array[i];
+        CeedVectorRestoreArrayRead(u, &u_array);
+        CeedVectorRestoreArrayRead(u_t, &u_t_array);
+        CeedVectorRestoreArrayRead(m == 0 ? v : v_deriv, &v_array);
+        CeedVectorRestoreArrayRead(m == 0 ? w : w_deriv, &w_array);
+        if (fabs(sum_1 - sum_2) > 10 * tol * fabs(sum_2)) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %s, %s] %f != %f\n", dim, is_hdiv ? "H(div)" : "H(curl)", m == 0 ? "interp" : "derivative", (double)sum_1,
+                 (double)sum_2);
+          // LCOV_EXCL_STOP
+        }
+      }
+
+      CeedVectorDestroy(&u);
+      CeedVectorDestroy(&v);
+      CeedVectorDestroy(&v_deriv);
+      CeedVectorDestroy(&w);
+      CeedVectorDestroy(&w_deriv);
+      CeedVectorDestroy(&u_t);
+      CeedBasisDestroy(&basis);
+    }
+  }
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,147 @@
+/// @file
+/// Test polynomial interpolation and gradient with transpose at many arbitrary points with multiple components
+/// \test Test polynomial interpolation and gradient with transpose at many arbitrary points with multiple components
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+static CeedScalar Eval(CeedInt dim, const CeedScalar x[]) {
+  CeedScalar result = 1, center = 0.1;
+  for (CeedInt d = 0; d < dim; d++) {
+    result *= (x[d] - center) * (x[d] - center) * (x[d] + center) + 0.5;
+    center += 0.1;
+  }
+  return result;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim = 1; dim <= 3; dim++) {
+    CeedVector    x, x_nodes, x_points, u, u_points, v, w_points;
+    CeedBasis     basis_x, basis_u;
+    const CeedInt p = 9, q = 9, num_comp = 2, num_points = 37, x_dim = CeedIntPow(2, dim), p_dim = CeedIntPow(p, dim);
+    CeedScalar    tol;
+
+    {
+      CeedScalarType scalar_type;
+
+      CeedGetScalarType(&scalar_type);
+      tol = scalar_type == CEED_SCALAR_FP32 ? 5e-3 : 1e-10;
+    }
+
+    CeedVectorCreate(ceed, x_dim * dim, &x);
+    CeedVectorCreate(ceed, p_dim * dim, &x_nodes);
+    CeedVectorCreate(ceed, num_points * dim, &x_points);
+    CeedVectorCreate(ceed, p_dim * num_comp, &u);
+    CeedVectorCreate(ceed, num_points * num_comp * dim, &u_points);
+    CeedVectorCreate(ceed, p_dim * num_comp, &v);
+    CeedVectorCreate(ceed, num_points * num_comp * dim, &w_points);
+
+    // Get nodal coordinates
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, p, CEED_GAUSS_LOBATTO, &basis_x);
+    {
+      CeedScalar x_array[x_dim * dim];
+
+      for (CeedInt d = 0; d < dim; d++) {
+        for (CeedInt i = 0; i < x_dim; i++) x_array[d * x_dim + i] = (i % CeedIntPow(2, d + 1)) / CeedIntPow(2, d) ? 1 : -1;
+      }
+      CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+    }
+    CeedBasisApply(basis_x, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, x, x_nodes);
+
+    // Set values of u at nodes, second component scaled
+    {
+      const CeedScalar *x_array;
+      CeedScalar        u_array[p_dim * num_comp];
+
+      CeedVectorGetArrayRead(x_nodes, CEED_MEM_HOST, &x_array);
+      for (CeedInt i = 0; i < p_dim; i++) {
+        CeedScalar coord[dim];
+
+        for (CeedInt d = 0; d < dim; d++) coord[d] = x_array[d * p_dim + i];
+        u_array[i]         = Eval(dim, coord);
+        u_array[p_dim + i] = -2 * Eval(dim, coord);
+      }
+      CeedVectorRestoreArrayRead(x_nodes, &x_array);
+      CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+    }
+
+    // Spread points over several batches, last one partial
+    {
+      CeedScalar x_array[num_points * dim];
+
+      for (CeedInt d = 0; d < dim; d++) {
+        for (CeedInt i = 0; i < num_points; i++) x_array[d * num_points + i] = sin(1.3 * i + 0.7 * d);
+      }
+      CeedVectorSetArray(x_points, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+    }
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p, q, CEED_GAUSS, &basis_u);
+
+    // Interpolated values at points
+    CeedBasisApplyAtPoints(basis_u, 1, &num_points, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, x_points, u, u_points);
+    {
+      const CeedScalar *x_array, *u_points_array;
+
+      CeedVectorGetArrayRead(x_points, CEED_MEM_HOST, &x_array);
+      CeedVectorGetArrayRead(u_points, CEED_MEM_HOST, &u_points_array);
+      for (CeedInt i = 0; i < num_points; i++) {
+        CeedScalar coord[dim];
+
+        for (CeedInt d = 0; d < dim; d++) coord[d] = x_array[d * num_points + i];
+        for (CeedInt c = 0; c < num_comp; c++) {
+          const CeedScalar fx = (c == 0 ? 1 : -2) * Eval(dim, coord);
+
+          if (fabs(u_points_array[c * num_points + i] - fx) > tol) {
+            // LCOV_EXCL_START
+            printf("[%" CeedInt_FMT ", %" CeedInt_FMT ", %" CeedInt_FMT "] %f != %f\n", dim, c, i, (double)u_points_array[c * num_points + i],
+                   (double)fx);
+            // LCOV_EXCL_STOP
+          }
+        }
+      }
+      CeedVectorRestoreArrayRead(x_points, &x_array);
+      CeedVectorRestoreArrayRead(u_points, &u_points_array);
+    }
+
+    // Gradient and its transpose satisfy (w, G u) == (G^T w, u)
+    {
+      CeedScalar w_array[num_points * num_comp * dim];
+
+      for (CeedInt i = 0; i < num_points * num_comp * dim; i++) w_array[i] = cos(0.9 * i);
+      CeedVectorSetArray(w_points, CEED_MEM_HOST, CEED_COPY_VALUES, w_array);
+    }
+    CeedBasisApplyAtPoints(basis_u, 1, &num_points, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, x_points, u, u_points);
+    CeedBasisApplyAtPoints(basis_u, 1, &num_points, CEED_TRANSPOSE, CEED_EVAL_GRAD, x_points, w_points, v);
+    {
+      const CeedScalar *u_array, *v_array, *u_points_array, *w_points_array;
+      CeedScalar        sum_1 = 0, sum_2 = 0;
+
+      CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array);
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      CeedVectorGetArrayRead(u_points, CEED_MEM_HOST, &u_points_array);
+      CeedVectorGetArrayRead(w_points, CEED_MEM_HOST, &w_points_array);
+      for (CeedInt i = 0; i < p_dim * num_comp; i++) sum_1 += v_array[i] * u_array[i];
+      for (CeedInt i = 0; i < num_points * num_comp * dim; i++) sum_2 += w_points_array[i] * u_points_array[i];
+      CeedVectorRestoreArrayRead(u, &u_array);
+      CeedVectorRestoreArrayRead(v, &v_array);
+      CeedVectorRestoreArrayRead(u_points, &u_points_array);
+      CeedVectorRestoreArrayRead(w_points, &w_points_array);
+      if (fabs(sum_1 - sum_2) > tol * fabs(sum_2)) printf("[%" CeedInt_FMT "] %f != %f\n", dim, (double)sum_1, (double)sum_2);
+    }
+
+    CeedVectorDestroy(&x);
+    CeedVectorDestroy(&x_nodes);
+    CeedVectorDestroy(&x_points);
+    CeedVectorDestroy(&u);
+    CeedVectorDestroy(&u_points);
+    CeedVectorDestroy(&v);
+    CeedVectorDestroy(&w_points);
+    CeedBasisDestroy(&basis_x);
+    CeedBasisDestroy(&basis_u);
+  }
+  CeedDestroy(&ceed);
+  return 0;
+}
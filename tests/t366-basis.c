@@ -0,0 +1,112 @@
+/// @file
+/// Test concurrent application of a shared basis from several threads
+/// \test Test concurrent application of a shared basis from several threads
+#include <ceed.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_THREADS 8
+#define NUM_APPLIES 4
+
+typedef struct {
+  Ceed       ceed;
+  CeedBasis  basis_u, basis_points;
+  CeedInt    id, num_elem;
+  CeedScalar v_sum_expected, v_points_sum_expected, max_error;
+} ThreadData;
+
+static CeedScalar Eval(CeedInt e, CeedInt i) { return sin(0.1 * e + 0.01 * i); }
+
+// Gradient round trip on many elements, so large batches are split into chunks, and interpolation to points in one element
+static void ApplyBasis(Ceed ceed, CeedBasis basis_u, CeedBasis basis_points, CeedInt num_elem, CeedScalar *v_sum, CeedScalar *v_points_sum) {
+  const CeedInt dim = 3, p = 3, q = 4, num_points = 5;
+  const CeedInt num_nodes = p * p * p, num_qpts = q * q * q;
+  CeedVector    u, d_u, v, x_points, v_points;
+  CeedScalar   *u_array;
+
+  CeedVectorCreate(ceed, num_elem * num_nodes, &u);
+  CeedVectorCreate(ceed, num_elem * num_qpts * dim, &d_u);
+  CeedVectorCreate(ceed, num_elem * num_nodes, &v);
+  CeedVectorGetArrayWrite(u, CEED_MEM_HOST, &u_array);
+  for (CeedInt i = 0; i < num_nodes; i++) {
+    for (CeedInt e = 0; e < num_elem; e++) u_array[i * num_elem + e] = Eval(e, i);
+  }
+  CeedVectorRestoreArray(u, &u_array);
+  CeedBasisApply(basis_u, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, u, d_u);
+  CeedBasisApply(basis_u, num_elem, CEED_TRANSPOSE, CEED_EVAL_GRAD, d_u, v);
+  CeedVectorNorm(v, CEED_NORM_1, v_sum);
+
+  CeedVectorCreate(ceed, num_points * dim, &x_points);
+  CeedVectorCreate(ceed, num_points, &v_points);
+  {
+    CeedScalar x_array[num_points * dim];
+
+    for (CeedInt i = 0; i < num_points * dim; i++) x_array[i] = -0.9 + 0.11 * i;
+    CeedVectorSetArray(x_points, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedBasisApplyAtPoints(basis_points, 1, &num_points, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, x_points, u, v_points);
+  CeedVectorNorm(v_points, CEED_NORM_1, v_points_sum);
+
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&d_u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&x_points);
+  CeedVectorDestroy(&v_points);
+}
+
+static void *ApplyShared(void *data) {
+  ThreadData *thread = data;
+  CeedScalar  v_sum, v_points_sum;
+
+  for (CeedInt k = 0; k < NUM_APPLIES; k++) {
+    ApplyBasis(thread->ceed, thread->basis_u, thread->basis_points, thread->num_elem, &v_sum, &v_points_sum);
+    thread->max_error = fmax(thread->max_error, fabs(v_sum - thread->v_sum_expected));
+    thread->max_error = fmax(thread->max_error, fabs(v_points_sum - thread->v_points_sum_expected));
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  CeedBasis  basis_u, basis_points, basis_u_serial, basis_points_serial;
+  pthread_t  threads[NUM_THREADS];
+  ThreadData thread_data[NUM_THREADS];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 3, 1, 3, 4, CEED_GAUSS, &basis_u);
+  CeedBasisCreateTensorH1Lagrange(ceed, 3, 1, 3, 4, CEED_GAUSS, &basis_points);
+  CeedBasisCreateTensorH1Lagrange(ceed, 3, 1, 3, 4, CEED_GAUSS, &basis_u_serial);
+  CeedBasisCreateTensorH1Lagrange(ceed, 3, 1, 3, 4, CEED_GAUSS, &basis_points_serial);
+
+  // Threads alternate between large and small batches, and the first evaluation at points of each thread races to set up the basis
+  for (CeedInt i = 0; i < NUM_THREADS; i++) {
+    thread_data[i].ceed         = ceed;
+    thread_data[i].basis_u      = basis_u;
+    thread_data[i].basis_points = basis_points;
+    thread_data[i].id           = i;
+    thread_data[i].num_elem     = i % 2 ? 4000 + 100 * i : 8;
+    thread_data[i].max_error    = 0.0;
+    // Expected values from identical bases, applied serially
+    ApplyBasis(ceed, basis_u_serial, basis_points_serial, thread_data[i].num_elem, &thread_data[i].v_sum_expected,
+               &thread_data[i].v_points_sum_expected);
+  }
+  for (CeedInt i = 0; i < NUM_THREADS; i++) pthread_create(&threads[i], NULL, ApplyShared, &thread_data[i]);
+  for (CeedInt i = 0; i < NUM_THREADS; i++) pthread_join(threads[i], NULL);
+  for (CeedInt i = 0; i < NUM_THREADS; i++) {
+    if (thread_data[i].max_error > 0.0) {
+      // LCOV_EXCL_START
+      printf("[%" CeedInt_FMT "] Concurrent basis application differs from serial by %e\n", thread_data[i].id, (double)thread_data[i].max_error);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_points);
+  CeedBasisDestroy(&basis_u_serial);
+  CeedBasisDestroy(&basis_points_serial);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,162 @@
+/// @file
+/// Test application and diagonal assembly of mass matrix operator on a subset of elements
+/// \test Test application and diagonal assembly of mass matrix operator on a subset of elements
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass, op_mass_masked;
+  CeedVector          q_data, q_data_masked, x, u, v, v_masked;
+  const CeedInt       num_active_elem = 12, active_elems[] = {2, 3, 4, 17, 18, 19, 20, 21, 22, 23, 24, 29};
+  CeedInt             num_elem = 30, p = 4, q = 6;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  CeedScalar          x_array[num_nodes_x];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1);
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, x_array);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+  CeedVectorCreate(ceed, num_elem * q, &q_data_masked);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Reference operator with quadrature data zeroed on inactive elements
+  {
+    const CeedScalar *q_data_array;
+    CeedScalar       *q_data_masked_array;
+
+    CeedVectorGetArrayRead(q_data, CEED_MEM_HOST, &q_data_array);
+    CeedVectorGetArrayWrite(q_data_masked, CEED_MEM_HOST, &q_data_masked_array);
+    for (CeedInt e = 0, a = 0; e < num_elem; e++) {
+      const bool is_active = a < num_active_elem && active_elems[a] == e;
+
+      for (CeedInt i = 0; i < q; i++) q_data_masked_array[e * q + i] = is_active ? q_data_array[e * q + i] : 0.0;
+      if (is_active) a++;
+    }
+    CeedVectorRestoreArrayRead(q_data, &q_data_array);
+    CeedVectorRestoreArray(q_data_masked, &q_data_masked_array);
+  }
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetActiveElements(op_mass, num_active_elem, active_elems);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_masked);
+  CeedOperatorSetField(op_mass_masked, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data_masked);
+  CeedOperatorSetField(op_mass_masked, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_masked, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  CeedVectorCreate(ceed, num_nodes_u, &v_masked);
+  {
+    CeedScalar u_array[num_nodes_u];
+
+    for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = 1.0 + 0.5 * sin(0.3 * i);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+
+  // Apply and assemble diagonal on active elements
+  for (CeedInt k = 0; k < 2; k++) {
+    const CeedScalar *v_array, *v_masked_array;
+
+    if (k == 0) {
+      CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(op_mass_masked, u, v_masked, CEED_REQUEST_IMMEDIATE);
+    } else {
+      CeedOperatorLinearAssembleDiagonal(op_mass, v, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorLinearAssembleDiagonal(op_mass_masked, v_masked, CEED_REQUEST_IMMEDIATE);
+    }
+
+    // Check output
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_masked, CEED_MEM_HOST, &v_masked_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      if (fabs(v_array[i] - v_masked_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] v[%" CeedInt_FMT "]: %f != %f\n", k, i, (double)v_array[i], (double)v_masked_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_masked, &v_masked_array);
+  }
+
+  // Restore all elements
+  CeedOperatorSetActiveElements(op_mass, 0, NULL);
+  CeedVectorSetValue(u, 1.0);
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *v_array;
+    CeedScalar        sum = 0.;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) sum += v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+    if (fabs(sum - 1.) > 1000. * CEED_EPSILON) printf("Computed Area: %f != True Area: 1.0\n", sum);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_masked);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&q_data_masked);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_mass_masked);
+  CeedDestroy(&ceed);
+  return 0;
+}
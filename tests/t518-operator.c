@@ -0,0 +1,142 @@
+/// @file
+/// Test application of 3D Poisson operator with geometric data computed from the coordinates during the apply
+/// \test Test application of 3D Poisson operator with geometric data computed from the coordinates during the apply
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_diff, qf_diff_on_the_fly;
+  CeedOperator        op_setup, op_diff, op_diff_on_the_fly;
+  CeedVector          q_data, x, u, v, v_on_the_fly;
+  const CeedInt       dim = 3, p = 3, q = 4, n_x = 2, n_y = 2, n_z = 1, num_elem = n_x * n_y * n_z;
+  const CeedInt       num_nodes_1d[3] = {n_x * (p - 1) + 1, n_y * (p - 1) + 1, n_z * (p - 1) + 1};
+  const CeedInt       num_dofs = num_nodes_1d[0] * num_nodes_1d[1] * num_nodes_1d[2], num_qpts = num_elem * q * q * q;
+  CeedInt             ind_x[num_elem * p * p * p];
+
+  CeedInit(argv[1], &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  {
+    CeedScalar x_array[dim * num_dofs];
+
+    // Perturbed mesh so the Jacobians vary across each element
+    for (CeedInt k = 0; k < num_nodes_1d[2]; k++) {
+      for (CeedInt j = 0; j < num_nodes_1d[1]; j++) {
+        for (CeedInt i = 0; i < num_nodes_1d[0]; i++) {
+          const CeedInt    node  = i + num_nodes_1d[0] * (j + num_nodes_1d[1] * k);
+          const CeedScalar X[3]  = {(CeedScalar)i / (num_nodes_1d[0] - 1), (CeedScalar)j / (num_nodes_1d[1] - 1), (CeedScalar)k / (num_nodes_1d[2] - 1)};
+          const CeedScalar shift = 0.05 * sin(3.0 * X[0]) * sin(3.0 * X[1]);
+
+          x_array[node + 0 * num_dofs] = X[0] + shift;
+          x_array[node + 1 * num_dofs] = X[1] - shift;
+          x_array[node + 2 * num_dofs] = X[2] * (1.0 + shift);
+        }
+      }
+    }
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_dofs, &u);
+  {
+    CeedScalar u_array[num_dofs];
+
+    for (CeedInt i = 0; i < num_dofs; i++) u_array[i] = 1.0 + 0.5 * sin(0.7 * i);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, num_dofs, &v);
+  CeedVectorCreate(ceed, num_dofs, &v_on_the_fly);
+  CeedVectorCreate(ceed, num_qpts * dim * (dim + 1) / 2, &q_data);
+
+  // Restrictions
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_x = e % n_x, e_y = (e / n_x) % n_y, e_z = e / (n_x * n_y);
+
+    for (CeedInt k = 0; k < p; k++) {
+      for (CeedInt j = 0; j < p; j++) {
+        for (CeedInt i = 0; i < p; i++) {
+          const CeedInt node_x = e_x * (p - 1) + i, node_y = e_y * (p - 1) + j, node_z = e_z * (p - 1) + k;
+
+          ind_x[e * p * p * p + (k * p + j) * p + i] = node_x + num_nodes_1d[0] * (node_y + num_nodes_1d[1] * node_z);
+        }
+      }
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p * p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p * p * p, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q * q * q, q * q * q * dim * (dim + 1) / 2};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q * q, dim * (dim + 1) / 2, dim * (dim + 1) / 2 * num_qpts, strides_q_data,
+                                   &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DBuild", &qf_setup);
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DApply", &qf_diff);
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DApplyOnTheFly", &qf_diff_on_the_fly);
+
+  // Operator - setup and apply with stored geometric data
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_diff);
+  CeedOperatorSetField(op_diff, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_diff, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Operator - apply with geometric data recomputed from the coordinates
+  CeedOperatorCreate(ceed, qf_diff_on_the_fly, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_diff_on_the_fly);
+  CeedOperatorSetField(op_diff_on_the_fly, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff_on_the_fly, "dx", elem_restriction_x, basis_x, x);
+  CeedOperatorSetField(op_diff_on_the_fly, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_diff_on_the_fly, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_diff, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_diff_on_the_fly, u, v_on_the_fly, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  {
+    const CeedScalar *v_array, *v_on_the_fly_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_on_the_fly, CEED_MEM_HOST, &v_on_the_fly_array);
+    for (CeedInt i = 0; i < num_dofs; i++) {
+      if (fabs(v_array[i] - v_on_the_fly_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("v[%" CeedInt_FMT "]: %f != %f\n", i, (double)v_on_the_fly_array[i], (double)v_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_on_the_fly, &v_on_the_fly_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_on_the_fly);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedQFunctionDestroy(&qf_diff_on_the_fly);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_diff);
+  CeedOperatorDestroy(&op_diff_on_the_fly);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,139 @@
+/// @file
+/// Test concurrent application of composite mass matrix operator
+/// \test Test concurrent application of composite mass matrix operator
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x[4], elem_restriction_u[4], elem_restriction_q_data[4];
+  CeedBasis           basis_x, basis_u[4];
+  CeedQFunction       qf_setup, qf_mass[5];
+  CeedOperator        op_setup[4], op_mass[5], op_serial, op_concurrent;
+  CeedVector          q_data[4], x, u, v_serial, v_concurrent;
+  const CeedInt       num_sub = 4, num_elem_sub = 6, p = 4, q = 6;
+  const CeedInt       num_elem = num_sub * num_elem_sub, num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_sub][num_elem_sub * 2], ind_u[num_sub][num_elem_sub * p];
+  CeedScalar          x_array[num_nodes_x];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1);
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, x_array);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  // Sub-operators on neighboring segments share nodes but no libCEED objects
+  for (CeedInt s = 0; s < num_sub; s++) {
+    CeedInt strides_q_data[3] = {1, q, q};
+
+    for (CeedInt i = 0; i < num_elem_sub; i++) {
+      const CeedInt e = s * num_elem_sub + i;
+
+      ind_x[s][2 * i + 0] = e;
+      ind_x[s][2 * i + 1] = e + 1;
+      for (CeedInt j = 0; j < p; j++) ind_u[s][p * i + j] = e * (p - 1) + j;
+    }
+    CeedElemRestrictionCreate(ceed, num_elem_sub, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x[s], &elem_restriction_x[s]);
+    CeedElemRestrictionCreate(ceed, num_elem_sub, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u[s], &elem_restriction_u[s]);
+    CeedElemRestrictionCreateStrided(ceed, num_elem_sub, q, 1, q * num_elem_sub, strides_q_data, &elem_restriction_q_data[s]);
+    CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u[s]);
+    CeedVectorCreate(ceed, num_elem_sub * q, &q_data[s]);
+
+    CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup[s]);
+    CeedOperatorSetField(op_setup[s], "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_setup[s], "dx", elem_restriction_x[s], basis_x, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_setup[s], "rho", elem_restriction_q_data[s], CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+    CeedOperatorApply(op_setup[s], x, q_data[s], CEED_REQUEST_IMMEDIATE);
+  }
+
+  // The last sub-operator repeats the first segment and shares its restrictions and basis, so it cannot run alongside it
+  for (CeedInt s = 0; s < num_sub + 1; s++) {
+    const CeedInt s_elem = s % num_sub;
+
+    CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass[s]);
+    CeedQFunctionAddInput(qf_mass[s], "rho", 1, CEED_EVAL_NONE);
+    CeedQFunctionAddInput(qf_mass[s], "u", 1, CEED_EVAL_INTERP);
+    CeedQFunctionAddOutput(qf_mass[s], "v", 1, CEED_EVAL_INTERP);
+
+    CeedOperatorCreate(ceed, qf_mass[s], CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass[s]);
+    CeedOperatorSetField(op_mass[s], "rho", elem_restriction_q_data[s_elem], CEED_BASIS_NONE, q_data[s_elem]);
+    CeedOperatorSetField(op_mass[s], "u", elem_restriction_u[s_elem], basis_u[s_elem], CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass[s], "v", elem_restriction_u[s_elem], basis_u[s_elem], CEED_VECTOR_ACTIVE);
+  }
+
+  CeedCompositeOperatorCreate(ceed, &op_serial);
+  CeedCompositeOperatorCreate(ceed, &op_concurrent);
+  for (CeedInt s = 0; s < num_sub + 1; s++) {
+    CeedCompositeOperatorAddSub(op_serial, op_mass[s]);
+    CeedCompositeOperatorAddSub(op_concurrent, op_mass[s]);
+  }
+  CeedCompositeOperatorSetNumThreads(op_concurrent, 3);
+
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorCreate(ceed, num_nodes_u, &v_serial);
+  CeedVectorCreate(ceed, num_nodes_u, &v_concurrent);
+  {
+    CeedScalar u_array[num_nodes_u];
+
+    for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = 1.0 + 0.5 * sin(0.3 * i);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+
+  // First application sets up sub-operators, later applications reuse the thread pool
+  CeedOperatorApply(op_serial, u, v_serial, CEED_REQUEST_IMMEDIATE);
+  for (CeedInt k = 0; k < 3; k++) {
+    if (k == 0) CeedOperatorApply(op_concurrent, u, v_concurrent, CEED_REQUEST_IMMEDIATE);
+    else CeedOperatorApplyAdd(op_concurrent, u, v_concurrent, CEED_REQUEST_IMMEDIATE);
+
+    // Check output
+    {
+      const CeedScalar *v_serial_array, *v_concurrent_array;
+
+      CeedVectorGetArrayRead(v_serial, CEED_MEM_HOST, &v_serial_array);
+      CeedVectorGetArrayRead(v_concurrent, CEED_MEM_HOST, &v_concurrent_array);
+      for (CeedInt i = 0; i < num_nodes_u; i++) {
+        if (fabs(v_concurrent_array[i] - (k + 1) * v_serial_array[i]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT "] v[%" CeedInt_FMT "]: %f != %f\n", k, i, (double)v_concurrent_array[i], (double)((k + 1) * v_serial_array[i]));
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(v_serial, &v_serial_array);
+      CeedVectorRestoreArrayRead(v_concurrent, &v_concurrent_array);
+    }
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v_serial);
+  CeedVectorDestroy(&v_concurrent);
+  for (CeedInt s = 0; s < num_sub; s++) {
+    CeedVectorDestroy(&q_data[s]);
+    CeedElemRestrictionDestroy(&elem_restriction_x[s]);
+    CeedElemRestrictionDestroy(&elem_restriction_u[s]);
+    CeedElemRestrictionDestroy(&elem_restriction_q_data[s]);
+    CeedBasisDestroy(&basis_u[s]);
+    CeedOperatorDestroy(&op_setup[s]);
+  }
+  for (CeedInt s = 0; s < num_sub + 1; s++) {
+    CeedQFunctionDestroy(&qf_mass[s]);
+    CeedOperatorDestroy(&op_mass[s]);
+  }
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedOperatorDestroy(&op_serial);
+  CeedOperatorDestroy(&op_concurrent);
+  CeedDestroy(&ceed);
+  return 0;
+}
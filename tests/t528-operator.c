@@ -0,0 +1,148 @@
+/// @file
+/// Test concurrent application of independent operators sharing a Ceed context from several threads
+/// \test Test concurrent application of independent operators sharing a Ceed context from several threads
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_THREADS 8
+#define NUM_APPLIES 20
+
+typedef struct {
+  Ceed    ceed;
+  CeedInt id;
+} ThreadData;
+
+static void *ApplyMass(void *data) {
+  ThreadData         *thread = data;
+  Ceed                ceed   = thread->ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, u, v;
+  const CeedScalar    length   = 1.0 + thread->id;
+  const CeedInt       num_elem = 10 + thread->id, p = 4, q = 6;
+  const CeedInt       num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+
+  // Each thread builds its own objects from the shared context, with a different mesh per thread
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  {
+    CeedScalar x_array[num_nodes_x];
+
+    for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = length * i / num_elem;
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_COPY_VALUES, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_COPY_VALUES, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  CeedQFunctionCreateInteriorByName(ceed, "Mass1DBuild", &qf_setup);
+  CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  for (CeedInt k = 0; k < NUM_APPLIES; k++) {
+    // Work vectors and the fallback context are shared through the Ceed context
+    {
+      Ceed       ceed_fallback;
+      CeedVector work;
+      CeedScalar norm;
+
+      CeedGetOperatorFallbackCeed(ceed, &ceed_fallback);
+      CeedDestroy(&ceed_fallback);
+      CeedGetWorkVector(ceed, num_nodes_u, &work);
+      CeedVectorSetValue(work, thread->id + k);
+      CeedVectorNorm(work, CEED_NORM_MAX, &norm);
+      CeedRestoreWorkVector(ceed, &work);
+      if (norm != thread->id + k) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Work vector shared between threads, max value %f != %f\n", thread->id, (double)norm, (double)(thread->id + k));
+        // LCOV_EXCL_STOP
+      }
+    }
+
+    // Apply mass matrix to a constant; the sum of the result is the length of the domain
+    CeedVectorSetValue(u, 1.0);
+    CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+    {
+      const CeedScalar *v_array;
+      CeedScalar        sum = 0.0;
+
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      for (CeedInt i = 0; i < num_nodes_u; i++) sum += v_array[i];
+      CeedVectorRestoreArrayRead(v, &v_array);
+      if (fabs(sum - length) > 1000. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Computed Area: %f != True Area: %f\n", thread->id, (double)sum, (double)length);
+        // LCOV_EXCL_STOP
+      }
+    }
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  pthread_t  threads[NUM_THREADS];
+  ThreadData thread_data[NUM_THREADS];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i = 0; i < NUM_THREADS; i++) {
+    thread_data[i].ceed = ceed;
+    thread_data[i].id   = i;
+    pthread_create(&threads[i], NULL, ApplyMass, &thread_data[i]);
+  }
+  for (CeedInt i = 0; i < NUM_THREADS; i++) pthread_join(threads[i], NULL);
+
+  CeedDestroy(&ceed);
+  return 0;
+}
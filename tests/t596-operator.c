@@ -0,0 +1,147 @@
+/// @file
+/// Test 1D mass matrix operator at points with widely varying and empty numbers of points per element
+/// \test Test 1D mass matrix operator at points with widely varying and empty numbers of points per element
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  const CeedInt       num_elem = 20, dim = 1, p = 3, max_points_per_elem = 7;
+  const CeedInt       num_nodes_u = num_elem * (p - 1) + 1, max_num_points = num_elem * max_points_per_elem;
+  const CeedScalar    h           = 1.0 / num_elem;
+  CeedInt             num_points  = 0, ind_x[num_elem * 2], ind_u[num_elem * p], ind_x_points[num_elem + 1 + max_num_points];
+  CeedScalar          x_array_mesh[num_elem + 1], x_array_points[max_num_points], w_array_points[max_num_points];
+  CeedScalar          sum_area = 0.0, sum_moment = 0.0;
+  CeedVector          x_elem, x_points, w_points, q_data, u, v;
+  CeedElemRestriction elem_restriction_x_points, elem_restriction_q_data, elem_restriction_x, elem_restriction_u;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+
+  CeedInit(argv[1], &ceed);
+
+  // Mesh coordinates
+  for (CeedInt i = 0; i < num_elem + 1; i++) x_array_mesh[i] = i * h;
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedVectorCreate(ceed, num_elem + 1, &x_elem);
+  CeedVectorSetArray(x_elem, CEED_MEM_HOST, CEED_USE_POINTER, x_array_mesh);
+
+  // U mesh
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) ind_u[p * i + j] = i * (p - 1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  // Points per element cycle through 0 to max_points_per_elem, so blocks of elements mix counts and some elements are empty
+  ind_x_points[0] = num_elem + 1;
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt num_points_elem = (3 * e) % (max_points_per_elem + 1);
+
+    if (num_points_elem > 0) {
+      CeedGaussQuadrature(num_points_elem, &x_array_points[num_points], &w_array_points[num_points]);
+      for (CeedInt i = 0; i < num_points_elem; i++) ind_x_points[num_elem + 1 + num_points + i] = num_points + i;
+      num_points += num_points_elem;
+      // Exact integrals of 1 and x over the element
+      sum_area += h;
+      sum_moment += h * h * (e + 0.5);
+    }
+    ind_x_points[e + 1] = num_elem + 1 + num_points;
+  }
+  CeedVectorCreate(ceed, num_points, &x_points);
+  CeedVectorSetArray(x_points, CEED_MEM_HOST, CEED_USE_POINTER, x_array_points);
+  CeedVectorCreate(ceed, num_points, &w_points);
+  CeedVectorSetArray(w_points, CEED_MEM_HOST, CEED_USE_POINTER, w_array_points);
+  CeedVectorCreate(ceed, num_points, &q_data);
+  CeedElemRestrictionCreateAtPoints(ceed, num_elem, num_points, 1, num_points, CEED_MEM_HOST, CEED_COPY_VALUES, ind_x_points,
+                                    &elem_restriction_x_points);
+  CeedElemRestrictionCreateAtPoints(ceed, num_elem, num_points, 1, num_points, CEED_MEM_HOST, CEED_COPY_VALUES, ind_x_points,
+                                    &elem_restriction_q_data);
+
+  // Basis creation
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, p, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, p, CEED_GAUSS_LOBATTO, &basis_u);
+
+  // Setup geometric scaling, quadrature weights at points are a passive input
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_setup, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedOperatorCreateAtPoints(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", elem_restriction_q_data, CEED_BASIS_NONE, w_points);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedOperatorAtPointsSetPoints(op_setup, elem_restriction_x_points, x_points);
+
+  CeedOperatorApply(op_setup, x_elem, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Mass operator
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedOperatorCreateAtPoints(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorAtPointsSetPoints(op_mass, elem_restriction_x_points, x_points);
+
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+
+  // Apply with u = 1 and u = x, each row sum of v gives an integral over the elements with points
+  for (CeedInt k = 0; k < 2; k++) {
+    const CeedScalar expected = k == 0 ? sum_area : sum_moment;
+
+    {
+      CeedScalar *u_array;
+
+      CeedVectorGetArrayWrite(u, CEED_MEM_HOST, &u_array);
+      for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = k == 0 ? 1.0 : i * h / (p - 1);
+      CeedVectorRestoreArray(u, &u_array);
+    }
+    CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+    {
+      const CeedScalar *v_array;
+      CeedScalar        sum = 0.0;
+
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      for (CeedInt i = 0; i < num_nodes_u; i++) sum += v_array[i];
+      CeedVectorRestoreArrayRead(v, &v_array);
+      if (fabs(sum - expected) > 1000. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Computed integral: %f != True integral: %f\n", k, sum, expected);
+        // LCOV_EXCL_STOP
+      }
+    }
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x_elem);
+  CeedVectorDestroy(&x_points);
+  CeedVectorDestroy(&w_points);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_x_points);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,188 @@
+/// @file
+/// Test moving points between elements of a 1D mass matrix operator at points
+/// \test Test moving points between elements of a 1D mass matrix operator at points
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+
+// Points per element for each pass; the third pass exceeds the maximum of the first
+static CeedInt NumPointsInElement(CeedInt pass, CeedInt e) {
+  switch (pass) {
+    case 0:
+      return (3 * e) % 6;
+    case 1:
+      return e % 3;
+    case 2:
+      return 1 + (5 * e) % 9;
+    default:
+      return (7 * e) % 4;
+  }
+}
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  const CeedInt       num_elem = 10, dim = 1, p = 3, num_passes = 4, max_points_per_elem = 9;
+  const CeedInt       num_nodes_u = num_elem * (p - 1) + 1, max_num_points = num_elem * max_points_per_elem;
+  const CeedScalar    h = 1.0 / num_elem;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p], ind_x_points[num_elem + 1 + max_num_points];
+  CeedScalar          x_array_mesh[num_elem + 1];
+  CeedVector          x_elem, x_points, w_points, q_data, u, v;
+  CeedElemRestriction elem_restriction_x_points, elem_restriction_q_data, elem_restriction_x, elem_restriction_u;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+
+  CeedInit(argv[1], &ceed);
+
+  // Mesh coordinates
+  for (CeedInt i = 0; i < num_elem + 1; i++) x_array_mesh[i] = i * h;
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedVectorCreate(ceed, num_elem + 1, &x_elem);
+  CeedVectorSetArray(x_elem, CEED_MEM_HOST, CEED_USE_POINTER, x_array_mesh);
+
+  // U mesh
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) ind_u[p * i + j] = i * (p - 1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  // Point vectors are sized for the largest number of points over all passes
+  CeedVectorCreate(ceed, max_num_points, &x_points);
+  CeedVectorSetValue(x_points, 0.0);
+  CeedVectorCreate(ceed, max_num_points, &w_points);
+  CeedVectorSetValue(w_points, 0.0);
+  CeedVectorCreate(ceed, max_num_points, &q_data);
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+
+  // Basis creation
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, p, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, p, CEED_GAUSS_LOBATTO, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_setup, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  for (CeedInt pass = 0; pass < num_passes; pass++) {
+    CeedInt    num_points = 0;
+    CeedScalar sum_area = 0.0, sum_moment = 0.0;
+
+    // Points for this pass, stored in reverse order of elements
+    {
+      CeedInt     point = 0;
+      CeedScalar *x_array, *w_array;
+
+      for (CeedInt e = 0; e < num_elem; e++) num_points += NumPointsInElement(pass, e);
+      CeedVectorGetArray(x_points, CEED_MEM_HOST, &x_array);
+      CeedVectorGetArray(w_points, CEED_MEM_HOST, &w_array);
+      ind_x_points[0] = num_elem + 1;
+      for (CeedInt e = 0; e < num_elem; e++) {
+        const CeedInt num_points_elem = NumPointsInElement(pass, e);
+
+        if (num_points_elem > 0) {
+          CeedScalar x_elem_points[max_points_per_elem], w_elem_points[max_points_per_elem];
+
+          CeedGaussQuadrature(num_points_elem, x_elem_points, w_elem_points);
+          for (CeedInt i = 0; i < num_points_elem; i++) {
+            const CeedInt index = num_points - 1 - (point + i);
+
+            ind_x_points[num_elem + 1 + point + i] = index;
+            x_array[index]                         = x_elem_points[i];
+            w_array[index]                         = w_elem_points[i];
+          }
+          point += num_points_elem;
+          // Exact integrals of 1 and x over the element
+          sum_area += h;
+          sum_moment += h * h * (e + 0.5);
+        }
+        ind_x_points[e + 1] = num_elem + 1 + point;
+      }
+      CeedVectorRestoreArray(x_points, &x_array);
+      CeedVectorRestoreArray(w_points, &w_array);
+    }
+
+    if (pass == 0) {
+      CeedElemRestrictionCreateAtPoints(ceed, num_elem, num_points, 1, max_num_points, CEED_MEM_HOST, CEED_COPY_VALUES, ind_x_points,
+                                        &elem_restriction_x_points);
+      CeedElemRestrictionCreateAtPoints(ceed, num_elem, num_points, 1, max_num_points, CEED_MEM_HOST, CEED_COPY_VALUES, ind_x_points,
+                                        &elem_restriction_q_data);
+
+      CeedOperatorCreateAtPoints(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+      CeedOperatorSetField(op_setup, "weight", elem_restriction_q_data, CEED_BASIS_NONE, w_points);
+      CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+      CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+      CeedOperatorAtPointsSetPoints(op_setup, elem_restriction_x_points, x_points);
+
+      CeedOperatorCreateAtPoints(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+      CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+      CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+      CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+      CeedOperatorAtPointsSetPoints(op_mass, elem_restriction_x_points, x_points);
+    } else {
+      CeedOperatorAtPointsUpdatePoints(op_setup, num_points, ind_x_points);
+      CeedOperatorAtPointsUpdatePoints(op_mass, num_points, ind_x_points);
+    }
+    CeedOperatorApply(op_setup, x_elem, q_data, CEED_REQUEST_IMMEDIATE);
+
+    // Apply with u = 1 and u = x, each row sum of v gives an integral over the elements with points
+    for (CeedInt k = 0; k < 2; k++) {
+      const CeedScalar expected = k == 0 ? sum_area : sum_moment;
+
+      {
+        CeedScalar *u_array;
+
+        CeedVectorGetArrayWrite(u, CEED_MEM_HOST, &u_array);
+        for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = k == 0 ? 1.0 : i * h / (p - 1);
+        CeedVectorRestoreArray(u, &u_array);
+      }
+      CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+      {
+        const CeedScalar *v_array;
+        CeedScalar        sum = 0.0;
+
+        CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+        for (CeedInt i = 0; i < num_nodes_u; i++) sum += v_array[i];
+        CeedVectorRestoreArrayRead(v, &v_array);
+        if (fabs(sum - expected) > 1000. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Computed integral: %f != True integral: %f\n", pass, k, sum, expected);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x_elem);
+  CeedVectorDestroy(&x_points);
+  CeedVectorDestroy(&w_points);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_x_points);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}